@@ -0,0 +1,857 @@
+/// @file     bench.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "benchmark" class (core paths benchmark suite).
+
+#include "bench.hpp"
+#include <filesystem>
+
+// Benchmark OpenCL kernel source (one argument per data class):
+static const char* nu_bench_source =
+  "__kernel void thekernel (\n"
+  "                         __global int*   int1,\n"
+  "                         __global int*   int2,\n"
+  "                         __global int*   int3,\n"
+  "                         __global int*   int4,\n"
+  "                         __global float* float1,\n"
+  "                         __global float* float2,\n"
+  "                         __global float* float3,\n"
+  "                         __global float* float4,\n"
+  "                         __global float* float16\n"
+  "                        )\n"
+  "{\n"
+  "  int1[get_global_id (0)] += 1;\n"
+  "}\n";
+
+// Neighbour loop OpenCL kernel source (one kernel per topology mode, same per-node result):
+static const char* nu_bench_neighbour_source =
+  "__kernel void nu_bench_full (\n"
+  "                             __global int*    neighbour_offset,\n"
+  "                             __global int*    neighbour,\n"
+  "                             __global int*    neighbour_center,\n"
+  "                             __global float4* neighbour_link,\n"
+  "                             __global float*  neighbour_length,\n"
+  "                             __global float4* result,\n"
+  "                             int              nodes\n"
+  "                            )\n"
+  "{\n"
+  "  int    i = get_global_id (0);\n"
+  "  float4 f = (float4)(0.0f);\n"
+  "  int    s;\n"
+  "\n"
+  "  if(i >= nodes) return;\n"
+  "\n"
+  "  for(s = (i == 0) ? 0 : neighbour_offset[i - 1]; s < neighbour_offset[i]; s++)\n"
+  "  {\n"
+  "    f += neighbour_link[s]*neighbour_length[s] + (float)(neighbour[s] - neighbour_center[s]);\n"
+  "  }\n"
+  "\n"
+  "  result[i] = f;\n"
+  "}\n"
+  "\n"
+  "__kernel void nu_bench_compact_16 (\n"
+  "                                   __global int*    neighbour_offset,\n"
+  "                                   __global int*    neighbour_local,\n"
+  "                                   __global float*  neighbour_link_packed,\n"
+  "                                   __global float4* result,\n"
+  "                                   int              nodes\n"
+  "                                  )\n"
+  "{\n"
+  "  int    i = get_global_id (0);\n"
+  "  float4 f = (float4)(0.0f);\n"
+  "  float3 l;\n"
+  "  int    j;\n"
+  "  int    s;\n"
+  "\n"
+  "  if(i >= nodes) return;\n"
+  "\n"
+  "  for(s = (i == 0) ? 0 : neighbour_offset[i - 1]; s < neighbour_offset[i]; s++)\n"
+  "  {\n"
+  "    j  = (neighbour_local[s >> 1] >> ((s & 1) << 4)) & 0xFFFF;\n"
+  "    l  = vload3 (s, neighbour_link_packed);\n"
+  "    f += (float4)(l*length (l), 0.0f) + (float)(j - i);\n"
+  "  }\n"
+  "\n"
+  "  result[i] = f;\n"
+  "}\n";
+
+// Escaping a JSON string:
+static std::string nu_bench_escape (
+                                    std::string loc_text                                            // Text.
+                                   )
+{
+  std::string loc_escaped;                                                                          // Escaped text.
+  size_t      i;                                                                                    // Character index.
+
+  for(i = 0; i < loc_text.size (); i++)
+  {
+    if((loc_text[i] == '"') || (loc_text[i] == '\\'))
+    {
+      loc_escaped += '\\';                                                                          // Escaping character...
+    }
+
+    if((unsigned char)loc_text[i] >= 0x20)
+    {
+      loc_escaped += loc_text[i];                                                                   // Copying character (skipping controls)...
+    }
+  }
+
+  return loc_escaped;                                                                               // Returning escaped text...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "benchmark" class //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::benchmark::benchmark (
+                          nu::opencl* loc_cl,                                                       // OpenCL context.
+                          size_t      loc_repetitions                                               // Number of recorded repetitions per scenario.
+                         )
+{
+  std::ofstream loc_file;                                                                           // Kernel file.
+  size_t        loc_size = (size_t)1 << NU_BENCH_SIZE_MAX;                                          // Data size [#].
+
+  cl          = loc_cl;                                                                             // Setting OpenCL context...
+  repetitions = loc_repetitions;                                                                    // Setting number of repetitions...
+  directory   = (std::filesystem::temp_directory_path () / NU_BENCH_DIRECTORY).string ();           // Setting benchmark files directory...
+  std::filesystem::create_directories (directory);                                                  // Creating benchmark files directory...
+
+  neutrino::action ("allocating benchmark data...");                                                // Printing message...
+  data_int1    = new nu::int1 (0);                                                                  // Allocating "int1" data...
+  data_int2    = new nu::int2 (1);                                                                  // Allocating "int2" data...
+  data_int3    = new nu::int3 (2);                                                                  // Allocating "int3" data...
+  data_int4    = new nu::int4 (3);                                                                  // Allocating "int4" data...
+  data_float1  = new nu::float1 (4);                                                                // Allocating "float1" data...
+  data_float2  = new nu::float2 (5);                                                                // Allocating "float2" data...
+  data_float3  = new nu::float3 (6);                                                                // Allocating "float3" data...
+  data_float4  = new nu::float4 (7);                                                                // Allocating "float4" data...
+  data_float16 = new nu::float16 (8);                                                               // Allocating "float16" data...
+  data_int1->data.resize (loc_size);                                                                // Resizing "int1" data...
+  data_int2->data.resize (loc_size);                                                                // Resizing "int2" data...
+  data_int3->data.resize (loc_size);                                                                // Resizing "int3" data...
+  data_int4->data.resize (loc_size);                                                                // Resizing "int4" data...
+  data_float1->data.resize (loc_size);                                                              // Resizing "float1" data...
+  data_float2->data.resize (loc_size);                                                              // Resizing "float2" data...
+  data_float3->data.resize (loc_size);                                                              // Resizing "float3" data...
+  data_float4->data.resize (loc_size);                                                              // Resizing "float4" data...
+  data_float16->data.resize (loc_size);                                                             // Resizing "float16" data...
+  neutrino::done ();                                                                                // Printing message...
+
+  neutrino::action ("writing benchmark kernel...");                                                 // Printing message...
+  kernel_file = (std::filesystem::path (directory) / NU_BENCH_KERNEL).string ();                    // Setting kernel file name...
+  loc_file.open (kernel_file, std::ios::out | std::ios::trunc);                                     // Opening kernel file...
+
+  if(!loc_file.is_open ())
+  {
+    neutrino::error ("unable to write benchmark kernel " + kernel_file + "!");                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_file << nu_bench_source;                                                                      // Writing kernel source...
+  loc_file.close ();                                                                                // Closing kernel file...
+  neutrino::done ();                                                                                // Printing message...
+
+  bench_kernel = new nu::kernel ();                                                                 // Creating benchmark kernel...
+  bench_kernel->addsource (kernel_file);                                                            // Setting kernel source...
+  bench_kernel->build (1, 0, 0);                                                                    // Building kernel (1 work-item)...
+  cl->execute (bench_kernel, nu::WAIT);                                                             // Executing kernel once (checking it)...
+}
+
+void nu::benchmark::sample (
+                            nu::bench_result& loc_result,                                           // Scenario result.
+                            size_t            loc_run,                                              // Run index (warm-up runs first).
+                            double            loc_start                                             // Run start time [s].
+                           )
+{
+  double loc_time = nu::histogram::clock () - loc_start;                                            // Run time [s].
+
+  if(loc_run >= NU_BENCH_WARMUP)
+  {
+    loc_result.sample.push_back (loc_time);                                                         // Recording time...
+  }
+}
+
+template <typename T>
+void nu::benchmark::transfer (
+                              T*          loc_data,                                                 // Data object.
+                              std::string loc_class                                                 // Data class name.
+                             )
+{
+  size_t           loc_max = loc_data->data.size ();                                                // Data size [#].
+  size_t           loc_size;                                                                        // Transfer size [#].
+  double           loc_start;                                                                       // Run start time [s].
+  nu::bench_result loc_write;                                                                       // Write result.
+  nu::bench_result loc_read;                                                                        // Read result.
+  size_t           r;                                                                               // Run index.
+
+  for(loc_size = (size_t)1 << NU_BENCH_SIZE_MIN; loc_size <= loc_max; loc_size <<= NU_BENCH_SIZE_STEP)
+  {
+    // Transferring the first "loc_size" elements only (the client buffer keeps its size):
+    loc_data->data.resize (loc_size);
+    loc_write = {"write/" + loc_class + "/" + std::to_string (loc_size), "B",
+                 (double)(loc_size*sizeof (loc_data->data[0])), {}};                                // Initializing write result...
+    loc_read  = {"read/" + loc_class + "/" + std::to_string (loc_size), "B",
+                 (double)(loc_size*sizeof (loc_data->data[0])), {}};                                // Initializing read result...
+
+    for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+    {
+      loc_start = nu::histogram::clock ();                                                          // Starting run...
+      cl->opencl_queue->write (loc_data, loc_data->layout);                                         // Writing data...
+      sample (loc_write, r, loc_start);                                                             // Recording time...
+
+      loc_start = nu::histogram::clock ();                                                          // Starting run...
+      cl->opencl_queue->read (loc_data, loc_data->layout);                                          // Reading data...
+      sample (loc_read, r, loc_start);                                                              // Recording time...
+    }
+
+    result.push_back (loc_write);                                                                   // Storing write result...
+    result.push_back (loc_read);                                                                    // Storing read result...
+  }
+
+  loc_data->data.resize (loc_max);                                                                  // Restoring data size...
+}
+
+template <typename T>
+cl_mem nu::benchmark::buffer (
+                              std::vector<T>& loc_data                                              // Host data.
+                             )
+{
+  cl_int loc_error;                                                                                 // Error code.
+  cl_mem loc_buffer;                                                                                // OpenCL buffer.
+
+  loc_buffer = clCreateBuffer (
+                               neutrino::context_id,                                                // OpenCL context.
+                               CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,                             // Memory flags.
+                               sizeof (T)*loc_data.size (),                                         // Data buffer size.
+                               loc_data.data (),                                                    // Data buffer.
+                               &loc_error                                                           // Error code.
+                              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  return loc_buffer;                                                                                // Returning buffer...
+}
+
+void nu::benchmark::transfer ()
+{
+  transfer (data_int1, "int1");                                                                     // Benchmarking "int1" transfers...
+  transfer (data_int2, "int2");                                                                     // Benchmarking "int2" transfers...
+  transfer (data_int3, "int3");                                                                     // Benchmarking "int3" transfers...
+  transfer (data_int4, "int4");                                                                     // Benchmarking "int4" transfers...
+  transfer (data_float1, "float1");                                                                 // Benchmarking "float1" transfers...
+  transfer (data_float2, "float2");                                                                 // Benchmarking "float2" transfers...
+  transfer (data_float3, "float3");                                                                 // Benchmarking "float3" transfers...
+  transfer (data_float4, "float4");                                                                 // Benchmarking "float4" transfers...
+  transfer (data_float16, "float16");                                                               // Benchmarking "float16" transfers...
+}
+
+void nu::benchmark::frame ()
+{
+  nu::bench_result loc_frame;                                                                       // Frame result.
+  double           loc_start;                                                                       // Run start time [s].
+  double           loc_bytes = 0.0;                                                                 // Frame bytes.
+  size_t           r;                                                                               // Run index.
+
+  loc_bytes += (double)(data_int1->data.size ()*sizeof (data_int1->data[0]));                       // Adding "int1" bytes...
+  loc_bytes += (double)(data_int2->data.size ()*sizeof (data_int2->data[0]));                       // Adding "int2" bytes...
+  loc_bytes += (double)(data_int3->data.size ()*sizeof (data_int3->data[0]));                       // Adding "int3" bytes...
+  loc_bytes += (double)(data_int4->data.size ()*sizeof (data_int4->data[0]));                       // Adding "int4" bytes...
+  loc_bytes += (double)(data_float1->data.size ()*sizeof (data_float1->data[0]));                   // Adding "float1" bytes...
+  loc_bytes += (double)(data_float2->data.size ()*sizeof (data_float2->data[0]));                   // Adding "float2" bytes...
+  loc_bytes += (double)(data_float3->data.size ()*sizeof (data_float3->data[0]));                   // Adding "float3" bytes...
+  loc_bytes += (double)(data_float4->data.size ()*sizeof (data_float4->data[0]));                   // Adding "float4" bytes...
+  loc_bytes += (double)(data_float16->data.size ()*sizeof (data_float16->data[0]));                 // Adding "float16" bytes...
+  loc_frame  = {"frame/all", "B", 2.0*loc_bytes, {}};                                               // Initializing frame result (write + read)...
+
+  for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+  {
+    loc_start = nu::histogram::clock ();                                                            // Starting run...
+    cl->write ();                                                                                   // Writing all data...
+    cl->read ();                                                                                    // Reading all data...
+    sample (loc_frame, r, loc_start);                                                               // Recording time...
+  }
+
+  result.push_back (loc_frame);                                                                     // Storing frame result...
+}
+
+void nu::benchmark::launch ()
+{
+  nu::bench_result loc_wait      = {"execute/wait", "launch", 1.0, {}};                             // WAIT mode result.
+  nu::bench_result loc_dont_wait = {"execute/dont_wait", "launch", 1.0, {}};                        // DONT_WAIT mode result.
+  double           loc_start;                                                                       // Run start time [s].
+  size_t           r;                                                                               // Run index.
+
+  for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+  {
+    loc_start = nu::histogram::clock ();                                                            // Starting run...
+    cl->execute (bench_kernel, nu::WAIT);                                                           // Executing kernel (until completion)...
+    sample (loc_wait, r, loc_start);                                                                // Recording time...
+  }
+
+  for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+  {
+    loc_start = nu::histogram::clock ();                                                            // Starting run...
+    cl->execute (bench_kernel, nu::DONT_WAIT);                                                      // Executing kernel (submission only)...
+    sample (loc_dont_wait, r, loc_start);                                                           // Recording time...
+    clFinish (neutrino::queue_id);                                                                  // Waiting for OpenCL to finish (not recorded)...
+  }
+
+  result.push_back (loc_wait);                                                                      // Storing WAIT mode result...
+  result.push_back (loc_dont_wait);                                                                 // Storing DONT_WAIT mode result...
+}
+
+void nu::benchmark::interop ()
+{
+  nu::bench_result loc_acquire = {"interop/acquire", "buffer", (double)container.size (), {}};      // Acquire result.
+  nu::bench_result loc_release = {"interop/release", "buffer", (double)container.size (), {}};      // Release result.
+  double           loc_start;                                                                       // Run start time [s].
+  size_t           r;                                                                               // Run index.
+
+  for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+  {
+    loc_start = nu::histogram::clock ();                                                            // Starting run...
+    cl->acquire ();                                                                                 // Acquiring all data...
+    clFinish (neutrino::queue_id);                                                                  // Waiting for OpenCL to finish...
+    sample (loc_acquire, r, loc_start);                                                             // Recording time...
+
+    loc_start = nu::histogram::clock ();                                                            // Starting run...
+    cl->release ();                                                                                 // Releasing all data...
+    clFinish (neutrino::queue_id);                                                                  // Waiting for OpenCL to finish...
+    sample (loc_release, r, loc_start);                                                             // Recording time...
+  }
+
+  result.push_back (loc_acquire);                                                                   // Storing acquire result...
+  result.push_back (loc_release);                                                                   // Storing release result...
+}
+
+void nu::benchmark::build ()
+{
+  nu::bench_result loc_build = {"kernel/build", "build", 1.0, {}};                                  // Build result.
+  nu::kernel*      loc_kernel;                                                                      // Kernel.
+  double           loc_start;                                                                       // Run start time [s].
+  size_t           r;                                                                               // Run index.
+
+  for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+  {
+    loc_kernel = new nu::kernel ();                                                                 // Creating kernel...
+    loc_kernel->addsource (kernel_file);                                                            // Setting kernel source...
+
+    loc_start  = nu::histogram::clock ();                                                           // Starting run...
+    loc_kernel->build (1, 0, 0);                                                                    // Building kernel...
+    sample (loc_build, r, loc_start);                                                               // Recording time...
+
+    cl->execute (loc_kernel, nu::WAIT);                                                             // Executing kernel (its event is released by the destructor)...
+    delete loc_kernel;                                                                              // Deleting kernel...
+  }
+
+  result.push_back (loc_build);                                                                     // Storing build result...
+}
+
+std::string nu::benchmark::grid (
+                                 size_t loc_side                                                    // Grid side [quadrangles].
+                                )
+{
+  std::ofstream loc_file;                                                                           // MSH file.
+  std::string   loc_file_name;                                                                      // MSH file name.
+  size_t        loc_nodes    = (loc_side + 1)*(loc_side + 1);                                       // Number of nodes.
+  size_t        loc_elements = loc_side*loc_side;                                                   // Number of elements.
+  size_t        loc_node;                                                                           // First node tag of the element.
+  size_t        i;                                                                                  // x-index.
+  size_t        j;                                                                                  // y-index.
+
+  loc_file_name = (std::filesystem::path (directory) /
+                   ("grid_" + std::to_string (loc_side) + ".msh")).string ();                       // Setting MSH file name...
+
+  if(std::filesystem::exists (loc_file_name))
+  {
+    return loc_file_name;                                                                           // Grid already generated...
+  }
+
+  neutrino::action ("generating benchmark mesh...");                                                // Printing message...
+  loc_file.open (loc_file_name, std::ios::out | std::ios::trunc);                                   // Opening MSH file...
+
+  if(!loc_file.is_open ())
+  {
+    neutrino::error ("unable to write benchmark mesh " + loc_file_name + "!");                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_file << "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n";                                             // Writing MSH format...
+  loc_file << "$Entities\n0 0 1 0\n1 0 0 0 " << loc_side << " " << loc_side << " 0 1 " <<
+              NU_BENCH_MESH_TAG << " 0\n$EndEntities\n";                                            // Writing surface entity...
+  loc_file << "$Nodes\n1 " << loc_nodes << " 1 " << loc_nodes << "\n2 1 0 " << loc_nodes << "\n";   // Writing node block header...
+
+  for(i = 0; i < loc_nodes; i++)
+  {
+    loc_file << i + 1 << "\n";                                                                      // Writing node tag...
+  }
+
+  for(j = 0; j <= loc_side; j++)
+  {
+    for(i = 0; i <= loc_side; i++)
+    {
+      loc_file << i << " " << j << " 0\n";                                                          // Writing node coordinates...
+    }
+  }
+
+  loc_file << "$EndNodes\n";                                                                        // Ending nodes...
+  loc_file << "$Elements\n1 " << loc_elements << " 1 " << loc_elements << "\n2 1 " << MSH_QUA_4 <<
+              " " << loc_elements << "\n";                                                          // Writing element block header...
+
+  for(j = 0; j < loc_side; j++)
+  {
+    for(i = 0; i < loc_side; i++)
+    {
+      loc_node = j*(loc_side + 1) + i + 1;                                                          // Computing first node tag...
+      loc_file << j*loc_side + i + 1 << " " << loc_node << " " << loc_node + 1 << " " <<
+                  loc_node + loc_side + 2 << " " << loc_node + loc_side + 1 << "\n";                // Writing quadrangle...
+    }
+  }
+
+  loc_file << "$EndElements\n";                                                                     // Ending elements...
+  loc_file.close ();                                                                                // Closing MSH file...
+  neutrino::done ();                                                                                // Printing message...
+
+  return loc_file_name;                                                                             // Returning MSH file name...
+}
+
+void nu::benchmark::process ()
+{
+  nu::bench_result loc_read;                                                                        // Read result.
+  nu::bench_result loc_process;                                                                     // Process result.
+  nu::mesh*        loc_mesh;                                                                        // Mesh.
+  std::string      loc_file_name;                                                                   // MSH file name.
+  double           loc_start;                                                                       // Run start time [s].
+  size_t           loc_side;                                                                        // Grid side [quadrangles].
+  size_t           r;                                                                               // Run index.
+
+  for(loc_side = NU_BENCH_MESH_MIN; loc_side <= NU_BENCH_MESH_MAX; loc_side *= NU_BENCH_MESH_STEP)
+  {
+    loc_file_name = grid (loc_side);                                                                // Generating grid...
+    loc_read      = {"mesh/read/" + std::to_string (loc_side), "element",
+                     (double)(loc_side*loc_side), {}};                                              // Initializing read result...
+    loc_process   = {"mesh/process/" + std::to_string (loc_side), "element",
+                     (double)(loc_side*loc_side), {}};                                              // Initializing process result...
+
+    for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+    {
+      loc_start = nu::histogram::clock ();                                                          // Starting run...
+      loc_mesh  = new nu::mesh (loc_file_name, nu::NATIVE);                                         // Reading mesh...
+      sample (loc_read, r, loc_start);                                                              // Recording time...
+
+      loc_start = nu::histogram::clock ();                                                          // Starting run...
+      loc_mesh->process (NU_BENCH_MESH_TAG, 2, MSH_QUA_4);                                          // Processing mesh...
+      sample (loc_process, r, loc_start);                                                           // Recording time...
+
+      delete loc_mesh;                                                                              // Deleting mesh...
+    }
+
+    result.push_back (loc_read);                                                                    // Storing read result...
+    result.push_back (loc_process);                                                                 // Storing process result...
+  }
+}
+
+void nu::benchmark::neighbour ()
+{
+  nu::bench_result    loc_result;                                                                   // Neighbour loop result.
+  nu::mesh*           loc_mesh;                                                                     // Mesh.
+  nu::mesh_topology   loc_topology[2] = {nu::FULL, nu::COMPACT_16};                                 // Topology modes.
+  std::string         loc_mode[2]     = {"full", "compact_16"};                                     // Topology mode names.
+  std::string         loc_file_name;                                                                // MSH file name.
+  cl_program          loc_program;                                                                  // Neighbour loop program.
+  cl_kernel           loc_kernel[2];                                                                // Neighbour loop kernels.
+  cl_command_queue    loc_queue = cl->opencl_queue->queue_id;                                       // OpenCL queue.
+  std::vector<cl_mem> loc_buffer;                                                                   // Neighbour array buffers.
+  cl_mem              loc_output;                                                                   // Per-node result buffer.
+  cl_int              loc_error;                                                                    // Error code.
+  cl_int              loc_nodes;                                                                    // Number of nodes.
+  size_t              loc_global;                                                                   // Global work size.
+  double              loc_start;                                                                    // Run start time [s].
+  size_t              loc_side;                                                                     // Grid side [quadrangles].
+  size_t              t;                                                                            // Topology index.
+  size_t              a;                                                                            // Argument index.
+  size_t              r;                                                                            // Run index.
+
+  // Building neighbour loop program:
+  neutrino::action ("building neighbour benchmark kernels...");                                     // Printing message...
+  loc_program   = clCreateProgramWithSource (
+                                             neutrino::context_id,                                  // OpenCL context.
+                                             1,                                                     // Number of sources.
+                                             &nu_bench_neighbour_source,                            // Sources.
+                                             NULL,                                                  // Source lengths.
+                                             &loc_error                                             // Error code.
+                                            );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_error     = clBuildProgram (loc_program, 1, &neutrino::device_id, "", NULL, NULL);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_kernel[0] = clCreateKernel (loc_program, "nu_bench_full", &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_kernel[1] = clCreateKernel (loc_program, "nu_bench_compact_16", &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  neutrino::done ();                                                                                // Printing message...
+
+  for(loc_side = NU_BENCH_MESH_MIN; loc_side <= NU_BENCH_MESH_MAX; loc_side *= NU_BENCH_MESH_STEP)
+  {
+    loc_file_name = grid (loc_side);                                                                // Generating grid...
+
+    for(t = 0; t < 2; t++)
+    {
+      loc_mesh   = new nu::mesh (loc_file_name, nu::NATIVE);                                        // Reading mesh...
+      loc_mesh->set_topology (loc_topology[t], true);                                               // Setting topology mode (with links)...
+      loc_mesh->process (NU_BENCH_MESH_TAG, 2, MSH_QUA_4);                                          // Processing mesh...
+      loc_nodes  = (cl_int)loc_mesh->node.size ();                                                  // Getting number of nodes...
+      loc_result = {"neighbour/" + loc_mode[t] + "/" + std::to_string (loc_side), "B",
+                    (double)loc_mesh->neighbour_bytes (), {}};                                      // Initializing result...
+
+      // Uploading neighbour arrays:
+      loc_buffer.clear ();                                                                          // Clearing buffers...
+      loc_buffer.push_back (buffer (loc_mesh->neighbour_offset));                                   // Uploading neighbour offsets...
+
+      if(loc_topology[t] == nu::FULL)
+      {
+        loc_buffer.push_back (buffer (loc_mesh->neighbour));                                        // Uploading neighbour indices...
+        loc_buffer.push_back (buffer (loc_mesh->neighbour_center));                                 // Uploading neighbour centers...
+        loc_buffer.push_back (buffer (loc_mesh->neighbour_link));                                   // Uploading neighbour links...
+        loc_buffer.push_back (buffer (loc_mesh->neighbour_length));                                 // Uploading neighbour lengths...
+      }
+      else
+      {
+        loc_buffer.push_back (buffer (loc_mesh->neighbour_local));                                  // Uploading neighbour local indices...
+        loc_buffer.push_back (buffer (loc_mesh->neighbour_link_packed));                            // Uploading packed neighbour links...
+      }
+
+      loc_output = clCreateBuffer (
+                                   neutrino::context_id,                                            // OpenCL context.
+                                   CL_MEM_WRITE_ONLY,                                               // Memory flag.
+                                   sizeof (cl_float)*4*loc_nodes,                                   // Data buffer size.
+                                   NULL,                                                            // Data buffer.
+                                   &loc_error                                                       // Error code.
+                                  );
+      neutrino::check_error (loc_error);                                                            // Checking error...
+
+      // Setting kernel arguments:
+      loc_error = CL_SUCCESS;                                                                       // Resetting error code...
+
+      for(a = 0; a < loc_buffer.size (); a++)
+      {
+        loc_error |= clSetKernelArg (loc_kernel[t], (cl_uint)a, sizeof (cl_mem), &loc_buffer[a]);
+      }
+
+      loc_error |= clSetKernelArg (loc_kernel[t], (cl_uint)a, sizeof (cl_mem), &loc_output);
+      loc_error |= clSetKernelArg (loc_kernel[t], (cl_uint)a + 1, sizeof (cl_int), &loc_nodes);
+      neutrino::check_error (loc_error);                                                            // Checking error...
+      loc_global = loc_nodes;                                                                       // Setting global work size...
+
+      for(r = 0; r < NU_BENCH_WARMUP + repetitions; r++)
+      {
+        loc_start = nu::histogram::clock ();                                                        // Starting run...
+        loc_error = clEnqueueNDRangeKernel (loc_queue, loc_kernel[t], 1, NULL, &loc_global, NULL, 0, NULL, NULL);
+        neutrino::check_error (loc_error);                                                          // Checking error...
+        clFinish (loc_queue);                                                                       // Waiting for OpenCL to finish...
+        sample (loc_result, r, loc_start);                                                          // Recording time...
+      }
+
+      result.push_back (loc_result);                                                                // Storing result...
+
+      for(a = 0; a < loc_buffer.size (); a++)
+      {
+        clReleaseMemObject (loc_buffer[a]);                                                         // Releasing neighbour array buffer...
+      }
+
+      clReleaseMemObject (loc_output);                                                              // Releasing result buffer...
+      delete loc_mesh;                                                                              // Deleting mesh...
+    }
+  }
+
+  clReleaseKernel (loc_kernel[0]);                                                                  // Releasing "full" kernel...
+  clReleaseKernel (loc_kernel[1]);                                                                  // Releasing "compact_16" kernel...
+  clReleaseProgram (loc_program);                                                                   // Releasing program...
+}
+
+void nu::benchmark::write (
+                           std::string loc_file_name                                                // JSON file name.
+                          )
+{
+  std::ofstream loc_file;                                                                           // JSON file.
+  double        loc_median;                                                                         // Median time [s].
+  size_t        i;                                                                                  // Result index.
+  size_t        j;                                                                                  // Sample index.
+
+  neutrino::action ("writing benchmark results...");                                                // Printing message...
+  loc_file.open (loc_file_name, std::ios::out | std::ios::trunc);                                   // Opening JSON file...
+
+  if(!loc_file.is_open ())
+  {
+    neutrino::error ("unable to open benchmark file " + loc_file_name + "!");                       // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_file << std::scientific << std::setprecision (6);                                             // Setting time format [s]...
+  loc_file << "{\n\"format\":" << NU_BENCH_FORMAT << ",\n";                                         // Writing format version...
+  loc_file << "\"platform\":\"" <<
+              nu_bench_escape (cl->opencl_platform[cl->selected_platform]->name) << "\",\n";        // Writing platform name...
+  loc_file << "\"device\":\"" <<
+              nu_bench_escape (cl->opencl_device[cl->selected_device]->name) << "\",\n";            // Writing device name...
+  loc_file << "\"interop\":" << (neutrino::interop ? "true" : "false") << ",\n";                    // Writing interoperability flag...
+  loc_file << "\"repetitions\":" << repetitions << ",\n";                                           // Writing number of repetitions...
+  loc_file << "\"results\":[";                                                                      // Writing results header...
+
+  for(i = 0; i < result.size (); i++)
+  {
+    loc_median = percentile (result[i].sample, 50.0);                                               // Computing median...
+
+    loc_file << ((i == 0) ? "\n" : ",\n") <<
+                "{\"name\":\"" << result[i].name << "\",\"unit\":\"" << result[i].unit <<
+                "\",\"work\":" << result[i].work <<
+                ",\"median\":" << loc_median <<
+                ",\"min\":" << percentile (result[i].sample, 0.0) <<
+                ",\"p90\":" << percentile (result[i].sample, 90.0) <<
+                ",\"throughput\":" << ((loc_median > 0.0) ? result[i].work/loc_median : 0.0) <<
+                ",\"samples\":[";                                                                   // Writing result...
+
+    for(j = 0; j < result[i].sample.size (); j++)
+    {
+      loc_file << ((j == 0) ? "" : ",") << result[i].sample[j];                                     // Writing recorded time...
+    }
+
+    loc_file << "]}";                                                                               // Ending result...
+  }
+
+  loc_file << "\n]\n}\n";                                                                           // Writing footer...
+  loc_file.close ();                                                                                // Closing JSON file...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+double nu::benchmark::percentile (
+                                  std::vector<double> loc_sample,                                   // Times [s].
+                                  double              loc_percentile                                // Percentile [0...100].
+                                 )
+{
+  double loc_rank;                                                                                  // Fractional rank.
+  size_t loc_low;                                                                                   // Lower rank.
+  size_t loc_high;                                                                                  // Upper rank.
+
+  if(loc_sample.empty ())
+  {
+    return 0.0;                                                                                     // No samples...
+  }
+
+  std::sort (loc_sample.begin (), loc_sample.end ());                                               // Sorting times...
+  loc_percentile = std::min (std::max (loc_percentile, 0.0), 100.0);                                // Constraining percentile...
+  loc_rank       = loc_percentile/100.0*(double)(loc_sample.size () - 1);                           // Computing fractional rank...
+  loc_low        = (size_t)floor (loc_rank);                                                        // Computing lower rank...
+  loc_high       = (size_t)ceil (loc_rank);                                                         // Computing upper rank...
+
+  return loc_sample[loc_low] + (loc_rank - (double)loc_low)*(loc_sample[loc_high] -
+                                                             loc_sample[loc_low]);                  // Returning interpolated percentile...
+}
+
+size_t nu::benchmark::find (
+                            std::string& loc_text,                                                  // JSON text.
+                            std::string  loc_key,                                                   // JSON key (with delimiters).
+                            size_t       loc_position                                               // Search start position.
+                           )
+{
+  loc_position = loc_text.find (loc_key, loc_position);                                             // Finding key...
+
+  if(loc_position == std::string::npos)
+  {
+    neutrino::error ("invalid benchmark file: missing " + loc_key + "!");                           // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  return loc_position + loc_key.size ();                                                            // Returning value position...
+}
+
+std::vector<nu::bench_result> nu::benchmark::load (
+                                                   std::string loc_file_name                        // JSON file name.
+                                                  )
+{
+  std::vector<nu::bench_result> loc_result;                                                         // Results.
+  nu::bench_result              loc_entry;                                                          // Result.
+  std::ifstream                 loc_file;                                                           // JSON file.
+  std::stringstream             loc_buffer;                                                         // JSON file buffer.
+  std::string                   loc_text;                                                           // JSON text.
+  size_t                        loc_position = 0;                                                   // Text position.
+  size_t                        loc_end;                                                            // String end position.
+  char*                         loc_next;                                                           // Next number position.
+
+  loc_file.open (loc_file_name, std::ios::in);                                                      // Opening JSON file...
+
+  if(!loc_file.is_open ())
+  {
+    neutrino::error ("unable to open benchmark file " + loc_file_name + "!");                       // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_buffer << loc_file.rdbuf ();                                                                  // Reading JSON file...
+  loc_text = loc_buffer.str ();                                                                     // Getting JSON text...
+  loc_file.close ();                                                                                // Closing JSON file...
+
+  // Reading results:
+  while((loc_position = loc_text.find ("{\"name\":\"", loc_position)) != std::string::npos)
+  {
+    loc_position   = find (loc_text, "{\"name\":\"", loc_position);                                 // Finding name...
+    loc_end        = find (loc_text, "\"", loc_position) - 1;                                       // Finding name end...
+    loc_entry.name = loc_text.substr (loc_position, loc_end - loc_position);                        // Reading name...
+    loc_position   = find (loc_text, "\"unit\":\"", loc_end);                                       // Finding unit...
+    loc_end        = find (loc_text, "\"", loc_position) - 1;                                       // Finding unit end...
+    loc_entry.unit = loc_text.substr (loc_position, loc_end - loc_position);                        // Reading unit...
+    loc_position   = find (loc_text, "\"work\":", loc_end);                                         // Finding work...
+    loc_entry.work = strtod (loc_text.c_str () + loc_position, NULL);                               // Reading work...
+    loc_position   = find (loc_text, "\"samples\":[", loc_position);                                // Finding recorded times...
+    loc_entry.sample.clear ();                                                                      // Clearing recorded times...
+
+    while((loc_position < loc_text.size ()) && (loc_text[loc_position] != ']'))
+    {
+      loc_entry.sample.push_back (strtod (loc_text.c_str () + loc_position, &loc_next));            // Reading recorded time...
+
+      if(loc_next == loc_text.c_str () + loc_position)
+      {
+        neutrino::error ("invalid benchmark file: bad time in " + loc_entry.name + "!");            // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      loc_position = (size_t)(loc_next - loc_text.c_str ());                                        // Skipping number...
+
+      if(loc_text[loc_position] == ',')
+      {
+        loc_position++;                                                                             // Skipping separator...
+      }
+    }
+
+    loc_result.push_back (loc_entry);                                                               // Storing result...
+  }
+
+  return loc_result;                                                                                // Returning results...
+}
+
+double nu::benchmark::mann_whitney (
+                                    std::vector<double> loc_baseline,                               // Baseline times [s].
+                                    std::vector<double> loc_current                                 // Current times [s].
+                                   )
+{
+  std::vector<std::pair<double, int> > loc_all;                                                     // All times (0 = baseline, 1 = current).
+  double                               loc_n1   = (double)loc_baseline.size ();                     // Number of baseline times.
+  double                               loc_n2   = (double)loc_current.size ();                      // Number of current times.
+  double                               loc_n    = loc_n1 + loc_n2;                                  // Total number of times.
+  double                               loc_rank;                                                    // Average rank of a tie group.
+  double                               loc_sum  = 0.0;                                              // Rank sum of the current times.
+  double                               loc_ties = 0.0;                                              // Tie correction (sum of t^3 - t).
+  double                               loc_u;                                                       // U statistic of the current times.
+  double                               loc_variance;                                                // U statistic variance.
+  size_t                               i;                                                           // Tie group begin.
+  size_t                               j;                                                           // Tie group end.
+  size_t                               k;                                                           // Time index.
+
+  if((loc_baseline.size () == 0) || (loc_current.size () == 0))
+  {
+    return 1.0;                                                                                     // No evidence...
+  }
+
+  for(k = 0; k < loc_baseline.size (); k++)
+  {
+    loc_all.push_back (std::make_pair (loc_baseline[k], 0));                                        // Adding baseline time...
+  }
+
+  for(k = 0; k < loc_current.size (); k++)
+  {
+    loc_all.push_back (std::make_pair (loc_current[k], 1));                                         // Adding current time...
+  }
+
+  std::sort (loc_all.begin (), loc_all.end ());                                                     // Sorting all times...
+
+  // Ranking tie groups:
+  for(i = 0; i < loc_all.size (); i = j)
+  {
+    for(j = i; (j < loc_all.size ()) && (loc_all[j].first == loc_all[i].first); j++)
+    {
+      // Finding tie group end...
+    }
+
+    loc_rank  = 0.5*(double)(i + 1 + j);                                                            // Computing average rank (i + 1...j)...
+    loc_ties += pow ((double)(j - i), 3.0) - (double)(j - i);                                       // Accumulating tie correction...
+
+    for(k = i; k < j; k++)
+    {
+      loc_sum += (loc_all[k].second == 1) ? loc_rank : 0.0;                                         // Summing current ranks...
+    }
+  }
+
+  loc_u        = loc_sum - 0.5*loc_n2*(loc_n2 + 1.0);                                               // Computing U statistic...
+  loc_variance = loc_n1*loc_n2/12.0*((loc_n + 1.0) - loc_ties/(loc_n*(loc_n - 1.0)));               // Computing U variance...
+
+  if(loc_variance <= 0.0)
+  {
+    return 1.0;                                                                                     // All times equal...
+  }
+
+  return 0.5*erfc ((loc_u - 0.5*loc_n1*loc_n2 - 0.5)/sqrt (2.0*loc_variance));                      // Returning one-sided p-value...
+}
+
+bool nu::benchmark::compare (
+                             std::vector<nu::bench_result> loc_baseline,                            // Baseline results.
+                             std::vector<nu::bench_result> loc_current,                             // Current results.
+                             double                        loc_threshold                            // Regression threshold [%].
+                            )
+{
+  bool        loc_regression = false;                                                               // Regression flag.
+  size_t      loc_count      = 0;                                                                   // Number of regressions.
+  double      loc_old;                                                                              // Baseline median [s].
+  double      loc_new;                                                                              // Current median [s].
+  double      loc_change;                                                                           // Median change [%].
+  double      loc_p;                                                                                // Slower p-value.
+  std::string loc_verdict;                                                                          // Verdict.
+  size_t      i;                                                                                    // Current result index.
+  size_t      j;                                                                                    // Baseline result index.
+
+  printf ("\n%-28s %14s %14s %10s %10s  %s\n", "scenario", "baseline [us]", "current [us]",
+          "change [%]", "p-value", "verdict");                                                      // Printing header...
+
+  for(i = 0; i < loc_current.size (); i++)
+  {
+    for(j = 0; (j < loc_baseline.size ()) && (loc_baseline[j].name != loc_current[i].name); j++)
+    {
+      // Finding baseline result...
+    }
+
+    if(j == loc_baseline.size ())
+    {
+      printf ("%-28s %14s %14.3f %10s %10s  %s\n", loc_current[i].name.c_str (), "-",
+              1.0E6*percentile (loc_current[i].sample, 50.0), "-", "-", "new");                     // Printing new result...
+      continue;
+    }
+
+    loc_old    = percentile (loc_baseline[j].sample, 50.0);                                         // Computing baseline median...
+    loc_new    = percentile (loc_current[i].sample, 50.0);                                          // Computing current median...
+    loc_change = (loc_old > 0.0) ? 100.0*(loc_new/loc_old - 1.0) : 0.0;                             // Computing median change...
+    loc_p      = mann_whitney (loc_baseline[j].sample, loc_current[i].sample);                      // Testing slower times...
+
+    if((loc_change > loc_threshold) && (loc_p < NU_BENCH_ALPHA))
+    {
+      loc_verdict    = NU_COLOR_RED "REGRESSION" NU_COLOR_NORMAL;                                   // Setting verdict...
+      loc_regression = true;                                                                        // Setting regression flag...
+      loc_count++;                                                                                  // Counting regression...
+    }
+    else if((loc_change < -loc_threshold) &&
+            (mann_whitney (loc_current[i].sample, loc_baseline[j].sample) < NU_BENCH_ALPHA))
+    {
+      loc_verdict = NU_COLOR_GREEN "improved" NU_COLOR_NORMAL;                                      // Setting verdict...
+    }
+    else
+    {
+      loc_verdict = "ok";                                                                           // Setting verdict...
+    }
+
+    printf ("%-28s %14.3f %14.3f %+10.1f %10.2e  %s\n", loc_current[i].name.c_str (), 1.0E6*loc_old,
+            1.0E6*loc_new, loc_change, loc_p, loc_verdict.c_str ());                                // Printing result...
+  }
+
+  printf ("\n%zu regression(s) beyond %.1f%% (Mann-Whitney, alpha = %g).\n", loc_count,
+          loc_threshold, NU_BENCH_ALPHA);                                                           // Printing summary...
+
+  return loc_regression;                                                                            // Returning regression flag...
+}
+
+nu::benchmark::~benchmark ()
+{
+  delete bench_kernel;                                                                              // Deleting benchmark kernel...
+}
@@ -0,0 +1,226 @@
+/// @file     bench.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "benchmark" class (core paths benchmark suite).
+///
+/// @details  The @link benchmark @endlink class measures the core paths of Neutrino under
+/// controlled sizes: the host<->client bandwidth of @link queue::read @endlink and @link
+/// queue::write @endlink for each data class, the launch latency of @link opencl::execute
+/// @endlink, the overhead of @link opencl::acquire @endlink and @link opencl::release @endlink,
+/// the @link kernel::build @endlink time, the throughput of @link mesh::process @endlink on
+/// generated meshes and the bandwidth of a neighbour loop kernel in FULL and COMPACT_16
+/// topology. Each scenario is run NU_BENCH_WARMUP times (not recorded), then a given number of
+/// repetitions: all the recorded times are written to a JSON file, together with their median
+/// and throughput, so that regressions can be tracked between releases. Two result sets (e.g. a
+/// stored baseline and a rerun) can be compared by means of @link compare @endlink, which
+/// applies a Mann-Whitney U test to the recorded times of each scenario.
+///
+/// The benchmark only needs an OpenGL context and an OpenCL device: it can run headless, by
+/// means of an OFFSCREEN @link opengl @endlink context (e.g. Mesa llvmpipe) and a CPU OpenCL
+/// platform (e.g. PoCL). Notice that some OpenCL platforms cache the compiled programs on disk
+/// (e.g. PoCL, unless POCL_KERNEL_CACHE=0): in that case, the kernel build time is the time
+/// of a cached build.
+
+#ifndef bench_hpp
+#define bench_hpp
+
+#include "nu.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// BENCHMARK PARAMETERS ///////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_BENCH_FORMAT           1                                                                 ///< Benchmark JSON file format version.
+#define NU_BENCH_FILE             "nu_bench.json"                                                   ///< Default benchmark JSON file name.
+#define NU_BENCH_DIRECTORY        "neutrino_bench"                                                  ///< Benchmark files directory (in the system temporary directory).
+#define NU_BENCH_KERNEL           "nu_bench.cl"                                                     ///< Benchmark OpenCL kernel file name.
+#define NU_BENCH_WINDOW           64                                                                ///< Benchmark offscreen framebuffer size [px].
+#define NU_BENCH_REPETITIONS      20                                                                ///< Default number of recorded repetitions per scenario.
+#define NU_BENCH_WARMUP           2                                                                 ///< Number of warm-up runs per scenario (not recorded).
+#define NU_BENCH_SIZE_MIN         10                                                                ///< Minimum transfer size (log2 of number of elements).
+#define NU_BENCH_SIZE_MAX         18                                                                ///< Maximum transfer size (log2 of number of elements).
+#define NU_BENCH_SIZE_STEP        4                                                                 ///< Transfer size step (log2 of size ratio).
+#define NU_BENCH_MESH_MIN         16                                                                ///< Minimum generated mesh side [quadrangles].
+#define NU_BENCH_MESH_MAX         1024                                                              ///< Maximum generated mesh side [quadrangles].
+#define NU_BENCH_MESH_STEP        2                                                                 ///< Generated mesh side ratio.
+#define NU_BENCH_MESH_TAG         1                                                                 ///< Generated mesh physical group tag.
+#define NU_BENCH_BASELINE         "nu_perf_baseline.json"                                           ///< Default regression baseline JSON file name.
+#define NU_BENCH_THRESHOLD        10.0                                                              ///< Default regression threshold (median time increase) [%].
+#define NU_BENCH_ALPHA            0.01                                                              ///< Regression significance level (one-sided Mann-Whitney U test).
+
+namespace nu
+{
+/// @brief    **Data structure. Benchmark result.**
+/// @details  This structure holds the recorded times of a benchmark scenario. The "work" is the
+/// amount of work done by a single run (e.g. the transferred bytes), in "unit", so that the
+/// throughput is work/time.
+typedef struct _bench_result
+{
+  std::string         name;                                                                         ///< Scenario name (path/variant/size).
+  std::string         unit;                                                                         ///< Work unit.
+  double              work;                                                                         ///< Work per run [unit].
+  std::vector<double> sample;                                                                       ///< Recorded times [s].
+} bench_result;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "benchmark" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class benchmark
+/// ### Benchmark suite.
+/// Declares a benchmark suite for the core paths of Neutrino.
+/// To be constructed after the @link opengl @endlink and @link opencl @endlink objects.
+class benchmark : public neutrino                                                                   /// @brief **Benchmark suite.**
+{
+private:
+  nu::opencl*  cl;                                                                                  ///< @brief **OpenCL context.**
+  size_t       repetitions;                                                                         ///< @brief **Number of recorded repetitions per scenario.**
+  std::string  directory;                                                                           ///< @brief **Benchmark files directory.**
+  std::string  kernel_file;                                                                         ///< @brief **Benchmark OpenCL kernel file name.**
+  nu::kernel*  bench_kernel;                                                                        ///< @brief **Benchmark OpenCL kernel.**
+  nu::int1*    data_int1;                                                                           ///< @brief **"int1" data (kernel argument 0).**
+  nu::int2*    data_int2;                                                                           ///< @brief **"int2" data (kernel argument 1).**
+  nu::int3*    data_int3;                                                                           ///< @brief **"int3" data (kernel argument 2).**
+  nu::int4*    data_int4;                                                                           ///< @brief **"int4" data (kernel argument 3).**
+  nu::float1*  data_float1;                                                                         ///< @brief **"float1" data (kernel argument 4).**
+  nu::float2*  data_float2;                                                                         ///< @brief **"float2" data (kernel argument 5).**
+  nu::float3*  data_float3;                                                                         ///< @brief **"float3" data (kernel argument 6).**
+  nu::float4*  data_float4;                                                                         ///< @brief **"float4" data (kernel argument 7).**
+  nu::float16* data_float16;                                                                        ///< @brief **"float16" data (kernel argument 8).**
+
+  /// @brief **Sample function.**
+  /// @details Records the time elapsed since "loc_start", unless the run is a warm-up run.
+  void                 sample (
+                               nu::bench_result& loc_result,                                        ///< Scenario result.
+                               size_t            loc_run,                                           ///< Run index (warm-up runs first).
+                               double            loc_start                                          ///< Run start time [s].
+                              );
+
+  /// @brief **Data class transfer benchmark.**
+  /// @details Measures the write and read times of the first 2^n elements of a data object,
+  /// from 2^NU_BENCH_SIZE_MIN to its whole size.
+  template <typename T>
+  void                 transfer (
+                                 T*          loc_data,                                              ///< Data object.
+                                 std::string loc_class                                              ///< Data class name.
+                                );
+
+  /// @brief **Read-only buffer function.**
+  /// @details Creates a read-only OpenCL buffer, initialized with a copy of a host vector.
+  template <typename T>
+  cl_mem               buffer (
+                               std::vector<T>& loc_data                                             ///< Host data.
+                              );
+
+  /// @brief **JSON key finder.**
+  /// @details Returns the position of the value following a key in a JSON text, from a given
+  /// position. It exits if the key is missing.
+  size_t               find (
+                             std::string& loc_text,                                                 ///< JSON text.
+                             std::string  loc_key,                                                  ///< JSON key (with delimiters).
+                             size_t       loc_position                                              ///< Search start position.
+                            );
+
+  /// @brief **Mesh generator.**
+  /// @details Writes a MSH 4.1 (ASCII) file of a square grid of "loc_side" x "loc_side"
+  /// quadrangles, in the NU_BENCH_MESH_TAG physical surface, and returns its file name.
+  std::string          grid (
+                             size_t loc_side                                                        ///< Grid side [quadrangles].
+                            );
+
+public:
+  std::vector<bench_result> result;                                                                 ///< @brief **Benchmark results.**
+
+  /// @brief **Class constructor.**
+  /// @details Allocates one data object per data class (2^NU_BENCH_SIZE_MAX elements each),
+  /// writes the benchmark kernel file and builds the benchmark kernel (1 work-item).
+  benchmark (
+             nu::opencl* loc_cl,                                                                    ///< OpenCL context.
+             size_t      loc_repetitions                                                            ///< Number of recorded repetitions per scenario.
+            );
+
+  /// @brief **Transfer benchmark.**
+  /// @details Measures the host<->client bandwidth of each data class ("write/class/size" and
+  /// "read/class/size" scenarios).
+  void                 transfer ();
+
+  /// @brief **Frame transfer benchmark.**
+  /// @details Measures the time of a whole frame transfer, i.e. a write and a read of all the
+  /// data objects ("frame/all" scenario).
+  void                 frame ();
+
+  /// @brief **Launch benchmark.**
+  /// @details Measures the launch latency of the 1 work-item benchmark kernel, both in WAIT
+  /// mode ("execute/wait" scenario, until completion) and in DONT_WAIT mode ("execute/dont_wait"
+  /// scenario, submission only).
+  void                 launch ();
+
+  /// @brief **Interoperability benchmark.**
+  /// @details Measures the overhead of acquiring and releasing all the data objects, until
+  /// completion ("interop/acquire" and "interop/release" scenarios).
+  void                 interop ();
+
+  /// @brief **Kernel build benchmark.**
+  /// @details Measures the build time of the benchmark kernel ("kernel/build" scenario).
+  void                 build ();
+
+  /// @brief **Mesh benchmark.**
+  /// @details Measures the native reading time ("mesh/read/side" scenarios) and the processing
+  /// time ("mesh/process/side" scenarios) of generated square grids, from NU_BENCH_MESH_MIN to
+  /// NU_BENCH_MESH_MAX quadrangles per side.
+  void                 process ();
+
+  /// @brief **Neighbour loop benchmark.**
+  /// @details Measures the time of a kernel looping over all the neighbours of all the nodes of
+  /// the generated square grids, both in FULL ("neighbour/full/side" scenarios) and in COMPACT_16
+  /// ("neighbour/compact_16/side" scenarios) topology mode, with links. The work is the size of
+  /// the neighbour arrays (see @link mesh::neighbour_bytes @endlink): the throughput is the
+  /// effective bandwidth of the neighbour loop.
+  void                 neighbour ();
+
+  /// @brief **JSON writer.**
+  /// @details Writes the platform, the device and all the results (median, minimum, 90th
+  /// percentile, throughput and recorded times) to a JSON file.
+  void                 write (
+                              std::string loc_file_name                                             ///< JSON file name.
+                             );
+
+  /// @brief **Percentile function.**
+  /// @details Returns a percentile [0...100] of a set of times, by linear interpolation between
+  /// the closest ranks.
+  static double        percentile (
+                                   std::vector<double> loc_sample,                                  ///< Times [s].
+                                   double              loc_percentile                               ///< Percentile [0...100].
+                                  );
+
+  /// @brief **JSON reader.**
+  /// @details Reads the results (names, units, work and recorded times) of a JSON file written
+  /// by @link write @endlink.
+  std::vector<bench_result> load (
+                                  std::string loc_file_name                                         ///< JSON file name.
+                                 );
+
+  /// @brief **Mann-Whitney U test.**
+  /// @details Returns the one-sided p-value of the hypothesis that the "loc_current" times are
+  /// stochastically greater than the "loc_baseline" times (normal approximation, with tie and
+  /// continuity corrections). No assumption is made on the distribution of the times.
+  static double        mann_whitney (
+                                     std::vector<double> loc_baseline,                              ///< Baseline times [s].
+                                     std::vector<double> loc_current                                ///< Current times [s].
+                                    );
+
+  /// @brief **Regression report function.**
+  /// @details Compares each current result to the baseline result of the same name and prints
+  /// a report. A result regresses when its median time increases by more than "loc_threshold"
+  /// percent and the increase is significant (Mann-Whitney p-value < NU_BENCH_ALPHA). Returns
+  /// true if any result regresses.
+  static bool          compare (
+                                std::vector<bench_result> loc_baseline,                             ///< Baseline results.
+                                std::vector<bench_result> loc_current,                              ///< Current results.
+                                double                    loc_threshold                             ///< Regression threshold [%].
+                               );
+
+  /// @brief **Class destructor.**
+  /// @details Deletes the benchmark kernel.
+  ~benchmark ();
+};
+}
+#endif
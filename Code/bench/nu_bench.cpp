@@ -0,0 +1,78 @@
+/// @file     nu_bench.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Neutrino benchmark executable.
+///
+/// @details  Runs the whole @link benchmark @endlink suite on an OFFSCREEN OpenGL context and
+/// writes the results to a JSON file. Usage:
+///
+/// nu_bench [JSON file name] [repetitions] [cpu | gpu]
+///
+/// The defaults are NU_BENCH_FILE, NU_BENCH_REPETITIONS and "cpu". In order to run headless on
+/// a machine without a GPU, use Mesa (e.g. LIBGL_ALWAYS_SOFTWARE=1) together with a CPU OpenCL
+/// platform (e.g. PoCL). If more than one OpenCL platform is found, the platform is asked on
+/// the terminal: restrict the OpenCL ICD loader to a single platform in unattended runs (e.g. by
+/// means of OCL_ICD_VENDORS).
+
+#include "bench.hpp"
+
+int main (
+          int   argc,                                                                               // Number of arguments.
+          char* argv[]                                                                              // Arguments.
+         )
+{
+  std::string             loc_file_name   = NU_BENCH_FILE;                                          // JSON file name.
+  size_t                  loc_repetitions = NU_BENCH_REPETITIONS;                                   // Number of repetitions.
+  nu::compute_device_type loc_device      = nu::CPU;                                                // OpenCL device type.
+  nu::opengl*             gui;                                                                      // OpenGL context.
+  nu::opencl*             cl;                                                                       // OpenCL context.
+  nu::benchmark*          bench;                                                                    // Benchmark suite.
+  size_t                  i;                                                                        // Result index.
+
+  if(argc > 1)
+  {
+    loc_file_name = argv[1];                                                                        // Setting JSON file name...
+  }
+
+  if(argc > 2)
+  {
+    loc_repetitions = (size_t)std::max (atoi (argv[2]), 1);                                         // Setting number of repetitions...
+  }
+
+  if((argc > 3) && (std::string (argv[3]) == "gpu"))
+  {
+    loc_device = nu::GPU;                                                                           // Setting GPU device...
+  }
+
+  gui   = new nu::opengl ("nu_bench", NU_BENCH_WINDOW, NU_BENCH_WINDOW, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                          nu::OFFSCREEN);                                                           // Creating offscreen OpenGL context...
+  cl    = new nu::opencl (loc_device);                                                              // Creating OpenCL context...
+  bench = new nu::benchmark (cl, loc_repetitions);                                                  // Creating benchmark suite...
+
+  bench->transfer ();                                                                               // Benchmarking transfers...
+  bench->frame ();                                                                                  // Benchmarking frame transfer...
+  bench->launch ();                                                                                 // Benchmarking kernel launch...
+  bench->interop ();                                                                                // Benchmarking interoperability...
+  bench->build ();                                                                                  // Benchmarking kernel build...
+  bench->process ();                                                                                // Benchmarking mesh processing...
+  bench->neighbour ();                                                                              // Benchmarking neighbour loop...
+  bench->write (loc_file_name);                                                                     // Writing results...
+
+  // Printing summary:
+  printf ("\n%-28s %14s %14s %20s\n", "scenario", "median [us]", "p90 [us]", "throughput [unit/s]");
+
+  for(i = 0; i < bench->result.size (); i++)
+  {
+    printf ("%-28s %14.3f %14.3f %14.4e %-8s\n", bench->result[i].name.c_str (),
+            1.0E6*nu::benchmark::percentile (bench->result[i].sample, 50.0),
+            1.0E6*nu::benchmark::percentile (bench->result[i].sample, 90.0),
+            bench->result[i].work/nu::benchmark::percentile (bench->result[i].sample, 50.0),
+            bench->result[i].unit.c_str ());                                                        // Printing result...
+  }
+
+  delete bench;                                                                                     // Deleting benchmark suite...
+  delete cl;                                                                                        // Deleting OpenCL context...
+  delete gui;                                                                                       // Deleting OpenGL context...
+
+  return 0;
+}
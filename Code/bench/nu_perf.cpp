@@ -0,0 +1,97 @@
+/// @file     nu_perf.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Neutrino performance regression gate.
+///
+/// @details  Runs a small set of timed @link benchmark @endlink scenarios: the whole frame
+/// transfer ("frame/all"), the kernel build ("kernel/build") and the mesh reading and
+/// processing ("mesh/read/side", "mesh/process/side"). Usage:
+///
+/// nu_perf record  [baseline JSON file] [repetitions] [cpu | gpu]
+/// nu_perf compare [baseline JSON file] [repetitions] [threshold %] [cpu | gpu]
+///
+/// The "record" mode stores the scenario times in the baseline file (the same format as the
+/// nu_bench JSON file, which can be used as a baseline as well). The "compare" mode reruns the
+/// scenarios, compares them to the baseline by means of a one-sided Mann-Whitney U test and
+/// prints a report: it exits with EXIT_FAILURE if any median time increases by more than the
+/// threshold, with a p-value below NU_BENCH_ALPHA. The defaults are NU_BENCH_BASELINE,
+/// NU_BENCH_REPETITIONS, NU_BENCH_THRESHOLD and "cpu". Baselines are only meaningful on the
+/// machine (and OpenCL platform) they have been recorded on.
+
+#include "bench.hpp"
+
+int main (
+          int   argc,                                                                               // Number of arguments.
+          char* argv[]                                                                              // Arguments.
+         )
+{
+  std::string                   loc_mode        = (argc > 1) ? argv[1] : "";                        // Mode ("record" or "compare").
+  std::string                   loc_file_name   = NU_BENCH_BASELINE;                                // Baseline file name.
+  size_t                        loc_repetitions = NU_BENCH_REPETITIONS;                             // Number of repetitions.
+  double                        loc_threshold   = NU_BENCH_THRESHOLD;                               // Regression threshold [%].
+  nu::compute_device_type       loc_device      = nu::CPU;                                          // OpenCL device type.
+  std::vector<nu::bench_result> loc_baseline;                                                       // Baseline results.
+  bool                          loc_regression  = false;                                            // Regression flag.
+  nu::opengl*                   gui;                                                                // OpenGL context.
+  nu::opencl*                   cl;                                                                 // OpenCL context.
+  nu::benchmark*                bench;                                                              // Benchmark suite.
+  int                           loc_device_arg;                                                     // Device argument index.
+
+  if((loc_mode != "record") && (loc_mode != "compare"))
+  {
+    printf ("usage: nu_perf record  [baseline.json] [repetitions] [cpu | gpu]\n");
+    printf ("       nu_perf compare [baseline.json] [repetitions] [threshold %%] [cpu | gpu]\n");
+    return EXIT_FAILURE;
+  }
+
+  if(argc > 2)
+  {
+    loc_file_name = argv[2];                                                                        // Setting baseline file name...
+  }
+
+  if(argc > 3)
+  {
+    loc_repetitions = (size_t)std::max (atoi (argv[3]), 1);                                         // Setting number of repetitions...
+  }
+
+  if((loc_mode == "compare") && (argc > 4))
+  {
+    loc_threshold = atof (argv[4]);                                                                 // Setting regression threshold...
+  }
+
+  loc_device_arg = (loc_mode == "compare") ? 5 : 4;                                                 // Setting device argument index...
+
+  if((argc > loc_device_arg) && (std::string (argv[loc_device_arg]) == "gpu"))
+  {
+    loc_device = nu::GPU;                                                                           // Setting GPU device...
+  }
+
+  gui   = new nu::opengl ("nu_perf", NU_BENCH_WINDOW, NU_BENCH_WINDOW, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                          nu::OFFSCREEN);                                                           // Creating offscreen OpenGL context...
+  cl    = new nu::opencl (loc_device);                                                              // Creating OpenCL context...
+  bench = new nu::benchmark (cl, loc_repetitions);                                                  // Creating benchmark suite...
+
+  if(loc_mode == "compare")
+  {
+    loc_baseline = bench->load (loc_file_name);                                                     // Loading baseline (before running)...
+  }
+
+  bench->frame ();                                                                                  // Timing frame transfer...
+  bench->build ();                                                                                  // Timing kernel build...
+  bench->process ();                                                                                // Timing mesh processing...
+
+  if(loc_mode == "record")
+  {
+    bench->write (loc_file_name);                                                                   // Writing baseline...
+  }
+  else
+  {
+    loc_regression = nu::benchmark::compare (loc_baseline, bench->result, loc_threshold);           // Comparing to baseline...
+  }
+
+  delete bench;                                                                                     // Deleting benchmark suite...
+  delete cl;                                                                                        // Deleting OpenCL context...
+  delete gui;                                                                                       // Deleting OpenGL context...
+
+  return loc_regression ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+/// @file     capture.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "capture" class (asynchronous frame export).
+///
+/// @details  Animations can be produced by saving each rendered frame to file, either from a
+/// visible window or from an offscreen render target (see @link opengl @endlink). The
+/// @link capture @endlink class reads the pixels of the current framebuffer through a ring of
+/// Pixel Buffer Objects (PBO): each @link grab @endlink call only starts an asynchronous
+/// transfer, while the frames of the previous transfers are collected as soon as the GPU has
+/// completed them (as signaled by an OpenGL fence). The collected frames are then encoded and
+/// written to file by a background thread, hence neither the GPU transfers nor the file
+/// encoding stall the render loop. The frames are saved as:
+/// - **PNG**: RGBA 8-bit PNG files (uncompressed "stored" deflate blocks, no external library).
+/// - **RAW**: RGBA 8-bit raw pixel files, rows from top to bottom.
+///
+/// The file names are "<prefix>_<frame number>.png" or "<prefix>_<frame number>_<x>x<y>.raw".
+
+#ifndef capture_hpp
+#define capture_hpp
+
+#include "neutrino.hpp"
+#include "opengl.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <atomic>
+
+namespace nu
+{
+// Capture file formats:
+typedef enum
+{
+  PNG,                                                                                              ///< Frames saved as PNG files.
+  RAW                                                                                               ///< Frames saved as raw RGBA files.
+} capture_format;
+
+/// @brief    **Data structure. Captured frame.**
+/// @details  This structure holds a captured frame, waiting to be encoded by the background thread.
+typedef struct _capture_frame
+{
+  size_t                     number;                                                                ///< Frame number.
+  int                        size_x;                                                                ///< Frame x-size [px].
+  int                        size_y;                                                                ///< Frame y-size [px].
+  std::vector<unsigned char> pixel;                                                                 ///< Frame pixels (RGBA, rows from bottom to top).
+} capture_frame;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "capture" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class capture
+/// ### Frame capture.
+/// Declares an asynchronous frame capture.
+/// To be used for saving rendered frames to file.
+class capture : public neutrino                                                                     /// @brief **Frame capture.**
+{
+private:
+  std::string               prefix;                                                                 ///< @brief **File name prefix.**
+  capture_format            format;                                                                 ///< @brief **File format.**
+  std::vector<GLuint>       pbo;                                                                    ///< @brief **PBO ring.**
+  std::vector<GLsync>       fence;                                                                  ///< @brief **PBO ring fences (NULL = PBO free).**
+  std::vector<size_t>       pbo_frame;                                                              ///< @brief **PBO ring frame numbers.**
+  size_t                    head;                                                                   ///< @brief **PBO ring head (next PBO to be written).**
+  size_t                    frame;                                                                  ///< @brief **Next frame number.**
+  int                       size_x;                                                                 ///< @brief **PBO frame x-size [px].**
+  int                       size_y;                                                                 ///< @brief **PBO frame y-size [px].**
+  std::thread               encoder;                                                                ///< @brief **Encoder thread.**
+  std::mutex                queue_lock;                                                             ///< @brief **Encoder queue lock.**
+  std::condition_variable   queue_signal;                                                           ///< @brief **Encoder queue signal.**
+  std::deque<capture_frame> queue;                                                                  ///< @brief **Encoder queue.**
+  bool                      stop;                                                                   ///< @brief **Encoder stop flag.**
+  std::string               failure;                                                                ///< @brief **Capture failure: message ("" = no failure).**
+
+  /// @brief **PBO collector.**
+  /// @details Maps a PBO whose transfer has completed, copies its frame and pushes it to the
+  /// encoder queue. If "loc_wait" is true, it waits for the transfer to complete; otherwise, it
+  /// returns "false" if the transfer is still in progress. If the fence wait or the mapping
+  /// fails, it frees the PBO, drops the frame and records the failure.
+  bool  collect (
+                 size_t loc_slot,                                                                   ///< PBO ring slot.
+                 bool   loc_wait                                                                    ///< Wait flag.
+                );
+
+  /// @brief **Encoder thread loop.**
+  /// @details Pops the frames from the encoder queue and writes them to file. If a file cannot be
+  /// written, it records the failure and stops: the error is reported by @link check @endlink,
+  /// on the render thread.
+  void  encode ();
+
+  /// @brief **Capture failure check.**
+  /// @details Exits (on the render thread) if a frame could not be read back or written to file.
+  void  check ();
+
+  /// @brief **Capture failure setter.**
+  /// @details Records the first failure and drops the pending frames (thread safe).
+  void  fail (
+              std::string loc_failure                                                               ///< Failure message.
+             );
+
+  /// @brief **PNG writer.**
+  /// @details Writes a frame as PNG file. It returns "false" if the file cannot be written.
+  bool  write_png (
+                   capture_frame& loc_frame,                                                        ///< Frame.
+                   std::string    loc_file_name                                                     ///< File name.
+                  );
+
+  /// @brief **RAW writer.**
+  /// @details Writes a frame as raw RGBA file. It returns "false" if the file cannot be written.
+  bool  write_raw (
+                   capture_frame& loc_frame,                                                        ///< Frame.
+                   std::string    loc_file_name                                                     ///< File name.
+                  );
+
+public:
+  std::atomic<size_t>       written;                                                                ///< @brief **Number of frames written to file.**
+
+  /// @brief **Class constructor.**
+  /// @details Starts the encoder thread. The PBO ring is allocated at the first grab.
+  capture (
+           std::string    loc_prefix,                                                               ///< File name prefix (path included).
+           capture_format loc_format                                                                ///< File format.
+          );
+
+  /// @brief **Frame grabber.**
+  /// @details Starts the asynchronous transfer of the pixels of the current read framebuffer (the
+  /// offscreen framebuffer, or the back buffer of the window) into the PBO ring. To be invoked
+  /// after @link opengl::plot @endlink and before @link opengl::refresh @endlink. It waits for
+  /// a previous transfer only if all the NU_CAPTURE_RING PBOs are still in flight, and for the
+  /// encoder only if NU_CAPTURE_QUEUE frames are already waiting to be written. It exits if the
+  /// encoder failed to write a previous frame.
+  void  grab (
+              nu::opengl* loc_gui                                                                   ///< OpenGL GUI.
+             );
+
+  /// @brief **Flush function.**
+  /// @details Waits for all pending transfers and pushes their frames to the encoder queue. It
+  /// exits if a frame could not be read back or written to file.
+  void  flush ();
+
+  /// @brief **Class destructor.**
+  /// @details Collects the pending frames, waits for the encoder thread to write them, reports a
+  /// failure (without exiting) and deletes the PBO ring.
+  ~capture ();
+};
+}
+#endif
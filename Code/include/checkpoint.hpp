@@ -0,0 +1,101 @@
+/// @file     checkpoint.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "checkpoint" class (simulation checkpoint and restart).
+///
+/// @details  The @link checkpoint @endlink class saves the whole state of a simulation (all the
+/// data objects of the Neutrino data container, plus optional user metadata: e.g. the step, the
+/// simulation time or any other scalar kernel parameter) to a single file, and restores it. The
+/// file has the same layout as a @link snapshot @endlink file: a snapshot file can be used as a
+/// restart file as well (only its objects are restored).
+///
+/// Saving: each OpenCL buffer is mapped on the host and written to file by one large sequential
+/// write, without copying it in the host data vector. The file is written to "<name>.tmp",
+/// flushed to disk and atomically renamed over the previous one: an interrupted checkpoint (or a
+/// crash) never replaces a good one.
+///
+/// Restarting: the file is mapped (see @link mapfile @endlink) and each object is uploaded
+/// directly from the mapped pages into its OpenCL buffer. To be invoked after the kernel
+/// arguments have been set (see @link kernel::setarg @endlink) and before the first @link
+/// opencl::execute @endlink. The host data vectors are not updated (see @link opencl::read
+/// @endlink).
+
+#ifndef checkpoint_hpp
+#define checkpoint_hpp
+
+#include "neutrino.hpp"
+#include "opencl.hpp"
+#include "mapfile.hpp"
+#include "snapshot.hpp"
+#include <cstdint>
+#include <filesystem>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "checkpoint" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class checkpoint
+/// ### Simulation checkpoint.
+/// Declares a simulation checkpoint.
+/// To be used for saving and restoring the whole state of a long simulation.
+class checkpoint : public neutrino                                                                  /// @brief **Simulation checkpoint.**
+{
+private:
+  size_t      step;                                                                                 ///< @brief **Checkpoint step.**
+  std::string metadata;                                                                             ///< @brief **Checkpoint user metadata.**
+
+  /// @brief **Bounds check method.**
+  /// @details Exits if a block exceeds the size of the mapped restart file.
+  void        check (
+                     size_t loc_offset,                                                             ///< Block offset [bytes].
+                     size_t loc_size,                                                               ///< Block size [bytes].
+                     size_t loc_file_size                                                           ///< File size [bytes].
+                    );
+
+  /// @brief **File sync method.**
+  /// @details Flushes a file (or, on POSIX, a directory) to disk. It returns "false" if the file
+  /// could not be flushed.
+  static bool sync (
+                    std::string loc_file_name                                                       ///< File (or directory) name.
+                   );
+
+public:
+  /// @brief **Class constructor.**
+  /// @details It does nothing.
+  checkpoint ();
+
+  /// @brief **Save method.**
+  /// @details Saves all the data objects of the Neutrino data container, the step and the user
+  /// metadata to a checkpoint file (an existing file is replaced only when the new one is
+  /// complete). To be invoked after @link opencl::execute @endlink.
+  void        save (
+                    std::string loc_file_name,                                                      ///< Checkpoint file name.
+                    size_t      loc_step,                                                           ///< Simulation step.
+                    std::string loc_metadata                                                        ///< User metadata.
+                   );
+
+  /// @brief **Restart method.**
+  /// @details Uploads the data objects of a checkpoint (or snapshot) file into their OpenCL
+  /// buffers and reads its step and user metadata. Each object is matched by position in the
+  /// data container (or, if the objects were created in a different order, by search), and its
+  /// layout index, type, name and size must be the same. To be invoked before the first @link
+  /// opencl::execute @endlink.
+  void        restart (
+                       std::string loc_file_name                                                    ///< Checkpoint file name.
+                      );
+
+  /// @brief **Step getter.**
+  /// @details Returns the step of the last saved or restarted checkpoint.
+  size_t      get_step ();
+
+  /// @brief **Metadata getter.**
+  /// @details Returns the user metadata of the last saved or restarted checkpoint.
+  std::string get_metadata ();
+
+  /// @brief **Class destructor.**
+  /// @details It does nothing.
+  ~checkpoint ();
+};
+}
+#endif
@@ -0,0 +1,273 @@
+/// @file     columnlog.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "columnlog" class (binary columnar log file).
+///
+/// @details  The @link columnlog @endlink class is the binary counterpart of the @link logfile
+/// @endlink class: the values are written row by row, as in a text log file, but they are
+/// stored by columns, in chunks of NU_COLUMNLOG_CHUNK rows. The file starts with a schema
+/// (the log header, the column names and the column types), followed by the chunks:
+///
+/// - file:   "NUCOLLOG", format, columns, header size, header, {type, name size, name} x columns
+/// - chunk:  rows, 0, {codec, size, column values} x columns
+///
+/// All integers are 32 bit (host byte order) and each block is padded to 8 bytes. A column block
+/// is either raw (the 32 bit values) or packed by the built-in PACK codec: delta encoding of the
+/// values (XOR for floats), byte shuffling (all the first bytes, then all the second bytes...)
+/// and run-length encoding of the shuffled bytes. The packed block is kept only if smaller.
+///
+/// The reader maps the file (see @link mapfile @endlink): the raw blocks are appended to the
+/// user vectors directly from the mapped pages, the packed blocks are decoded directly into
+/// them. A text log file (as written by @link logfile @endlink) can be converted to a binary
+/// log file and back.
+
+#ifndef columnlog_hpp
+#define columnlog_hpp
+
+#include "neutrino.hpp"
+#include "mapfile.hpp"
+#include "logfile.hpp"
+
+namespace nu
+{
+// Column types:
+typedef enum
+{
+  COLUMN_UINT,                                                                                      ///< Unsigned integer column (32 bit).
+  COLUMN_INT,                                                                                       ///< Integer column (32 bit).
+  COLUMN_FLOAT                                                                                      ///< Float column (32 bit).
+} column_type;
+
+// Column codecs:
+typedef enum
+{
+  COLUMN_RAW,                                                                                       ///< Raw column blocks.
+  COLUMN_PACK                                                                                       ///< Packed column blocks (delta, byte shuffling, run-length encoding).
+} column_codec;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "columnlog" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class columnlog
+/// ### Binary columnar log file.
+/// Declares a binary columnar log file.
+/// To be used for large logs that have to be read back for post-processing.
+class columnlog : public neutrino                                                                   /// @brief **Binary columnar log file.**
+{
+private:
+  std::ofstream                       out_file;                                                     ///< @brief **Binary file (write mode).**
+  nu::mapfile                         in_file;                                                      ///< @brief **Binary file (read mode).**
+  std::string                         header;                                                       ///< @brief **Log header.**
+  std::vector<std::string>            name;                                                         ///< @brief **Column names.**
+  std::vector<column_type>            type;                                                         ///< @brief **Column types.**
+  column_codec                        codec;                                                        ///< @brief **Column codec (write mode).**
+  std::vector<std::vector<uint32_t> > chunk;                                                        ///< @brief **Pending chunk values, per column (write mode).**
+  size_t                              current;                                                      ///< @brief **Current column (write mode).**
+  size_t                              rows;                                                         ///< @brief **Number of rows.**
+  std::vector<size_t>                 chunk_rows;                                                   ///< @brief **Rows per chunk (read mode).**
+  std::vector<size_t>                 block;                                                        ///< @brief **Column block offsets (chunks x columns, read mode).**
+
+  /// @brief **Word getter.**
+  /// @details Returns the 32 bit word at a (possibly unaligned) address.
+  static uint32_t      word (
+                             const char* loc_data                                                   ///< Word address.
+                            );
+
+  /// @brief **Word put method.**
+  /// @details Writes a 32 bit word on the binary file.
+  void                 put (
+                            uint32_t loc_word                                                       ///< Word.
+                           );
+
+  /// @brief **Pad method.**
+  /// @details Pads the binary file to a multiple of 8 bytes.
+  void                 pad ();
+
+  /// @brief **Value append method.**
+  /// @details Appends a 32 bit value to the current column of the current row.
+  void                 append (
+                               uint32_t    loc_value,                                               ///< Value (bit pattern).
+                               column_type loc_type                                                 ///< Value type.
+                              );
+
+  /// @brief **Chunk flush method.**
+  /// @details Encodes and writes the pending chunk. It exits if the file could not be written.
+  void                 flush ();
+
+  /// @brief **Pack method.**
+  /// @details Encodes a column block by the PACK codec.
+  static void          pack (
+                             std::vector<uint32_t>& loc_value,                                      ///< Column values (bit patterns).
+                             column_type            loc_type,                                       ///< Column type.
+                             std::vector<char>&     loc_packed                                      ///< Packed block.
+                            );
+
+  /// @brief **Unpack method.**
+  /// @details Decodes a PACK column block into "loc_rows" 32 bit values. Returns false if the
+  /// block is corrupted.
+  static bool          unpack (
+                               const char*        loc_packed,                                       ///< Packed block.
+                               size_t             loc_size,                                         ///< Packed block size [bytes].
+                               column_type        loc_type,                                         ///< Column type.
+                               size_t             loc_rows,                                         ///< Number of values.
+                               std::vector<char>& loc_scratch,                                      ///< Scratch buffer.
+                               char*              loc_value                                         ///< Column values (bit patterns).
+                              );
+
+  /// @brief **Block decode method.**
+  /// @details Decodes the block of a column in a chunk into 32 bit values.
+  void                 decode (
+                               size_t             loc_chunk,                                        ///< Chunk index.
+                               size_t             loc_column,                                       ///< Column index.
+                               std::vector<char>& loc_scratch,                                      ///< Scratch buffer.
+                               char*              loc_value                                         ///< Column values (bit patterns).
+                              );
+
+  /// @brief **Column read method.**
+  /// @details Appends all the values of a column to a vector, checking the column type.
+  template <typename T>
+  void                 column (
+                               size_t          loc_column,                                          ///< Column index.
+                               std::vector<T>* loc_data,                                            ///< Column data.
+                               column_type     loc_type                                             ///< Expected column type.
+                              );
+
+public:
+  /// @brief **Class constructor.**
+  /// @details It does nothing.
+  columnlog ();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////////// WRITE METHODS //////////////////////////////////////////
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief **Create method.**
+  /// @details To be invoked by the user in order to create a binary log file (an existing file
+  /// is overwritten) and to write its schema.
+  void                 create (
+                               std::string              loc_file_name,                              ///< Binary log file name.
+                               std::string              loc_header,                                 ///< Log header.
+                               std::vector<std::string> loc_name,                                   ///< Column names.
+                               std::vector<column_type> loc_type,                                   ///< Column types.
+                               column_codec             loc_codec                                   ///< Column codec.
+                              );
+
+  /// @brief **Write method.**
+  /// @details To be invoked by the user in order to write an **unsigned integer** value in the
+  /// next column of the current row (COLUMN_UINT).
+  void                 write (
+                              unsigned int loc_int                                                  ///< Unsigned integer value.
+                             );
+
+  /// @details To be invoked by the user in order to write an **integer** value in the next
+  /// column of the current row (COLUMN_INT).
+  void                 write (
+                              int loc_int                                                           ///< Integer value.
+                             );
+
+  /// @details To be invoked by the user in order to write a **float** value in the next column
+  /// of the current row (COLUMN_FLOAT).
+  void                 write (
+                              float loc_float                                                       ///< Float value.
+                             );
+
+  /// @brief **Endline method.**
+  /// @details To be invoked by the user in order to end the current row (all the columns must
+  /// have been written).
+  void                 endline ();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////////// READ METHODS ///////////////////////////////////////////
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief **Open method.**
+  /// @details To be invoked by the user in order to open a binary log file for reading: it maps
+  /// the file and reads its schema and chunk index.
+  void                 open (
+                             std::string loc_file_name                                              ///< Binary log file name.
+                            );
+
+  /// @brief **Read method.**
+  /// @details To be invoked by the user in order to append all the values of an **unsigned
+  /// integer** column to a vector.
+  void                 read (
+                             size_t                     loc_column,                                 ///< Column index.
+                             std::vector<unsigned int>* loc_data                                    ///< Column data.
+                            );
+
+  /// @details To be invoked by the user in order to append all the values of an **integer**
+  /// column to a vector.
+  void                 read (
+                             size_t            loc_column,                                          ///< Column index.
+                             std::vector<int>* loc_data                                             ///< Column data.
+                            );
+
+  /// @details To be invoked by the user in order to append all the values of a **float** column
+  /// to a vector.
+  void                 read (
+                             size_t              loc_column,                                        ///< Column index.
+                             std::vector<float>* loc_data                                           ///< Column data.
+                            );
+
+  /// @brief **Column index getter.**
+  /// @details Returns the index of a column by name. It exits if the column does not exist.
+  size_t               get_column (
+                                   std::string loc_name                                             ///< Column name.
+                                  );
+
+  /// @brief **Number of columns getter.**
+  size_t               get_columns ();
+
+  /// @brief **Number of rows getter.**
+  size_t               get_rows ();
+
+  /// @brief **Column name getter.**
+  std::string          get_name (
+                                 size_t loc_column                                                  ///< Column index.
+                                );
+
+  /// @brief **Column type getter.**
+  column_type          get_type (
+                                 size_t loc_column                                                  ///< Column index.
+                                );
+
+  /// @brief **Log header getter.**
+  std::string          get_header ();
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  ///////////////////////////////////////////// CONVERTERS ////////////////////////////////////////////
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief **Text import method.**
+  /// @details Converts a text log file (as written by @link logfile @endlink: header, time
+  /// stamp, blank line, delimited rows) to a binary log file. The text header is kept as log
+  /// header; the column names and types must be given.
+  void                 import_text (
+                                    std::string              loc_text_file_name,                    ///< Text log file name (with extension).
+                                    std::string              loc_delimiter,                         ///< Text log file delimiter.
+                                    std::vector<std::string> loc_name,                              ///< Column names.
+                                    std::vector<column_type> loc_type,                              ///< Column types.
+                                    std::string              loc_file_name,                         ///< Binary log file name.
+                                    column_codec             loc_codec                              ///< Column codec.
+                                   );
+
+  /// @brief **Text export method.**
+  /// @details Converts the open binary log file to a text log file, by means of a @link logfile
+  /// @endlink (same header and number formats). An existing text log file is overwritten. The
+  /// binary log file does not store the time stamp: the one of the text log file is regenerated
+  /// (export time).
+  void                 export_text (
+                                    std::string loc_text_file_name,                                 ///< Text log file name.
+                                    std::string loc_text_file_extension,                            ///< Text log file extension.
+                                    std::string loc_delimiter                                       ///< Text log file delimiter.
+                                   );
+
+  /// @brief **Close method.**
+  /// @details To be invoked by the user in order to close the binary log file. In write mode, it
+  /// writes the pending chunk (the current row must be complete) and exits if the file could not
+  /// be written.
+  void                 close ();
+
+  /// @brief **Class destructor.**
+  /// @details Closes the binary log file.
+  ~columnlog ();
+};
+}
+#endif
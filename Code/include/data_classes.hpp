@@ -93,6 +93,8 @@
   #define NU_INTEROP               "cl_khr_gl_sharing"
 #endif
 
+#define NU_GL_EVENT                "cl_khr_gl_event"                                                ///< OpenCL event from OpenGL fence extension.
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////// GLFW header files ////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,129 @@
+/// @file     histogram.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "histogram" class (lock-free time statistics).
+///
+/// @details  A single loop time hides the tail latencies: the @link histogram @endlink class
+/// collects the distribution of a time (e.g. the loop, kernel or transfer times), in order to
+/// report its percentiles. It is an HDR-style (High Dynamic Range) histogram: the times are
+/// recorded in [ns] into logarithmically spaced buckets, each power of two being split into
+/// 2^(NU_HISTOGRAM_BITS - 1) linear sub-buckets, hence the relative error of any percentile is
+/// below 2^(1 - NU_HISTOGRAM_BITS) over the whole range (1 ns...2^NU_HISTOGRAM_RANGE ns).
+///
+/// The bucket counters are atomic: @link record @endlink is lock-free and can be invoked by any
+/// thread. The counts are kept in a ring of NU_HISTOGRAM_SLICES slices, each one holding the
+/// samples of NU_HISTOGRAM_SLICE seconds: the percentiles are computed over this sliding window.
+/// An additional slice holds all the samples since the construction (or the last reset), for
+/// the file dump.
+
+#ifndef histogram_hpp
+#define histogram_hpp
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "histogram" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class histogram
+/// ### Time histogram.
+/// Declares a lock-free HDR time histogram.
+/// To be used for collecting time statistics (percentiles) over a sliding window.
+class histogram                                                                                     /// @brief **Time histogram.**
+{
+private:
+  std::string                        name;                                                          ///< @brief **Histogram name.**
+  size_t                             buckets;                                                       ///< @brief **Number of buckets per slice.**
+  std::vector<std::atomic<uint64_t> > count;                                                        ///< @brief **Bucket counts (slices x buckets, last slice = total).**
+  std::vector<std::atomic<uint64_t> > peak;                                                         ///< @brief **Maximum time per slice [ns].**
+  std::atomic<int64_t>               epoch;                                                         ///< @brief **Current slice epoch (time/NU_HISTOGRAM_SLICE).**
+
+  /// @brief **Bucket index function.**
+  /// @details Returns the bucket index of a time [ns].
+  static size_t   bucket (
+                          uint64_t loc_time                                                         ///< Time [ns].
+                         );
+
+  /// @brief **Bucket value function.**
+  /// @details Returns the mid value [ns] of a bucket.
+  static uint64_t value (
+                         size_t loc_bucket                                                          ///< Bucket index.
+                        );
+
+  /// @brief **Slice ring advance function.**
+  /// @details Clears the slices expired since the last advance and sets the current epoch. Only
+  /// the thread winning the epoch update clears the expired slices.
+  void            advance ();
+
+  /// @brief **Percentile function.**
+  /// @details Returns the percentile [ns] of the sliding window (or of the total slice).
+  uint64_t        quantile (
+                            double loc_percentile,                                                  ///< Percentile [0...100].
+                            bool   loc_total                                                        ///< Total slice flag.
+                           );
+
+  /// @brief **Maximum function.**
+  /// @details Returns the maximum time [ns] of the sliding window (or of the total slice).
+  uint64_t        maximum (
+                           bool loc_total                                                           ///< Total slice flag.
+                          );
+
+  /// @brief **Sample count function.**
+  /// @details Returns the number of samples of the sliding window (or of the total slice).
+  uint64_t        samples (
+                           bool loc_total                                                           ///< Total slice flag.
+                          );
+
+public:
+  /// @brief **Class constructor.**
+  /// @details Allocates the slices.
+  histogram (
+             std::string loc_name                                                                   ///< Histogram name.
+            );
+
+  /// @brief **Clock function.**
+  /// @details Returns a monotonic time [s], to be used for measuring the recorded times.
+  static double   clock ();
+
+  /// @brief **Record function.**
+  /// @details Records a time sample (lock-free).
+  void            record (
+                          double loc_time                                                           ///< Time [s].
+                         );
+
+  /// @brief **Percentile getter.**
+  /// @details Returns a percentile [s] over the sliding window (e.g. 50, 90, 99).
+  double          percentile (
+                              double loc_percentile                                                 ///< Percentile [0...100].
+                             );
+
+  /// @brief **Maximum getter.**
+  /// @details Returns the maximum time [s] over the sliding window.
+  double          max ();
+
+  /// @brief **Sample count getter.**
+  /// @details Returns the number of samples over the sliding window.
+  uint64_t        size ();
+
+  /// @brief **Name getter.**
+  /// @details Returns the histogram name.
+  std::string     get_name ();
+
+  /// @brief **Reset function.**
+  /// @details Clears all the slices.
+  void            reset ();
+
+  /// @brief **Dump function.**
+  /// @details Writes the percentiles of the sliding window and of the total slice, followed by
+  /// the non-empty buckets of the total slice (mid value [us], count), to a text file.
+  void            dump (
+                        std::ofstream& loc_file                                                     ///< Output file.
+                       );
+};
+}
+#endif
@@ -179,6 +179,11 @@ public:
                  std::string        loc_data_legend                                                 ///< Data legend.
                 );
 
+  /// @brief **Statistics method.**
+  /// @details To be invoked by the user in order to show the p50/p90/p99/max times of the loop,
+  /// kernel and transfer time histograms, over their sliding window.
+  void statistics ();
+
   /// @brief **Button method.**
   /// @details To be invoked by the user in order to create a button.
   bool button (
@@ -196,6 +201,8 @@ public:
 
   /// @brief **End method.**
   /// @details To be invoked by the user in order to stop using Imgui inside the application loop.
+  /// With dynamic resolution, the plots are upscaled to the window before the GUI pass (see
+  /// @link opengl::resolve @endlink).
   void end ();
 
   /// @brief **Class destructor.**
@@ -7,9 +7,17 @@
 #define logfile_hpp
 
 #include "neutrino.hpp"
+#include "mapfile.hpp"
 #include <iostream>
 #include <fstream>
 #include <ctime>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <charconv>
+#include <tuple>
+#include <utility>
 
 namespace nu
 {
@@ -17,22 +25,75 @@ namespace nu
 typedef enum
 {
   READ,                                                                                             ///< Opens a file in read mode.
-  WRITE                                                                                             ///< Opens a file in write mode.
+  READ_MAPPED,                                                                                      ///< Opens a file in memory-mapped read mode (parse method).
+  WRITE,                                                                                            ///< Opens a file in write mode.
+  WRITE_ASYNC                                                                                       ///< Opens a file in asynchronous write mode (background writer thread).
 } logfile_mode;
 
+// Asynchronous record types:
+typedef enum
+{
+  LOG_UINT,                                                                                         ///< Unsigned integer value.
+  LOG_INT,                                                                                          ///< Integer value.
+  LOG_FLOAT,                                                                                        ///< Float value.
+  LOG_TEXT,                                                                                         ///< String chunk (the string continues in the next record).
+  LOG_TEXT_END,                                                                                     ///< Last string chunk.
+  LOG_ENDLINE                                                                                       ///< End of line.
+} logfile_record_type;
+
+/// @brief    **Data structure. Asynchronous log record.**
+/// @details  Raw binary value, as queued by the writing thread: the formatting is done by the
+/// background writer thread.
+typedef struct _logfile_record
+{
+  uint8_t    type;                                                                                  ///< Record type (logfile_record_type).
+  uint8_t    size;                                                                                  ///< String chunk size [bytes].
+  union
+  {
+    char     text[NU_LOGFILE_TEXT];                                                                 ///< String chunk.
+    uint32_t unsigned_integer;                                                                      ///< Unsigned integer value.
+    int32_t  integer;                                                                               ///< Integer value.
+    float    real;                                                                                  ///< Float value.
+  } value;                                                                                          ///< Record value.
+} logfile_record;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////// "nu::logfile" class /////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 class logfile : public neutrino                                                                     ///< @brief **Logfile.**
 {
 private:
-  std::ifstream     in_file;                                                                        ///< Data file.
-  std::ofstream     out_file;                                                                       ///< Data file.
-  std::string       fileline;                                                                       ///< File line.
-  std::stringstream streamline;                                                                     ///< Stream line.
-  bool              EOL = true;                                                                     ///< End of line flag.
-  bool              END = false;                                                                    ///< End of file flag.
-  std::string       delimiter;                                                                      ///< File delimiter.
+  std::ifstream               in_file;                                                              ///< Data file.
+  nu::mapfile                 in_map;                                                               ///< Data file (memory-mapped read mode).
+  std::ofstream               out_file;                                                             ///< Data file.
+  std::string                 fileline;                                                             ///< File line.
+  std::stringstream           streamline;                                                           ///< Stream line.
+  bool                        EOL = true;                                                           ///< End of line flag.
+  bool                        END = false;                                                          ///< End of file flag.
+  std::string                 delimiter;                                                            ///< File delimiter.
+  bool                        async = false;                                                        ///< Asynchronous write mode flag.
+  std::vector<logfile_record> ring;                                                                 ///< Asynchronous record ring (single producer, single consumer).
+  std::atomic<size_t>         ring_head;                                                            ///< Ring head (next record to be written by the producer).
+  std::atomic<size_t>         ring_tail;                                                            ///< Ring tail (next record to be formatted by the writer).
+  size_t                      ring_limit;                                                           ///< Producer cached ring limit (tail + ring size).
+  std::atomic<bool>           ring_stop;                                                            ///< Writer thread stop flag.
+  std::thread                 writer;                                                               ///< Writer thread.
+
+  /// @brief **Push method.**
+  /// @details Queues a record on the ring. If the ring is full, it waits for the writer thread
+  /// to make room (bounded memory).
+  void push (
+             logfile_record& loc_record                                                             ///< Log record.
+            );
+
+  /// @brief **Drain method.**
+  /// @details Writer thread loop: formats the queued records in batches of NU_LOGFILE_BATCH
+  /// bytes and writes them on the file, until stopped. It drains the ring before returning.
+  void drain ();
+
+  /// @brief **Stop method.**
+  /// @details Stops the writer thread, after all the queued records have been written.
+  void stop ();
 
   template<typename T>
   struct remove_pointer
@@ -46,6 +107,149 @@ private:
     typedef typename remove_pointer<T>::type type;
   };
 
+  /// @brief **Field parse method.**
+  /// @details Parses a number from a line by means of std::from_chars (no locale, no
+  /// allocation), skipping the leading blanks and "+" sign, then the following delimiter.
+  /// Returns false if the field is not a number.
+  template <typename T>
+  bool field (
+              const char*& loc_position,                                                            ///< Parse position.
+              const char*  loc_end,                                                                 ///< Line end.
+              T&           loc_value                                                                ///< Parsed value.
+             )
+  {
+    std::from_chars_result loc_result;                                                              // Parse result.
+
+    while((loc_position < loc_end) && ((*loc_position == ' ') || (*loc_position == '\t')))
+    {
+      loc_position++;                                                                               // Skipping leading blanks...
+    }
+
+    if((loc_position < loc_end) && (*loc_position == '+'))
+    {
+      loc_position++;                                                                               // Skipping "+" sign (not accepted by std::from_chars)...
+    }
+
+    loc_result = std::from_chars (loc_position, loc_end, loc_value);                                // Parsing number...
+
+    if(loc_result.ec != std::errc ())
+    {
+      return false;                                                                                 // Not a number...
+    }
+
+    loc_position = loc_result.ptr;                                                                  // Advancing parse position...
+
+    if((loc_position == loc_end) || isspace ((unsigned char)*loc_position))
+    {
+      return true;                                                                                  // Field ended by line end or blank...
+    }
+
+    if(((size_t)(loc_end - loc_position) >= delimiter.size ()) &&
+       (memcmp (loc_position, delimiter.data (), delimiter.size ()) == 0))
+    {
+      loc_position += delimiter.size ();                                                            // Skipping delimiter...
+      return true;                                                                                  // Field ended by delimiter...
+    }
+
+    return false;                                                                                   // Trailing characters...
+  }
+
+  /// @brief **Range parse method.**
+  /// @details Parses all the lines of a byte range of the mapped file: the values of a line
+  /// are appended to the columns of "loc_part" only if all of them are numbers.
+  template <typename P, size_t ... I>
+  void range (
+              const char*              loc_begin,                                                   ///< Range begin (line begin).
+              const char*              loc_end,                                                     ///< Range end (line begin or file end).
+              P*                       loc_part,                                                    ///< Parsed columns.
+              std::index_sequence<I...>                                                             ///< Column indexes.
+             )
+  {
+    std::tuple<typename std::tuple_element<I, P>::type::value_type ...> loc_value;                  // Line values.
+    const char* loc_line = loc_begin;                                                               // Line begin.
+    const char* loc_eol;                                                                            // Line end.
+    const char* loc_position;                                                                       // Parse position.
+
+    while(loc_line < loc_end)
+    {
+      loc_eol      = (const char*)memchr (loc_line, '\n', (size_t)(loc_end - loc_line));            // Finding line end...
+      loc_eol      = (loc_eol == nullptr) ? loc_end : loc_eol;                                      // Setting last line end...
+      loc_position = loc_line;                                                                      // Setting parse position...
+
+      if((field (loc_position, loc_eol, std::get<I>(loc_value)) && ...))
+      {
+        (std::get<I>(*loc_part).push_back (std::get<I>(loc_value)), ...);                           // Appending line values...
+      }
+
+      loc_line = loc_eol + 1;                                                                       // Advancing to next line...
+    }
+  }
+
+  /// @brief **Parallel parse method.**
+  /// @details Splits the mapped file at line boundaries in up to one range per hardware thread
+  /// (at least NU_LOGFILE_PARSE_CHUNK bytes each), parses the ranges in parallel and appends
+  /// the parsed columns to the user vectors, in file order. Returns the number of parsed lines.
+  template <size_t ... I, typename ... Types>
+  size_t parse_all (
+                    std::index_sequence<I...> loc_index,                                            ///< Column indexes.
+                    Types...                  var                                                   ///< Column vectors.
+                   )
+  {
+    typedef std::tuple<typename remove_pointer<Types>::type ...> part;                              // Parsed columns type.
+    const char*              loc_data = in_map.data ();                                             // Mapped bytes.
+    size_t                   loc_size = in_map.size ();                                             // Mapped size [bytes].
+    size_t                   loc_threads;                                                           // Number of threads.
+    size_t                   loc_rows = 0;                                                          // Number of parsed lines.
+    std::vector<const char*> loc_bound;                                                             // Range bounds.
+    std::vector<part>        loc_part;                                                              // Parsed columns, per range.
+    std::vector<std::thread> loc_thread;                                                            // Parse threads.
+    const char*              loc_next;                                                              // Next line begin.
+    size_t                   t;                                                                     // Range index.
+
+    if(loc_data == nullptr)
+    {
+      return 0;                                                                                     // Empty (or not mapped) file...
+    }
+
+    loc_threads = std::max (std::min ((size_t)std::thread::hardware_concurrency (),
+                                      loc_size/NU_LOGFILE_PARSE_CHUNK), (size_t)1);                 // Setting number of threads...
+    loc_bound.push_back (loc_data);                                                                 // Setting first range begin...
+
+    // Splitting file at line boundaries:
+    for(t = 1; t < loc_threads; t++)
+    {
+      loc_next = std::max (loc_data + t*loc_size/loc_threads, loc_bound.back ());                   // Setting tentative range begin...
+      loc_next = (const char*)memchr (loc_next, '\n', (size_t)(loc_data + loc_size - loc_next));    // Finding line end...
+      loc_bound.push_back ((loc_next == nullptr) ? loc_data + loc_size : loc_next + 1);             // Setting range begin...
+    }
+
+    loc_bound.push_back (loc_data + loc_size);                                                      // Setting last range end...
+    loc_part.resize (loc_threads);                                                                  // Allocating parsed columns...
+
+    for(t = 1; t < loc_threads; t++)
+    {
+      loc_thread.push_back (std::thread (&logfile::range<part, I...>, this, loc_bound[t],
+                                         loc_bound[t + 1], &loc_part[t], loc_index));               // Starting parse thread...
+    }
+
+    range (loc_bound[0], loc_bound[1], &loc_part[0], loc_index);                                    // Parsing first range...
+
+    for(t = 0; t < loc_thread.size (); t++)
+    {
+      loc_thread[t].join ();                                                                        // Waiting for parse thread...
+    }
+
+    // Appending parsed columns in file order:
+    for(t = 0; t < loc_threads; t++)
+    {
+      (var->insert (var->end (), std::get<I>(loc_part[t]).begin (),
+                    std::get<I>(loc_part[t]).end ()), ...);                                         // Appending columns...
+      loc_rows += std::get<0>(loc_part[t]).size ();                                                 // Counting lines...
+    }
+
+    return loc_rows;
+  }
+
 public:
   /// @brief **Class constructor.**
   /// @details It does nothing.
@@ -56,6 +260,9 @@ public:
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /// @brief **Open method.**
   /// @details To be invoked by the user in order to open/create a log file.
+  /// In WRITE_ASYNC mode, the write methods only queue raw binary records on a bounded ring
+  /// (NU_LOGFILE_RING records): the formatting and the file writes are done in batches by a
+  /// background writer thread, which is drained by the close method (or by the destructor).
   void open (
              std::string  loc_log_file_name,                                                        ///< Log file name.
              std::string  loc_log_file_extension,                                                   ///< Log file extension.
@@ -135,6 +342,21 @@ public:
     read (var2 ...);                                                                                // Recursive self-invocation...
   };
 
+  /// @brief **Parse method.**
+  /// @details To be invoked by the user in order to read a whole log file opened in READ_MAPPED
+  /// mode: each line made of numbers (at least one per vector argument, separated by the
+  /// delimiter) appends one value to each vector, the other lines (e.g. the header and the time
+  /// stamp) are skipped. The numbers are parsed by std::from_chars directly from the mapped
+  /// file, in parallel on large files. Returns the number of parsed lines.
+  template <typename T, typename ... Types>
+  size_t parse (
+                T        var1,
+                Types... var2
+               )
+  {
+    return parse_all (std::index_sequence_for<T, Types...> (), var1, var2 ...);                     // Parsing file...
+  }
+
   /// @brief **Endline method.**
   /// @details To be invoked by the user in order to write a newline on the log file.
   void endline ();
@@ -0,0 +1,75 @@
+/// @file     mapfile.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "mapfile" class (read-only memory-mapped file).
+///
+/// @details  The @link mapfile @endlink class maps a whole file in the address space of the
+/// process, read-only: its bytes can then be parsed or copied directly from the page cache,
+/// without the intermediate buffers of the standard streams. The mapping is page aligned.
+
+#ifndef mapfile_hpp
+#define mapfile_hpp
+
+#include "neutrino.hpp"
+
+#if defined(__linux__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "mapfile" class ////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class mapfile
+/// ### Memory-mapped file.
+/// Declares a read-only memory-mapped file.
+/// To be used for fast sequential reads of large files.
+class mapfile : public neutrino                                                                     /// @brief **Memory-mapped file.**
+{
+private:
+  const char* buffer = nullptr;                                                                     ///< @brief **Mapped bytes.**
+  size_t      length = 0;                                                                           ///< @brief **Mapped size [bytes].**
+
+  #ifdef WIN32
+    HANDLE    file_handle = INVALID_HANDLE_VALUE;                                                   ///< @brief **File handle.**
+    HANDLE    map_handle  = NULL;                                                                   ///< @brief **File mapping handle.**
+  #endif
+
+  #if defined(__linux__) || defined(__APPLE__)
+    int       descriptor  = -1;                                                                     ///< @brief **File descriptor.**
+  #endif
+
+public:
+  /// @brief **Class constructor.**
+  /// @details It does nothing.
+  mapfile ();
+
+  /// @brief **Open method.**
+  /// @details Maps a whole file, read-only, for sequential access. It exits if the file cannot
+  /// be opened. An empty file is not mapped (null data, zero size).
+  void        open (
+                    std::string loc_file_name                                                       ///< File name.
+                   );
+
+  /// @brief **Data getter.**
+  /// @details Returns the mapped bytes.
+  const char* data ();
+
+  /// @brief **Size getter.**
+  /// @details Returns the mapped size [bytes].
+  size_t      size ();
+
+  /// @brief **Close method.**
+  /// @details Unmaps the file.
+  void        close ();
+
+  /// @brief **Class destructor.**
+  /// @details Unmaps the file.
+  ~mapfile ();
+};
+}
+#endif
@@ -7,13 +7,21 @@
 /// with built-in pre- and post-processing facilities".
 /// Neutrino reads GMSH files and reconstructs a group complex out of it.
 /// The group complex is used for both computational and rendering purposes.
+/// Files can be read either by means of the GMSH API or by a native streaming MSH 4.1 reader
+/// (ASCII and binary), which does not need the GMSH runtime and converts the node coordinates
+/// and the element node tags directly into the Neutrino output vectors.
 
 #ifndef mesh_hpp
 #define mesh_hpp
 
 #include "neutrino.hpp"
 #include "data_classes.hpp"
-#include <gmsh.h>
+#include <map>
+#include <thread>
+
+#ifndef NU_NO_GMSH                                                                                  // Checking whether GMSH is available...
+  #include <gmsh.h>
+#endif
 
 /// @brief    **Data structure. Internally used by Neutrino.**
 /// @details  This structure is used as data storage in the node array. It is tightly packed to be
@@ -212,6 +220,78 @@ const int MSH_TET_MINI = 139;
 const int MSH_TRIH_4   = 140;
 const int MSH_MAX_NUM  = 140;                                                                       ///< GMSH: keep this up-to-date when adding new type!
 
+// Mesh reader:
+typedef enum
+{
+  GMSH,                                                                                             ///< Mesh file read by means of the GMSH API.
+  NATIVE                                                                                            ///< Mesh file read by the native MSH 4.1 streaming reader.
+} mesh_reader;
+
+/// @brief    **Mesh topology mode.**
+/// @details  Sets the encoding of the neighbour arrays built by the mesh processing:
+/// - FULL: "neighbour" (32-bit global node indices), "neighbour_center", "neighbour_link" (float4)
+///   and "neighbour_length" (about 28 bytes per neighbour).
+/// - COMPACT: "neighbour" (32-bit global node indices) and, optionally, "neighbour_link_packed"
+///   (3 floats per neighbour). Centers are implicit in "neighbour_offset", lengths are derived
+///   from links (16 bytes per neighbour, or 4 bytes without links).
+/// - COMPACT_16: as COMPACT, but with 16-bit local node indices (position in the "node" array,
+///   relative to the first node of the request) packed two per integer in "neighbour_local"
+///   (14 bytes per neighbour, or 2 bytes without links).
+typedef enum
+{
+  FULL,                                                                                             ///< Full topology (redundant arrays).
+  COMPACT,                                                                                          ///< Compact topology, 32-bit global indices.
+  COMPACT_16                                                                                        ///< Compact topology, 16-bit local indices.
+} mesh_topology;
+
+/// @brief    **Data structure. Mesh processing request.**
+/// @details  This structure describes a (physical group, dimension, element type) request, to be
+/// used in batched mesh processing.
+typedef struct _mesh_request
+{
+  int tag;                                                                                          ///< Physical group tag.
+  int dimension;                                                                                    ///< Physical group dimension.
+  int type;                                                                                         ///< Element type.
+} mesh_request;
+
+/// @brief    **Data structure. Mesh index range.**
+/// @details  This structure describes a [begin, end) index range in a mesh array. The range is
+/// empty if begin >= end.
+typedef struct _mesh_range
+{
+  GLint begin;                                                                                      ///< First index of the range.
+  GLint end;                                                                                        ///< Last index of the range + 1.
+} mesh_range;
+
+/// @brief    **Data structure. Mesh change set.**
+/// @details  This structure collects the index ranges changed by the incremental mesh updates,
+/// for each mesh array, so that only those ranges need to be uploaded to the client GPU. The
+/// "neighbour" range applies to all neighbour arrays ("neighbour", "neighbour_center",
+/// "neighbour_link", "neighbour_length"); for "neighbour_link_packed" it must be multiplied by 3.
+typedef struct _mesh_change
+{
+  mesh_range node_coordinates;                                                                      ///< Changed range in "node_coordinates".
+  mesh_range node;                                                                                  ///< Changed range in "node".
+  mesh_range element;                                                                               ///< Changed range in "element".
+  mesh_range element_offset;                                                                        ///< Changed range in "element_offset".
+  mesh_range group;                                                                                 ///< Changed range in "group".
+  mesh_range group_offset;                                                                          ///< Changed range in "group_offset".
+  mesh_range neighbour;                                                                             ///< Changed range in the neighbour arrays.
+  mesh_range neighbour_offset;                                                                      ///< Changed range in "neighbour_offset".
+} mesh_change;
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure describes an element block (i.e. all the elements of a given type
+/// belonging to the same entity) read by the native MSH 4.1 reader.
+typedef struct _msh_block
+{
+  int    dimension;                                                                                 ///< Entity dimension.
+  int    tag;                                                                                       ///< Entity tag.
+  int    type;                                                                                      ///< Element type.
+  size_t offset;                                                                                    ///< Block offset in the element node vector of the given type.
+  size_t size;                                                                                      ///< Number of element nodes in the block.
+} msh_block;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////// "mesh" class /////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -233,6 +313,172 @@ private:
   size_t                            all_nodes;
   std::vector<GLint>                all_node;                                                       ///< Node tags.
 
+  // NATIVE READER VARIABLES:
+  mesh_reader                       reader;                                                         ///< Mesh reader.
+  bool                              msh_binary;                                                     ///< MSH binary file flag.
+  std::map<std::pair<int, int>, std::vector<int> >
+                                    msh_physical;                                                   ///< Physical tags of each (dimension, tag) entity.
+  std::vector<msh_block>            msh_block_list;                                                 ///< Element block list.
+  std::vector<std::vector<GLint> >  msh_element_node;                                               ///< Element node indices, per element type.
+  std::vector<size_t>               msh_node_tag;                                                   ///< Node tags, in file order (node index = position).
+  std::string                       msh_node_error;                                                 ///< Node reader thread error message (empty = no error).
+
+  // PROCESS VARIABLES:
+  bool                              nodes_ready;                                                    ///< Node coordinates ready flag.
+  mesh_topology                     topology;                                                       ///< Topology mode.
+  bool                              topology_link;                                                  ///< Topology link flag.
+
+  // INCREMENTAL UPDATE VARIABLES:
+  std::vector<std::map<GLint, GLint> >
+                                    request_node_position;                                          ///< Node positions in the "node" array, per request (node index -> position).
+  bool                              request_node_ready;                                             ///< Request node position maps ready flag.
+
+  /// @brief **Node coordinates reader.**
+  /// @details Reads the node coordinates of all entities into the "node_coordinates" vector.
+  /// This is done only once, as the node coordinates are shared among all requests.
+  void   process_nodes ();
+
+  /// @brief **Request processing function.**
+  /// @details Processes a single (physical group, dimension, element type) request, appending
+  /// its results to the shared arrays. All offsets are global, i.e. they refer to the shared
+  /// arrays, so that all requests can be indexed from one buffer.
+  void   process_request (
+                          int loc_physical_group_tag,                                               ///< Physical group tag.
+                          int loc_physical_group_dimension,                                         ///< Physical group dimension.
+                          int loc_element_type                                                      ///< Element type.
+                         );
+
+  /// @brief **Change range function.**
+  /// @details Extends a changed range so that it contains the [begin, end) range.
+  void   change (
+                 mesh_range& loc_range,                                                             ///< Changed range.
+                 size_t      loc_begin,                                                             ///< First index of the range.
+                 size_t      loc_end                                                                ///< Last index of the range + 1.
+                );
+
+  /// @brief **Node position function.**
+  /// @details Returns the position of a node in the "node" array, within the node range of the
+  /// "r" request, or -1 if the node is not present in the request. The positions are looked up
+  /// in per-request maps, rebuilt from the "node" array only after a mesh processing or a node
+  /// removal (which shift the positions).
+  GLint  node_position (
+                        GLint  loc_node,                                                            ///< Node index.
+                        size_t loc_request                                                          ///< Request index.
+                       );
+
+  /// @brief **Neighbour update function.**
+  /// @details Rebuilds the neighbour entries of the "i" node (position in the "node" array) from
+  /// the elements of its group, patching the neighbour arrays and offsets locally.
+  void   update_neighbour (
+                           size_t loc_position                                                      ///< Node position.
+                          );
+
+  /// @brief **Range replace function.**
+  /// @details Replaces the [begin, end) range of a vector with a new range, which may have a
+  /// different size: the elements following the range are moved once.
+  template <typename T> static void replace (
+                                             std::vector<T>&       loc_vector,                      ///< Vector.
+                                             size_t                loc_begin,                       ///< First index of the range.
+                                             size_t                loc_end,                         ///< Last index of the range + 1.
+                                             const std::vector<T>& loc_range                        ///< New range.
+                                            )
+  {
+    size_t loc_size = loc_end - loc_begin;                                                          // Old range size.
+
+    if(loc_range.size () >= loc_size)
+    {
+      std::copy (loc_range.begin (), loc_range.begin () + loc_size, loc_vector.begin () + loc_begin);
+      loc_vector.insert (loc_vector.begin () + loc_end, loc_range.begin () + loc_size, loc_range.end ());
+    }
+    else
+    {
+      std::copy (loc_range.begin (), loc_range.end (), loc_vector.begin () + loc_begin);
+      loc_vector.erase (loc_vector.begin () + loc_begin + loc_range.size (), loc_vector.begin () + loc_end);
+    }
+  }
+
+  /// @brief **MSH value reader.**
+  /// @details Reads a single value from a MSH stream, either in binary or in ASCII format.
+  template <typename T> T msh_value (
+                                     std::istream& loc_stream                                       ///< MSH file stream.
+                                    )
+  {
+    T loc_value;                                                                                    // Value.
+
+    if(msh_binary)
+    {
+      loc_stream.read ((char*)&loc_value, sizeof (T));                                              // Reading binary value...
+    }
+    else
+    {
+      loc_stream >> loc_value;                                                                      // Reading ASCII value...
+    }
+
+    return loc_value;                                                                               // Returning value...
+  }
+
+  /// @brief **MSH element size function.**
+  /// @details Returns the number of nodes of a given MSH element type, or 0 if the element type
+  /// has a variable number of nodes.
+  size_t msh_element_size (
+                           int loc_element_type                                                     ///< Element type.
+                          );
+
+  /// @brief **MSH section skip function.**
+  /// @details Skips the text lines of a MSH stream up to the end of the current section.
+  void   msh_skip (
+                   std::istream& loc_stream                                                         ///< MSH file stream.
+                  );
+
+  /// @brief **MSH file reader.**
+  /// @details Reads a MSH 4.1 file (ASCII or binary) without using the GMSH API. The $Nodes
+  /// section is parsed by a separate thread, concurrently with the $Elements section.
+  void   msh_read (
+                   std::string loc_file_name                                                        ///< MSH file name.
+                  );
+
+  /// @brief **MSH entities reader.**
+  /// @details Reads the $Entities section, storing the physical tags of each entity.
+  void   msh_entities (
+                       std::istream& loc_stream                                                     ///< MSH file stream.
+                      );
+
+  /// @brief **MSH nodes reader.**
+  /// @details Reads the $Nodes section from the given file position, streaming the node
+  /// coordinates in chunks directly into the "node_coordinates" vector, in file order (compact
+  /// node indices, whatever the node tags). The node tags are stored in "msh_node_tag". Run in
+  /// a separate thread: errors are stored in "msh_node_error", to be reported by the caller.
+  void   msh_nodes (
+                    std::string    loc_file_name,                                                   ///< MSH file name.
+                    std::streampos loc_position                                                     ///< $Nodes section data position.
+                   );
+
+  /// @brief **MSH node renumbering function.**
+  /// @details Converts the element node tags of "msh_element_node" (stored as tag - 1) into
+  /// compact node indices, if the node tags are not the continuous sequence 1, 2, ..., N.
+  void   msh_renumber ();
+
+  /// @brief **MSH nodes skip function.**
+  /// @details Skips the $Nodes section without parsing the node coordinates.
+  void   msh_skip_nodes (
+                         std::istream& loc_stream                                                   ///< MSH file stream.
+                        );
+
+  /// @brief **MSH elements reader.**
+  /// @details Reads the $Elements section, streaming the element node tags in chunks directly
+  /// into the element node vectors (as node indices = tag - 1), one vector per element type.
+  void   msh_elements (
+                       std::istream& loc_stream                                                     ///< MSH file stream.
+                      );
+
+  /// @brief **MSH physical group node function.**
+  /// @details Gets the (sorted) node tags of all the elements belonging to a physical group.
+  void   msh_physical_nodes (
+                             int                  loc_physical_group_tag,                           ///< Physical group tag.
+                             int                  loc_physical_group_dimension,                     ///< Physical group dimension.
+                             std::vector<size_t>& loc_node_tag                                      ///< Node tags.
+                            );
+
 public:
 
   std::vector<GLint>                node;                                                           ///< Node indices (all nodes on physical group).
@@ -249,17 +495,102 @@ public:
   std::vector<GLint>                neighbour_offset;                                               ///< Neighbour offset indices.
   std::vector<nu_float4_structure>  neighbour_link;                                                 ///< Neighbour links.
   std::vector<GLfloat>              neighbour_length;                                               ///< Neighbour link lengths.
+  std::vector<GLfloat>              neighbour_link_packed;                                          ///< Neighbour links, packed float3 (COMPACT modes).
+  std::vector<GLint>                neighbour_local;                                                ///< Neighbour 16-bit local indices, two per entry (COMPACT_16).
+
+  std::vector<GLint>                request_node_offset;                                            ///< Request offset indices in "node" (one per request).
+  std::vector<GLint>                request_element_offset;                                         ///< Request offset indices in "element_offset" (one per request).
+  std::vector<GLint>                request_element_type;                                           ///< Request GMSH element types (one per request, 0 = unknown).
+
+  mesh_change                       changed;                                                        ///< Index ranges changed by the incremental updates.
 
+  /// @brief **Class constructor.**
+  /// @details Reads the mesh file by means of the GMSH API.
   mesh (
         std::string loc_file_name                                                                   ///< GMSH .msh file name.
        );
 
+  /// @brief **Class constructor.**
+  /// @details Reads the mesh file by means of the given mesh reader. The NATIVE reader supports
+  /// MSH 4.1 files (ASCII and binary) and reads all the node coordinates once, here.
+  mesh (
+        std::string loc_file_name,                                                                  ///< GMSH .msh file name.
+        mesh_reader loc_reader                                                                      ///< Mesh reader.
+       );
+
+  /// @brief **Mesh processing function.**
+  /// @details Processes a single (physical group, dimension, element type) request.
   void process (
                 int loc_physical_group_tag,                                                         ///< Physical group tag.
                 int loc_physical_group_dimension,                                                   ///< Physical group dimension.
                 int loc_element_type                                                                ///< Element type.
                );
 
+  /// @brief **Batched mesh processing function.**
+  /// @details Processes a list of (physical group, dimension, element type) requests, sharing a
+  /// single read of the node coordinates. The results of all requests are concatenated in the
+  /// shared arrays ("node", "element", "group", "neighbour", etc...), with global offsets.
+  /// The "r" request spans the "node" indices from request_node_offset[r - 1] (or 0) to
+  /// request_node_offset[r] and the elements from request_element_offset[r - 1] (or 0) to
+  /// request_element_offset[r]. The "group_offset" and "neighbour_offset" arrays follow the
+  /// "node" array.
+  void process (
+                std::vector<mesh_request> loc_request                                               ///< Request list.
+               );
+
+  /// @brief **Topology mode setter.**
+  /// @details Sets the topology mode used by the next mesh processing (default: FULL, with
+  /// links). In COMPACT modes, the "s" neighbour link is stored in "neighbour_link_packed" at
+  /// 3*s, ..., 3*s + 2 (to be read in a kernel by means of "vload3 (s, link)"). If "loc_link" is
+  /// false, no links are stored: they must be recomputed in the kernels from the node
+  /// coordinates. In COMPACT_16 mode, the "s" neighbour local index is:
+  /// (neighbour_local[s >> 1] >> ((s & 1) << 4)) & 0xFFFF
+  /// and the number of nodes of each request must not exceed NU_MESH_LOCAL_16_MAX.
+  void set_topology (
+                     mesh_topology loc_topology,                                                    ///< Topology mode.
+                     bool          loc_link                                                         ///< Link flag.
+                    );
+
+  /// @brief **Neighbour arrays size getter.**
+  /// @details Returns the total size [bytes] of the neighbour arrays of the current topology
+  /// mode, i.e. the memory read by a kernel looping over all neighbours of all nodes.
+  size_t neighbour_bytes ();
+
+  /// @brief **Incremental node add function.**
+  /// @details Adds a node (without elements) to the last request and returns its node index.
+  GLint add_node (
+                  nu_float4_structure loc_coordinates                                               ///< Node coordinates.
+                 );
+
+  /// @brief **Incremental node remove function.**
+  /// @details Removes a node from all requests, together with all the elements containing it.
+  /// Its entry in "node_coordinates" is kept, in order not to renumber the other nodes.
+  void  remove_node (
+                     GLint loc_node                                                                 ///< Node index.
+                    );
+
+  /// @brief **Incremental element add function.**
+  /// @details Adds an element (given by its node indices) to the last request and returns its
+  /// element index. The element nodes not yet in the request are added to it. The group and
+  /// neighbour arrays of the element nodes are patched locally.
+  GLint add_element (
+                     std::vector<GLint> loc_element_node                                            ///< Element node indices.
+                    );
+
+  /// @brief **Incremental element remove function.**
+  /// @details Removes an element: the following elements are renumbered and the group and
+  /// neighbour arrays of the element nodes are patched locally.
+  void  remove_element (
+                        GLint loc_element                                                           ///< Element index.
+                       );
+
+  /// @brief **Change set reset function.**
+  /// @details Empties the "changed" ranges, e.g. after having uploaded them to the client GPU.
+  /// The incremental updates extend the "changed" ranges, which are indices in the current
+  /// arrays. When an array changes its size, its range extends up to the end of the array and
+  /// the corresponding data object must be resized.
+  void  clear_changes ();
+
   ~mesh();
 };
 }
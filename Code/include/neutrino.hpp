@@ -45,6 +45,13 @@
 #define NU_IOD                    0.02f                                                             ///< Intraocular distance.
 #define NU_SCREEN_DISTANCE        -2.5f                                                             ///< Screen distance.
 #define NU_LINE_WIDTH             3                                                                 ///< Line width [px].
+#define NU_CAMERA_BLOCK           "nu_camera"                                                       ///< OpenGL camera uniform block name (std140: mat4 V_mat, mat4 P_mat, float size_x, float size_y, float AR).
+#define NU_CAMERA_BINDING         0                                                                 ///< OpenGL camera uniform block binding point.
+#define NU_STEREO_BLOCK           "nu_stereo"                                                       ///< OpenGL single-pass stereo uniform block name (std140: mat4 V_mat[2], mat4 P_mat[2], float size_x, float size_y, float AR).
+#define NU_STEREO_BINDING         1                                                                 ///< OpenGL single-pass stereo uniform block binding point.
+#define NU_VIEWPORT_LAYER         "GL_ARB_shader_viewport_layer_array"                              ///< OpenGL gl_ViewportIndex in vertex shader extension.
+#define NU_VIEWPORT_INDEX         "GL_AMD_vertex_shader_viewport_index"                             ///< OpenGL gl_ViewportIndex in vertex shader extension (AMD).
+#define NU_SHADER_CACHE           "neutrino/shader_cache"                                           ///< OpenGL program binary cache directory (in the per-user cache directory).
 #define NU_KERNEL_NAME            "thekernel"                                                       ///< OpenCL kernel function name.
 #define NU_MAX_TEXT_SIZE          128                                                               ///< Maximum number of characters in a text string.
 #define NU_MAX_MESSAGE_SIZE       128                                                               ///< Maximum number of characters in a text message.
@@ -62,6 +69,96 @@
 #define NU_GAMEPAD_MIN_PAN_RATE   0.01f                                                             ///< Minimum orbit angular rate [rev/s].
 #define NU_GAMEPAD_MAX_PAN_RATE   10.0f                                                             ///< Maximum orbit angular rate [rev/s].
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// MESH PARAMETERS //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_MSH_VERSION            "4.1"                                                             ///< MSH file format version supported by the native reader.
+#define NU_MSH_CHUNK              65536                                                             ///< MSH native reader chunk size [entries].
+#define NU_MESH_LOCAL_16_MAX      65536                                                             ///< Compact topology: maximum number of nodes per request (16-bit indices).
+#define NU_SPATIAL_LEAF_SIZE      16                                                                ///< Spatial index: maximum number of nodes in an octree leaf.
+#define NU_SPATIAL_MAX_DEPTH      20                                                                ///< Spatial index: maximum octree depth.
+#define NU_SPATIAL_MAX_CELLS      268435456                                                         ///< Spatial index: maximum number of grid cells.
+#define NU_SPATIAL_SCAN_GROUP     256                                                               ///< Spatial index: maximum work-group size of the device cell scan.
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// SYNC PARAMETERS //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_SYNC_TIMEOUT           1000000000                                                        ///< OpenGL fence wait timeout, per attempt [ns].
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// TIMER PARAMETERS //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_GPU_PASSES             3                                                                 ///< OpenGL timer queries: number of pass types (see nu::gpu_pass).
+#define NU_GPU_QUERIES            64                                                                ///< OpenGL timer queries: maximum number of timed passes per frame.
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// DYNAMIC PARAMETERS ////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_DYNAMIC_TARGET         16.0f                                                             ///< Dynamic resolution: default GPU frame time target [ms].
+#define NU_DYNAMIC_MIN_SCALE      0.25f                                                             ///< Dynamic resolution: minimum render scale.
+#define NU_DYNAMIC_STEP           0.05f                                                             ///< Dynamic resolution: render scale quantization step.
+#define NU_DYNAMIC_DEADBAND       0.1f                                                              ///< Dynamic resolution: relative frame time deadband (no rescaling within it).
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// HISTOGRAM PARAMETERS ////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_HISTOGRAM_BITS         6                                                                 ///< Time histograms: sub-bucket bits (relative error < 2^(1 - bits)).
+#define NU_HISTOGRAM_RANGE        40                                                                ///< Time histograms: range bits (maximum time = 2^range ns).
+#define NU_HISTOGRAM_SLICES       10                                                                ///< Time histograms: number of slices in the sliding window.
+#define NU_HISTOGRAM_SLICE        1.0                                                               ///< Time histograms: slice duration [s].
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// PROFILER PARAMETERS ////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_PROFILER_PENDING       256                                                               ///< Profiler: pending GPU zones triggering a non-blocking read back.
+#define NU_PROFILER_HOST_PID      1                                                                 ///< Profiler: trace process ID of the host PC.
+#define NU_PROFILER_GPU_PID       2                                                                 ///< Profiler: trace process ID of the client GPU.
+#define NU_PROFILER_GL_TID        1                                                                 ///< Profiler: trace thread ID of the OpenGL timeline (client GPU).
+#define NU_PROFILER_CL_TID        2                                                                 ///< Profiler: trace thread ID of the OpenCL timeline (client GPU).
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// PACING PARAMETERS /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_PACING_MAX_STEPS       4096                                                              ///< Frame pacing: maximum number of simulation steps per rendered frame.
+#define NU_PACING_INTERVAL        33.0f                                                             ///< Frame pacing: default frame interval [ms].
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// CAPTURE PARAMETERS ////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_CAPTURE_RING           3                                                                 ///< Frame capture: number of PBOs in the ring.
+#define NU_CAPTURE_QUEUE          16                                                                ///< Frame capture: maximum number of frames waiting for the encoder.
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// CULL PARAMETERS //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_CULL_BINDING           13                                                                ///< OpenGL culling SSBO first binding point (3 consecutive: positions, indices, command).
+#define NU_CULL_GROUP_SIZE        256                                                               ///< OpenGL culling compute shader work group size.
+#define NU_CULL_MARGIN            1.1f                                                              ///< OpenGL culling frustum margin (clip space, 1.0 = exact frustum).
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOGFILE PARAMETERS /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_LOGFILE_RING           65536                                                             ///< Async logfile: ring size [records] (power of 2, 16 bytes per record).
+#define NU_LOGFILE_TEXT           12                                                                ///< Async logfile: text bytes per record (longer strings span more records).
+#define NU_LOGFILE_BATCH          1048576                                                           ///< Async logfile: writer batch size [bytes].
+#define NU_LOGFILE_SLEEP          1000                                                              ///< Async logfile: writer idle sleep time [us].
+#define NU_LOGFILE_PARSE_CHUNK    4194304                                                           ///< Mapped logfile parse: minimum range size per thread [bytes].
+#define NU_COLUMNLOG_MAGIC        "NUCOLLOG"                                                        ///< Binary columnar log file magic (8 characters).
+#define NU_COLUMNLOG_FORMAT       1                                                                 ///< Binary columnar log file format version.
+#define NU_COLUMNLOG_CHUNK        65536                                                             ///< Binary columnar log file chunk size [rows].
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// SNAPSHOT PARAMETERS /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_SNAPSHOT_RING          3                                                                 ///< Snapshot: number of pinned staging buffers in the ring.
+#define NU_SNAPSHOT_MAGIC         "NUSNAPSH"                                                        ///< Snapshot file magic (8 characters).
+#define NU_SNAPSHOT_FORMAT        1                                                                 ///< Snapshot file format version.
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// VTK FILE PARAMETERS /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_VTKFILE_CHUNK          65536                                                             ///< VTK file: point coordinates converted per write [points].
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////// Standard C/C++ header files //////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -77,6 +174,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <cerrno>
+#include <cstring>
 #include <algorithm>
 
 #ifdef __APPLE__                                                                                    // Detecting Mac OS...
@@ -99,6 +197,18 @@
 #endif
 
 #include "data_classes.hpp"                                                                         // Neutrino data classes.
+#include "histogram.hpp"                                                                            // Neutrino time histograms.
+
+namespace nu
+{
+// OpenGL timed pass types:
+typedef enum
+{
+  GPU_CLEAR,                                                                                        ///< OpenGL "clear" pass.
+  GPU_PLOT,                                                                                         ///< OpenGL "plot" pass.
+  GPU_GUI                                                                                           ///< OpenGL ImGui render pass.
+} gpu_pass;
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////// "neutrino" class ///////////////////////////////////////
@@ -128,7 +238,23 @@ public:
   static cl_command_queue       queue_id;                                                           ///< @brief **OpenCL queue ID.**
   static std::vector<cl_kernel> kernel_id;                                                          ///< @brief **OpenCL kernel ID array.**
   static GLFWwindow*            glfw_window;                                                        ///< @brief **Window handle.**
+  static bool                   gl_event;                                                           ///< @brief **Use OpenCL events from OpenGL fences (cl_khr_gl_event).**
+  static GLsync                 gl_fence;                                                           ///< @brief **OpenGL fence after the last shared buffer usage.**
+  static cl_event               cl_fence;                                                           ///< @brief **OpenCL event linked to the OpenGL fence.**
   static bool                   init_done;                                                          ///< @brief **init_done flag.**
+  static bool                   gpu_timing;                                                         ///< @brief **OpenGL timer queries allocated flag.**
+  static GLuint                 gpu_query[2][NU_GPU_QUERIES];                                       ///< @brief **OpenGL timer queries (double-buffered).**
+  static nu::gpu_pass           gpu_query_pass[2][NU_GPU_QUERIES];                                  ///< @brief **OpenGL timer query pass types (double-buffered).**
+  static size_t                 gpu_query_count[2];                                                 ///< @brief **OpenGL timer queries issued in the frame (double-buffered).**
+  static size_t                 gpu_slot;                                                           ///< @brief **OpenGL timer queries current frame slot.**
+  static bool                   gpu_open;                                                           ///< @brief **OpenGL timer query open flag.**
+  static double                 gpu_time[NU_GPU_PASSES];                                            ///< @brief **OpenGL GPU time per pass type, in the last completed frame [s].**
+  static bool                   render_dynamic;                                                     ///< @brief **Dynamic resolution flag.**
+  static float                  render_scale;                                                       ///< @brief **Dynamic resolution render scale (1 = full resolution).**
+  static nu::histogram          loop_histogram;                                                     ///< @brief **Loop time histogram.**
+  static nu::histogram          kernel_histogram;                                                   ///< @brief **Kernel time histogram (blocking executions).**
+  static nu::histogram          transfer_histogram;                                                 ///< @brief **Transfer time histogram (read/write).**
+  static std::string            statistics_file;                                                    ///< @brief **Time statistics file name (written at exit).**
 
   /// @brief **Class constructor.**
   /// @details Resets interop, tic, toc, loop_time, context_id, platform_id and device_id to their
@@ -154,9 +280,27 @@ public:
   /// to measure the duration of the host PC processes during the application loop.
   /// This time is also used to manage timing-related operations within the Neutrino GUI, such as
   /// the low-pass filtering of the gamepad inputs.
-  /// It does not measure the execution time of the kernel on the client GPU.
+  /// It does not measure the execution time of the kernel on the client GPU. If the OpenGL timer
+  /// queries are running (see @link gpu_begin @endlink), the GPU times of the clear, plot and GUI
+  /// passes are reported next to the loop time. The loop time is recorded in the loop time
+  /// histogram, whose p50/p99/max over the sliding window are reported as well.
   void        get_toc ();
 
+  /// @brief **Time statistics setter.**
+  /// @details Sets the file the time histograms (loop, kernel and transfer times) are written to
+  /// at the exit of the application.
+  void        set_statistics (
+                              std::string loc_file_name                                             ///< Time statistics file name.
+                             );
+
+  /// @brief **Time statistics writer.**
+  /// @details Writes the time histograms (loop, kernel and transfer times) to a text file. It is
+  /// static: it is also invoked at exit (see @link set_statistics @endlink), without any
+  /// Neutrino object.
+  static void write_statistics (
+                                std::string loc_file_name                                           ///< Time statistics file name.
+                               );
+
   /// @brief **Timestamp function.**
   /// @details Return a time stamp in the format %Y-%b-%d_%H-%M-%S according to the "struct tm", as a string.
   std::string get_timestamp ();
@@ -256,6 +400,55 @@ public:
                                float loc_max                                                        ///< Maximum constraint.
                               );
 
+  /// @brief **OpenGL fence function.**
+  /// @details Inserts an OpenGL fence after the OpenGL commands issued so far (e.g. the draws
+  /// reading the shared buffers). If cl_khr_gl_event is available, an OpenCL event is linked to
+  /// the fence. To be used instead of glFinish, so that the host PC is not blocked.
+  void        fence_gl ();
+
+  /// @brief **OpenGL fence wait function.**
+  /// @details To be used before acquiring the shared buffers in OpenCL. If cl_khr_gl_event is
+  /// available, returns 1 and sets the OpenCL event linked to the OpenGL fence, to be used in
+  /// the wait list of clEnqueueAcquireGLObjects: the wait happens on the client GPU. Otherwise,
+  /// waits on the host PC for the OpenGL fence only (not for the whole OpenGL pipeline) and
+  /// returns 0 (empty wait list).
+  cl_uint     wait_gl (
+                       cl_event* loc_event                                                          ///< OpenCL event linked to the OpenGL fence.
+                      );
+
+  /// @brief **OpenCL fence function.**
+  /// @details To be used after releasing the shared buffers from OpenCL. If cl_khr_gl_event is
+  /// available, it flushes the OpenCL queue: the release implicitly synchronizes with the
+  /// subsequent OpenGL commands. Otherwise, it waits for OpenCL to finish.
+  void        fence_cl ();
+
+  /// @brief **OpenGL timer begin function.**
+  /// @details Starts a GL_TIME_ELAPSED query around the OpenGL commands of a pass (e.g. a plot).
+  /// The queries are double-buffered: the queries issued in a frame are read back only at the end
+  /// of the following frame, hence they never stall the pipeline. The queries are allocated at
+  /// the first call (an OpenGL context is needed). Timed passes cannot be nested.
+  void        gpu_begin (
+                         nu::gpu_pass loc_pass                                                      ///< Pass type.
+                        );
+
+  /// @brief **OpenGL timer end function.**
+  /// @details Ends the GL_TIME_ELAPSED query started by @link gpu_begin @endlink.
+  void        gpu_end ();
+
+  /// @brief **OpenGL timer frame function.**
+  /// @details To be invoked once per frame (it is invoked by opengl::refresh). It swaps the query
+  /// buffers and, if all the queries of the previous frame are available, sums their times per
+  /// pass type and returns "true". If they are not available yet, the previous times are kept
+  /// (no stall) and it returns "false".
+  bool        gpu_frame ();
+
+  /// @brief **OpenGL timer getter.**
+  /// @details Returns the GPU time [s] of a pass type, summed over all the passes of that type
+  /// in the last completed frame.
+  double      get_gpu_time (
+                            nu::gpu_pass loc_pass                                                   ///< Pass type.
+                           );
+
   /// @brief **OpenCL error get function.**
   /// @details Translates an OpenCL numeric error code into a human-readable string.
   std::string get_error (
@@ -11,7 +11,14 @@
 
 // INCLUDES:
   #include "mesh.hpp"                                                                               // Neutrino's mesh context declarations.
+  #include "spatial.hpp"                                                                            // Neutrino's spatial index declarations.
   #include "opengl.hpp"                                                                             // Neutrino's OpenGL context declarations.
+  #include "capture.hpp"                                                                            // Neutrino's frame capture declarations.
+  #include "profiler.hpp"                                                                           // Neutrino's profiler declarations.
   #include "opencl.hpp"                                                                             // Neutrino's OpenCL context declarations.
   #include "imgui.hpp"                                                                              // Neutrino's ImGui context declarations.
+  #include "columnlog.hpp"                                                                          // Neutrino's binary columnar log file declarations.
+  #include "snapshot.hpp"                                                                           // Neutrino's asynchronous snapshot declarations.
+  #include "checkpoint.hpp"                                                                         // Neutrino's checkpoint declarations.
+  #include "vtkfile.hpp"                                                                            // Neutrino's VTK file declarations.
 #endif
@@ -21,6 +21,7 @@
 #include "kernel.hpp"
 #include "data_classes.hpp"
 #include "logfile.hpp"                                                                              // Neutrino's logfile declarations.
+#include "profiler.hpp"                                                                             // Neutrino's profiler declarations.
 
 namespace nu
 {
@@ -11,6 +11,7 @@
 #include "linear_algebra.hpp"
 #include "projective_geometry.hpp"
 #include "logfile.hpp"                                                                              // Neutrino's logfile declarations.
+#include "profiler.hpp"                                                                             // Neutrino's profiler declarations.
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////// IMGUI header files ////////////////////////////////////////
@@ -25,6 +26,42 @@
 #include <implot.h>
 #include <implot_internal.h>
 
+/// @brief    **Data structure. Camera uniform block.**
+/// @details  This structure is used as data storage in the camera uniform buffer. Its layout
+/// matches the std140 layout of the NU_CAMERA_BLOCK uniform block in the GLSL shaders.
+typedef struct _nu_camera_structure
+{
+  GLfloat V_mat[16];                                                                                ///< View matrix.
+  GLfloat P_mat[16];                                                                                ///< Projection matrix.
+  GLfloat size_x;                                                                                   ///< Framebuffer x-size [px_float].
+  GLfloat size_y;                                                                                   ///< Framebuffer y-size [px_float].
+  GLfloat AR;                                                                                       ///< Framebuffer aspect ratio.
+  GLfloat padding;                                                                                  ///< Padding (std140 block size multiple of 16 bytes).
+} nu_camera_structure;
+
+/// @brief    **Data structure. Stereo uniform block.**
+/// @details  This structure is used as data storage in the stereo uniform buffer, for the
+/// single-pass stereo rendering. Its layout matches the std140 layout of the NU_STEREO_BLOCK
+/// uniform block in the GLSL shaders (index 0 = left eye, index 1 = right eye).
+///
+/// A shader is drawn in single-pass stereo (see @link nu::shader::stereo_single @endlink) if it
+/// can write gl_ViewportIndex: a geometry shader source is attached, or the OpenGL context
+/// exposes NU_VIEWPORT_LAYER (or NU_VIEWPORT_INDEX). It is then drawn once with 2 instances: it
+/// must select the eye matrices by means of gl_InstanceID and set gl_ViewportIndex =
+/// gl_InstanceID (in the geometry shader, or in the vertex shader guarded by "#ifdef
+/// GL_ARB_shader_viewport_layer_array" after an "#extension ... : enable" directive). Otherwise,
+/// it is drawn in two passes (one per eye viewport, 1 instance each): both indexes hold the
+/// current eye, hence gl_InstanceID = 0 selects the right matrices.
+typedef struct _nu_stereo_structure
+{
+  GLfloat V_mat[2][16];                                                                             ///< View matrices.
+  GLfloat P_mat[2][16];                                                                             ///< Projection matrices.
+  GLfloat size_x;                                                                                   ///< Framebuffer x-size (one eye) [px_float].
+  GLfloat size_y;                                                                                   ///< Framebuffer y-size [px_float].
+  GLfloat AR;                                                                                       ///< Framebuffer aspect ratio (one eye).
+  GLfloat padding;                                                                                  ///< Padding (std140 block size multiple of 16 bytes).
+} nu_stereo_structure;
+
 namespace nu
 {
 // Projection mode:
@@ -41,6 +78,22 @@ typedef enum
   INVERSE                                                                                           ///< View mode set as inverse (View matrix is inverted).
 } view_mode;
 
+// Render target:
+typedef enum
+{
+  WINDOW,                                                                                           ///< Render target set as visible GLFW window.
+  OFFSCREEN                                                                                         ///< Render target set as offscreen framebuffer (headless).
+} render_target;
+
+// Frame pacing mode:
+typedef enum
+{
+  EVERY_STEP,                                                                                       ///< Frame pacing set as one rendered frame per simulation step.
+  FIXED_STEPS,                                                                                      ///< Frame pacing set as one rendered frame every K simulation steps.
+  FIXED_INTERVAL,                                                                                   ///< Frame pacing set as one rendered frame at most every T ms.
+  ADAPTIVE_STEPS                                                                                    ///< Frame pacing set as one rendered frame every K steps, K adapted to T ms.
+} pacing_mode;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////// "opengl" class ///////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -89,12 +142,112 @@ private:
   GLuint           text_shader;                                                                     ///< @brief **Point shader program.**
   projection_mode  PR_mode;                                                                         ///< @brief **Projection mode.**
   view_mode        VR_mode;                                                                         ///< @brief **View mode.**
+  GLuint           camera_ubo[2];                                                                   ///< @brief **Camera uniform buffers (monocular/left eye, right eye).**
+  nu_camera_structure
+                   camera[2];                                                                       ///< @brief **Camera uniform buffer contents (monocular/left eye, right eye).**
+  GLuint           stereo_ubo;                                                                      ///< @brief **Stereo uniform buffer.**
+  nu_stereo_structure
+                   stereo;                                                                          ///< @brief **Stereo uniform buffer contents.**
+  render_target    target;                                                                          ///< @brief **Render target.**
+  GLuint           offscreen_fbo;                                                                   ///< @brief **Offscreen framebuffer object.**
+  GLuint           offscreen_color;                                                                 ///< @brief **Offscreen color renderbuffer.**
+  GLuint           offscreen_depth;                                                                 ///< @brief **Offscreen depth-stencil renderbuffer.**
+  pacing_mode      pacing;                                                                          ///< @brief **Frame pacing mode.**
+  size_t           pacing_steps;                                                                    ///< @brief **Frame pacing: simulation steps per rendered frame (K).**
+  size_t           pacing_count;                                                                    ///< @brief **Frame pacing: simulation steps since last rendered frame.**
+  double           pacing_interval;                                                                 ///< @brief **Frame pacing: frame interval (T) [s].**
+  double           pacing_last;                                                                     ///< @brief **Frame pacing: last rendered frame time [s].**
+  bool             vsync;                                                                           ///< @brief **Vertical retrace synch (vsync) flag.**
+  GLuint           cull_program;                                                                    ///< @brief **Culling compute program (0 = not built yet).**
+  GLint            cull_V_location;                                                                 ///< @brief **Culling view matrix uniform location.**
+  GLint            cull_P_location;                                                                 ///< @brief **Culling projection matrix uniform location.**
+  GLint            cull_size_location;                                                              ///< @brief **Culling number of nodes uniform location.**
+  GLint            cull_lod_location;                                                               ///< @brief **Culling LOD distance uniform location.**
+  bool             dynamic;                                                                         ///< @brief **Dynamic resolution flag.**
+  bool             dynamic_pending;                                                                 ///< @brief **Dynamic resolution framebuffer bound, waiting to be resolved.**
+  double           dynamic_target;                                                                  ///< @brief **Dynamic resolution: GPU frame time target [s].**
+  GLuint           dynamic_fbo;                                                                     ///< @brief **Dynamic resolution framebuffer object (0 = not allocated yet).**
+  GLuint           dynamic_color;                                                                   ///< @brief **Dynamic resolution color renderbuffer.**
+  GLuint           dynamic_depth;                                                                   ///< @brief **Dynamic resolution depth-stencil renderbuffer.**
+  int              dynamic_size_x;                                                                  ///< @brief **Dynamic resolution framebuffer x-size [px].**
+  int              dynamic_size_y;                                                                  ///< @brief **Dynamic resolution framebuffer y-size [px].**
 
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////// PRIVATE METHODS //////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief **OpenGL camera set method.**
+  /// @details It sets the camera uniform buffer of an eye (0 = monocular/left, 1 = right) and
+  /// binds it to the NU_CAMERA_BINDING binding point. The buffer is uploaded only if its contents
+  /// changed, hence once per eye per frame, independently of the number of shaders.
+  void set_camera (
+                   GLuint      loc_eye,                                                             ///< Eye index.
+                   float       view_matrix[16],                                                     ///< View matrix.
+                   float       projection_matrix[16],                                               ///< Projection matrix.
+                   float       framebuffer_size_x,                                                  ///< Framebuffer x-size [px_float].
+                   float       framebuffer_size_y,                                                  ///< Framebuffer y-size [px_float].
+                   float       framebuffer_AR                                                       ///< Framebuffer aspect ratio.
+                  );
+
+  /// @brief **OpenGL stereo set method.**
+  /// @details It sets the stereo uniform buffer (both eyes) and binds it to the
+  /// NU_STEREO_BINDING binding point. The buffer is uploaded only if its contents changed.
+  void set_stereo (
+                   float       left_view_matrix[16],                                                ///< Left eye view matrix.
+                   float       left_projection_matrix[16],                                          ///< Left eye projection matrix.
+                   float       right_view_matrix[16],                                               ///< Right eye view matrix.
+                   float       right_projection_matrix[16],                                         ///< Right eye projection matrix.
+                   float       framebuffer_size_x,                                                  ///< Framebuffer x-size (one eye) [px_float].
+                   float       framebuffer_size_y,                                                  ///< Framebuffer y-size [px_float].
+                   float       framebuffer_AR                                                       ///< Framebuffer aspect ratio (one eye).
+                  );
+
+  /// @brief **OpenGL culling program builder.**
+  /// @details It builds the culling compute program. It is invoked at the first culling pass.
+  void cull_init ();
+
+  /// @brief **OpenGL culling method.**
+  /// @details It runs the culling compute pass of a shader, writing its compacted index buffer
+  /// and its indirect draw command (with the given number of instances).
+  void cull (
+             nu::shader* loc_shader,                                                                ///< Shader.
+             float       view_matrix[16],                                                           ///< View matrix.
+             float       projection_matrix[16],                                                     ///< Projection matrix.
+             GLuint      loc_instances                                                              ///< Number of instances.
+            );
+
+  /// @brief **OpenGL dynamic resolution bind method.**
+  /// @details It binds the dynamic resolution framebuffer and sets the viewport to its size. The
+  /// framebuffer is (re)allocated whenever the scaled framebuffer size changes. It is bound once
+  /// per frame (by @link clear @endlink, or by the first @link plot @endlink after a @link
+  /// resolve @endlink) and stays bound until @link resolve @endlink.
+  void dynamic_bind ();
+
+  /// @brief **OpenGL dynamic resolution resolve method.**
+  /// @details It upscales the dynamic resolution framebuffer to the window (or offscreen)
+  /// framebuffer, by a linear blit, and binds the latter back.
+  void dynamic_resolve ();
+
+  /// @brief **OpenGL dynamic resolution update method.**
+  /// @details It adapts the render scale to the measured GPU frame time: being the fragment
+  /// load proportional to the number of pixels, the scale is corrected by the square root of the
+  /// ratio between the target and the measured time (halfway, for stability), quantized to
+  /// NU_DYNAMIC_STEP and bounded to NU_DYNAMIC_MIN_SCALE...1.
+  void dynamic_update ();
+
+  /// @brief **OpenGL draw method.**
+  /// @details It issues the draw call of a shader for a given primitive mode: GL_POINTS over
+  /// all nodes (or over the culled nodes, by an indirect draw, if the shader culling is on), or
+  /// GL_LINES/GL_TRIANGLES over the shader element buffers.
+  void draw (
+             nu::shader*        loc_shader,                                                         ///< Shader.
+             nu::primitive_mode loc_primitive,                                                      ///< Primitive mode.
+             GLsizei            loc_instances                                                       ///< Number of instances.
+            );
+
   /// @brief **OpenGL shader set method.**
-  /// @details It sets an OpenGL shader.
+  /// @details It sets an OpenGL shader. Shaders declaring the camera uniform block read the
+  /// camera uniform buffer; for the other ones, the camera uniforms are set at their cached
+  /// locations.
   void set_shader (
                    nu::shader* loc_shader,                                                          ///< Shader.
                    float       view_matrix[16],                                                     ///< View matrix.
@@ -480,6 +633,20 @@ public:
          float       loc_pan_z_initial                                                              ///< Initial pan-z coordinate.
         );
 
+  /// @overload opengl(std::string loc_title, int loc_window_size_x, int loc_window_size_y, float loc_orbit_x_initial, float loc_orbit_y_initial, float loc_pan_x_initial, float loc_pan_y_initial, float loc_pan_z_initial, nu::render_target loc_target)
+  /// @details It selects the render target (see @link init @endlink).
+  opengl(
+         std::string       loc_title,                                                               ///< Window title.
+         int               loc_window_size_x,                                                       ///< Window x-size [px].
+         int               loc_window_size_y,                                                       ///< Window y-size [px].
+         float             loc_orbit_x_initial,                                                     ///< Initial "near clipping-plane" x-coordinate.
+         float             loc_orbit_y_initial,                                                     ///< Initial "near clipping-plane" y-coordinate.
+         float             loc_pan_x_initial,                                                       ///< Initial pan-x coordinate.
+         float             loc_pan_y_initial,                                                       ///< Initial pan-y coordinate.
+         float             loc_pan_z_initial,                                                       ///< Initial pan-z coordinate.
+         nu::render_target loc_target                                                               ///< Render target.
+        );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////////// PUBLIC METHODS //////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -496,10 +663,80 @@ public:
              float       loc_pan_z_initial                                                          ///< Initial pan-x coordinate.
             );
 
+  /// @overload init(std::string loc_title, int loc_window_size_x, int loc_window_size_y, float loc_orbit_x_initial, float loc_orbit_y_initial, float loc_pan_x_initial, float loc_pan_y_initial, float loc_pan_z_initial, nu::render_target loc_target)
+  /// @details Initializes GLFW, GLAD and OpenGL contexts on a given render target. In OFFSCREEN
+  /// mode, the GLFW window is hidden and all graphics are rendered into a framebuffer object of
+  /// the given window size: with GLFW >= 3.4 (NU_GLFW_NULL, set by CMake from the GLFW header,
+  /// and checked again on the GLFW library at run time), the GLFW "null" platform is used
+  /// together with a surfaceless EGL context (or, as a fallback, an OSMesa context), hence no
+  /// display server is needed and Mesa llvmpipe can be used on machines without a GPU; with
+  /// older GLFW versions, a hidden window of the default platform is used. Frames can be saved
+  /// by means of the @link capture @endlink class.
+  void init (
+             std::string       loc_title,                                                           ///< Windows title.
+             int               loc_window_size_x,                                                   ///< Window x-size [px].
+             int               loc_window_size_y,                                                   ///< Window y-size [px].
+             float             loc_orbit_x_initial,                                                 ///< Initial "near clipping-plane" x-coordinate.
+             float             loc_orbit_y_initial,                                                 ///< Initial "near clipping-plane" y-coordinate.
+             float             loc_pan_x_initial,                                                   ///< Initial pan-x coordinate.
+             float             loc_pan_y_initial,                                                   ///< Initial pan-y coordinate.
+             float             loc_pan_z_initial,                                                   ///< Initial pan-z coordinate.
+             nu::render_target loc_target                                                           ///< Render target.
+            );
+
   /// @brief **GUI poll events function.**
   /// @details **Polls GLFW events.** To be inkoved by the user.
   void poll_events ();
 
+  /// @brief **GUI vsync setter.**
+  /// @details Enables or disables the vertical retrace synch (vsync) at runtime. When it is
+  /// enabled, @link refresh @endlink waits for the display (e.g. 16 ms at 60 Hz).
+  void set_vsync (
+                  bool loc_vsync                                                                    ///< Vsync flag.
+                 );
+
+  /// @brief **GUI frame pacing setter.**
+  /// @details Sets the frame pacing, in order to decouple the simulation rate from the render
+  /// rate:
+  /// - **EVERY_STEP**: one frame per simulation step (default).
+  /// - **FIXED_STEPS**: one frame every "loc_steps" simulation steps.
+  /// - **FIXED_INTERVAL**: one frame at most every "loc_interval" ms (the clock is read at each
+  ///   simulation step).
+  /// - **ADAPTIVE_STEPS**: one frame every K simulation steps, where K is adapted at each frame
+  ///   in order to render every "loc_interval" ms: the display stays responsive while the
+  ///   compute throughput is maximized. K starts from "loc_steps" and is bounded to
+  ///   1...NU_PACING_MAX_STEPS.
+  void set_pacing (
+                   nu::pacing_mode loc_mode,                                                        ///< Frame pacing mode.
+                   size_t          loc_steps,                                                       ///< Simulation steps per rendered frame (K).
+                   float           loc_interval                                                     ///< Frame interval (T) [ms].
+                  );
+
+  /// @brief **GUI dynamic resolution setter.**
+  /// @details Enables or disables the dynamic resolution. When it is enabled, @link plot @endlink
+  /// renders into an internal framebuffer, whose size is the framebuffer size multiplied by a
+  /// render scale, which is upscaled to the window once per frame (see @link resolve @endlink). The render scale is adapted at each frame in
+  /// order to hold the GPU frame time (clear, plot and GUI passes, as measured by the OpenGL
+  /// timer queries) close to "loc_target" ms. The render scale is shown in the ImGui overlay.
+  void set_dynamic (
+                    bool  loc_dynamic,                                                              ///< Dynamic resolution flag.
+                    float loc_target                                                                ///< GPU frame time target [ms].
+                   );
+
+  /// @brief **GUI dynamic resolution scale getter.**
+  /// @details Returns the current render scale (1 if the dynamic resolution is off).
+  float get_scale ();
+
+  /// @brief **GUI frame pacing function.**
+  /// @details To be invoked by the user once per simulation step: it returns "true" when the
+  /// current step has to be rendered (i.e. when @link begin @endlink, @link plot @endlink and
+  /// @link end @endlink have to be invoked).
+  bool render ();
+
+  /// @brief **GUI frame pacing steps getter.**
+  /// @details Returns the current number of simulation steps per rendered frame (K).
+  size_t steps ();
+
   /// @brief **Orbit movement.**
   /// @details Rotates the view matrix according to an orbit movement.
   void orbit (
@@ -548,9 +785,18 @@ public:
 
   /// @brief **Clear method.**
   /// @details To be invoked by the user in order to clear the window. It deletes all graphics
-  /// present in the framebuffer.
+  /// present in the framebuffer. With dynamic resolution, it also clears the dynamic resolution
+  /// framebuffer and leaves it bound for the following @link plot @endlink calls.
   void clear ();
 
+  /// @brief **Dynamic resolution resolve method.**
+  /// @details It upscales the dynamic resolution framebuffer to the window (or offscreen)
+  /// framebuffer, once per frame, after the last @link plot @endlink: it is invoked by @link
+  /// imgui::end @endlink before the GUI pass, by @link capture::grab @endlink and by @link
+  /// refresh @endlink (whichever comes first). It does nothing if dynamic resolution is off or if
+  /// the frame has already been resolved.
+  void resolve ();
+
   /// @brief **Begin method.**
   /// @details To be invoked by the user in order to start using OpenGL inside the application loop.
   void begin ();
@@ -567,12 +813,23 @@ public:
              nu::view_mode       loc_vmode                                                          ///< OpenGL view mode.
             );
 
+  /// @overload plot(nu::shader* loc_shader, nu::primitive_mode loc_primitive, nu::projection_mode loc_pmode, nu::view_mode loc_vmode)
+  /// @details Plots graphics in the GUI, choosing the primitive mode. The LINES and TRIANGLES
+  /// modes draw the element buffers previously set by the shader @link setelement @endlink
+  /// method (indexed draw). TO be invoked by the user.
+  void plot (
+             nu::shader*         loc_shader,                                                        ///< OpenGL shader.
+             nu::primitive_mode  loc_primitive,                                                     ///< OpenGL primitive mode.
+             nu::projection_mode loc_pmode,                                                         ///< OpenGL projection mode.
+             nu::view_mode       loc_vmode                                                          ///< OpenGL view mode.
+            );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   ///////////////////////////////////////// PUBLIC RETPOLINES /////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /// @brief **Refresh retpoline.**
   /// @details ** To be invoked by the user in order to refresh the window. It redraws the current
-  /// graphics in the framebuffer. Also automatically invoked by the @link refresh_callback @endlink
+  /// graphics in the framebuffer (in OFFSCREEN mode, it only flushes the OpenGL commands). Also automatically invoked by the @link refresh_callback @endlink
   /// function when the window needs to be refreshed.
   void refresh ();
 
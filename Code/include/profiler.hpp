@@ -0,0 +1,196 @@
+/// @file     profiler.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "profiler" class (hierarchical frame profiler).
+///
+/// @details  The @link neutrino::get_tic @endlink and @link neutrino::get_toc @endlink times
+/// measure the whole host loop only, hence nested phases cannot be timed. The @link profiler
+/// @endlink class records scoped profiling markers (@link zone @endlink objects): each zone
+/// records its begin and end times when it is constructed and destroyed, in a per-thread buffer,
+/// so that nested zones show up as nested slices of their thread. A zone can also be attached to
+/// the OpenGL timeline: in that case, a pair of GL_TIMESTAMP queries is issued around it and the
+/// GPU time of the zone is read back later, without stalling. The OpenCL kernels are attached
+/// to the OpenCL timeline by means of their events (see @link opencl::execute @endlink). When
+/// the profiler is stopped, all the zones are written to a Chrome trace JSON file, which can be
+/// opened by "chrome://tracing" or by Perfetto (https://ui.perfetto.dev).
+///
+/// When the profiler is not running, a zone only checks a flag. The OpenCL timestamps require a
+/// queue created with the CL_QUEUE_PROFILING_ENABLE property: if the profiler is started before
+/// @link opencl::init @endlink, the queue is created with it; otherwise, the queue is recreated
+/// with it (see @link queue::profile @endlink) by the first @link opencl::execute @endlink after
+/// the profiler start. Profiling stays enabled on the queue after the profiler stops.
+
+#ifndef profiler_hpp
+#define profiler_hpp
+
+#include "neutrino.hpp"
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <memory>
+
+namespace nu
+{
+// Profiler tracks:
+typedef enum
+{
+  CPU_TRACK,                                                                                        ///< Zone recorded on the CPU thread timeline only.
+  GL_TRACK                                                                                          ///< Zone recorded on the CPU thread timeline and on the OpenGL timeline.
+} profiler_track;
+
+/// @brief    **Data structure. Profiler event.**
+/// @details  This structure holds a completed zone, as a Chrome trace "complete" event.
+typedef struct _profiler_event
+{
+  std::string name;                                                                                 ///< Zone name.
+  int         pid;                                                                                  ///< Trace process ID (host PC or client GPU).
+  int         tid;                                                                                  ///< Trace thread ID (CPU thread, OpenGL or OpenCL timeline).
+  double      ts;                                                                                   ///< Begin time [us].
+  double      dur;                                                                                  ///< Duration [us].
+} profiler_event;
+
+/// @brief    **Data structure. Profiler thread buffer.**
+/// @details  This structure holds the events recorded by a CPU thread.
+typedef struct _profiler_buffer
+{
+  std::mutex                  lock;                                                                 ///< Buffer lock (only contended when the profiler is stopped).
+  int                         tid;                                                                  ///< Trace thread ID.
+  std::vector<profiler_event> event;                                                                ///< Events.
+} profiler_buffer;
+
+/// @brief    **Data structure. Pending OpenGL zone.**
+/// @details  This structure holds an OpenGL zone whose GL_TIMESTAMP queries are in flight.
+typedef struct _profiler_gl_zone
+{
+  std::string name;                                                                                 ///< Zone name.
+  GLuint      query[2];                                                                             ///< Begin and end GL_TIMESTAMP queries.
+} profiler_gl_zone;
+
+/// @brief    **Data structure. Pending OpenCL zone.**
+/// @details  This structure holds an OpenCL command whose event is still in flight.
+typedef struct _profiler_cl_zone
+{
+  std::string name;                                                                                 ///< Zone name.
+  cl_event    event;                                                                                ///< OpenCL event (retained).
+  double      submit;                                                                               ///< Host time at submission [us].
+} profiler_cl_zone;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "profiler" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class profiler
+/// ### Hierarchical frame profiler.
+/// Declares a hierarchical frame profiler.
+/// To be used for recording a Chrome trace of the application loop.
+class profiler : public neutrino                                                                    /// @brief **Frame profiler.**
+{
+private:
+  static std::string                                   file_name;                                   ///< @brief **Trace file name.**
+  static std::chrono::steady_clock::time_point         origin;                                      ///< @brief **Trace time origin.**
+  static std::mutex                                    lock;                                        ///< @brief **Profiler lock (buffer registry and pending zones).**
+  static std::vector<std::shared_ptr<profiler_buffer> > buffer;                                     ///< @brief **Per-thread buffers.**
+  static std::vector<profiler_gl_zone>                 gl_pending;                                  ///< @brief **Pending OpenGL zones.**
+  static std::vector<GLuint>                           gl_free;                                     ///< @brief **Free GL_TIMESTAMP queries.**
+  static bool                                          gl_calibrated;                               ///< @brief **OpenGL clock calibration flag.**
+  static double                                        gl_offset;                                   ///< @brief **OpenGL clock offset (host - GPU) [us].**
+  static std::vector<profiler_cl_zone>                 cl_pending;                                  ///< @brief **Pending OpenCL zones.**
+
+  /// @brief **Thread buffer getter.**
+  /// @details Returns the buffer of the calling thread, registering it at the first call.
+  static profiler_buffer* local ();
+
+  /// @brief **Pending zones collector.**
+  /// @details Reads back the completed OpenGL and OpenCL zones. If "loc_wait" is true, it waits
+  /// for all of them; otherwise, it skips the zones which are still in flight.
+  static void             collect (
+                                   bool loc_wait                                                    ///< Wait flag.
+                                  );
+
+public:
+  static std::atomic<bool>                             enabled;                                     ///< @brief **Profiler running flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It does nothing.
+  profiler ();
+
+  /// @brief **Profiler start function.**
+  /// @details Clears the recorded zones, resets the trace time origin and starts recording.
+  void                    start (
+                                 std::string loc_file_name                                          ///< Trace file name (.json).
+                                );
+
+  /// @brief **Profiler stop function.**
+  /// @details Stops recording, waits for the pending OpenGL and OpenCL zones and writes the
+  /// Chrome trace JSON file.
+  void                    stop ();
+
+  /// @brief **Host time getter.**
+  /// @details Returns the time since the trace origin [us].
+  static double           now ();
+
+  /// @brief **CPU zone recorder.**
+  /// @details Records a completed zone of the calling thread.
+  static void             cpu (
+                               const char* loc_name,                                                ///< Zone name.
+                               double      loc_begin,                                               ///< Begin time [us].
+                               double      loc_end                                                  ///< End time [us].
+                              );
+
+  /// @brief **OpenGL zone begin function.**
+  /// @details Issues the begin GL_TIMESTAMP query of an OpenGL zone and returns it.
+  static GLuint           gl_begin ();
+
+  /// @brief **OpenGL zone end function.**
+  /// @details Issues the end GL_TIMESTAMP query of an OpenGL zone: the zone is read back later,
+  /// as soon as both its queries are available.
+  static void             gl_end (
+                                  const char* loc_name,                                             ///< Zone name.
+                                  GLuint      loc_query                                             ///< Begin GL_TIMESTAMP query.
+                                 );
+
+  /// @brief **OpenCL zone recorder.**
+  /// @details Attaches an OpenCL command to the OpenCL timeline, by means of its event. To be
+  /// invoked right after the command has been enqueued. The event is retained until its
+  /// profiling timestamps have been read back.
+  static void             cl (
+                              const char* loc_name,                                                 ///< Zone name.
+                              cl_event    loc_event                                                 ///< OpenCL event.
+                             );
+
+  /// @brief **Class destructor.**
+  /// @details Stops the profiler, if still running.
+  ~profiler ();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "zone" class /////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class zone
+/// ### Profiling zone.
+/// Declares a scoped profiling marker.
+/// To be declared as a local variable at the beginning of the scope to be profiled: the zone
+/// begins at its construction and ends at its destruction.
+class zone                                                                                          /// @brief **Profiling zone.**
+{
+private:
+  const char* name;                                                                                 ///< @brief **Zone name.**
+  bool        active;                                                                               ///< @brief **Zone active flag (profiler running at construction).**
+  bool        gl;                                                                                   ///< @brief **OpenGL timeline flag.**
+  GLuint      gl_query;                                                                             ///< @brief **OpenGL zone begin GL_TIMESTAMP query.**
+  double      begin;                                                                                ///< @brief **Begin time [us].**
+
+public:
+  /// @brief **Class constructor.**
+  /// @details Begins the zone, if the profiler is running. The name must be a string literal (or
+  /// must outlive the zone).
+  zone (
+        const char*        loc_name,                                                                ///< Zone name.
+        nu::profiler_track loc_track = CPU_TRACK                                                    ///< Zone track.
+       );
+
+  /// @brief **Class destructor.**
+  /// @details Ends the zone.
+  ~zone ();
+};
+}
+#endif
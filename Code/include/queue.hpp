@@ -20,6 +20,7 @@
 
 #include "neutrino.hpp"
 #include "data_classes.hpp"
+#include "profiler.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////// "queue" class /////////////////////////////////////////////
@@ -37,11 +38,19 @@ public:
   cl_command_queue queue_id;                                                                        ///< @brief **OpenCL queue.**
   cl_context       context_id;                                                                      ///< @brief **OpenCL context.**
   cl_device_id     device_id;                                                                       ///< @brief **OpenCL device id.**
+  bool             profiling;                                                                       ///< @brief **Queue profiling flag (CL_QUEUE_PROFILING_ENABLE).**
 
   /// @brief **Class constructor.**
   /// @details Sets queue_id, context_id and device_id to NULL default values.
   queue ();
 
+  /// @brief **OpenCL queue profiling function.**
+  /// @details Recreates the OpenCL queue with the CL_QUEUE_PROFILING_ENABLE property (the
+  /// property of an existing queue cannot be changed), after finishing all its pending
+  /// commands. It is invoked by @link opencl::execute @endlink when the profiler has been started
+  /// after the queue creation; it does nothing if the queue is already profiled.
+  void profile ();
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////////// "read" functions ///////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,9 @@
 
 #include "neutrino.hpp"
 #include "data_classes.hpp"
+#include "mesh.hpp"
+#include <filesystem>
+#include <array>
 
 namespace nu
 {
@@ -27,6 +30,14 @@ typedef enum
   GEOMETRY                                                                                          ///< GLSL shader interpretation set as geometry.
 } shader_type;
 
+// Primitive modes:
+typedef enum
+{
+  POINTS,                                                                                           ///< Primitive mode set as points (one vertex per node).
+  LINES,                                                                                            ///< Primitive mode set as lines (element edges, indexed).
+  TRIANGLES                                                                                         ///< Primitive mode set as triangles (element faces, indexed).
+} primitive_mode;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////// "shader" class ///////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,35 +47,132 @@ typedef enum
 class shader : public neutrino                                                                      /// @brief **OpenGL nu::shader.**
 {
 private:
+  std::vector<std::string>     source_text;                                                         ///< @brief **Shader sources.**
+  std::vector<nu::shader_type> source_type;                                                         ///< @brief **Shader source types.**
+  std::string                  source_key;                                                          ///< @brief **Shader sources, concatenated (program binary cache key).**
 
   /// @brief    **OpenGL nu::shader compilation.**
-  /// @details  It compiles an OpenGL shader.
+  /// @details  It compiles an OpenGL shader from its source (as loaded by @link addsource @endlink).
   GLuint compile (
-                  std::string     loc_shader_filename,                                              ///< Shader file name.
+                  std::string     loc_shader_source,                                                ///< Shader source.
                   nu::shader_type loc_shader_type                                                   ///< Shader type.
                  );
 
+  /// @brief    **OpenGL program binary cache directory.**
+  /// @details  Returns the per-user cache directory (NU_SHADER_CACHE in $XDG_CACHE_HOME, or in
+  /// $HOME/.cache; in %LOCALAPPDATA% on Windows), creating it with owner-only permissions (0700).
+  /// It returns an empty path (cache disabled) if the directory cannot be located or created,
+  /// or if it is not a private directory of the current user.
+  static std::filesystem::path cache_directory ();
+
+  /// @brief    **OpenGL program binary cache file name.**
+  /// @details  Returns the cache file name of the program, keyed by a hash of the shader sources
+  /// and of the OpenGL renderer and version strings ("" if the cache directory is not available).
+  std::string cache_file ();
+
+  /// @brief    **OpenGL program binary loader.**
+  /// @details  Loads the program binary from the cache. It returns "false" if the binary is not
+  /// present or if the driver rejects it (e.g. binary format mismatch after a driver update).
+  bool   cache_load ();
+
+  /// @brief    **OpenGL program binary saver.**
+  /// @details  Saves the linked program binary into the cache. The binary is written to a
+  /// temporary file, then renamed over the cache file: a crash or a concurrent start never leaves
+  /// a partial binary.
+  void   cache_save ();
+
+  /// @brief    **OpenGL extension check.**
+  /// @details  Returns "true" if the OpenGL context exposes the given extension (queried by
+  /// means of glGetStringi).
+  static bool extension (
+                         const char* loc_extension                                                  ///< OpenGL extension name.
+                        );
+
+  /// @brief    **Element topology getter.**
+  /// @details  Gets the edge table (node pairs) and the face table (node quadruples, -1 = triangle)
+  /// of a first order GMSH element type (line, triangle, quadrangle, tetrahedron, hexahedron,
+  /// prism, pyramid or point). If the element type is unknown (0) or its number of nodes differs
+  /// from the number of element nodes, the type is guessed from the number of element nodes.
+  static void topology (
+                        GLint          loc_element_type,                                            ///< GMSH element type.
+                        size_t         loc_element_nodes,                                           ///< Number of element nodes.
+                        const GLint**  loc_edge,                                                    ///< Edge table.
+                        size_t*        loc_edges,                                                   ///< Number of edges.
+                        const GLint**  loc_face,                                                    ///< Face table.
+                        size_t*        loc_faces,                                                   ///< Number of faces.
+                        bool*          loc_volume                                                   ///< Volume element flag.
+                       );
+
 public:
   GLuint  program;                                                                                  ///< @brief **OpenGL program.**
   GLsizei size;                                                                                     ///< @brief **OpenGL shader argument size.**
+  bool    cache;                                                                                    ///< @brief **Program binary cache flag (default: true).**
+  GLuint  camera_block;                                                                             ///< @brief **Camera uniform block index (GL_INVALID_INDEX if absent).**
+  GLuint  stereo_block;                                                                             ///< @brief **Stereo uniform block index (GL_INVALID_INDEX if absent).**
+  bool    stereo_single;                                                                            ///< @brief **Single-pass stereo flag (NU_STEREO_BLOCK declared, gl_ViewportIndex available).**
+  GLint   V_mat_location;                                                                           ///< @brief **View matrix uniform location (cached).**
+  GLint   P_mat_location;                                                                           ///< @brief **Projection matrix uniform location (cached).**
+  GLint   size_x_location;                                                                          ///< @brief **Framebuffer x-size uniform location (cached).**
+  GLint   size_y_location;                                                                          ///< @brief **Framebuffer y-size uniform location (cached).**
+  GLint   AR_location;                                                                              ///< @brief **Framebuffer aspect ratio uniform location (cached).**
+  GLuint  line_ebo;                                                                                 ///< @brief **Line element buffer (0 if not set).**
+  GLsizei line_size;                                                                                ///< @brief **Line element buffer size [#indices].**
+  GLuint  triangle_ebo;                                                                             ///< @brief **Triangle element buffer (0 if not set).**
+  GLsizei triangle_size;                                                                            ///< @brief **Triangle element buffer size [#indices].**
+  nu::float4*
+          cull_data;                                                                                ///< @brief **Culling node positions (NULL = culling off).**
+  GLfloat cull_lod;                                                                                 ///< @brief **Culling LOD distance (0.0 = LOD off).**
+  GLuint  cull_ebo;                                                                                 ///< @brief **Culling compacted index buffer.**
+  GLuint  cull_command;                                                                             ///< @brief **Culling indirect draw command buffer.**
 
   /// @brief **Class constructor.**
   /// @details It does nothing.
   shader ();
 
   /// @brief **Shader source adder function.**
-  /// @details Loads an OpenGL shader source from its corresponding source file.
+  /// @details Loads an OpenGL shader source from its corresponding source file (read once: the
+  /// same source is used as binary cache key and for compilation). The source is compiled by
+  /// @link build @endlink, only if the program is not found in the binary cache.
   void addsource (
                   std::string     loc_shader_filename,                                              ///< GLSL shader file name.
                   nu::shader_type loc_shader_type                                                   ///< GLSL shader type.
                  );
 
   /// @brief    **OpenGL shader builder.**
-  /// @details  It builds an OpenGL shader.
+  /// @details  It builds an OpenGL shader, by means of the program binary cache if the @link
+  /// cache @endlink flag is set. It binds the NU_CAMERA_BLOCK and NU_STEREO_BLOCK uniform blocks
+  /// (if declared) to the shared uniform buffers, or else caches the plain camera uniform
+  /// locations, and detects single-pass stereo (see @link stereo_single @endlink).
   void build (
               size_t loc_points                                                                     ///< Number of points to be rendered...
              );
 
+  /// @brief    **OpenGL element buffer setter.**
+  /// @details  It builds the line and triangle element buffers of the shader from the mesh
+  /// connectivity, for the indexed LINES and TRIANGLES primitive modes. The element indices are
+  /// node indices: the vertex shader reads its node data by means of gl_VertexID, as for the
+  /// POINTS mode. The edges and faces of each element are given by its GMSH type (see @link
+  /// topology @endlink): the edges shared by adjacent elements are stored once, the faces shared
+  /// by two volume elements (interior faces) are not stored.
+  void setelement (
+                   nu::mesh* loc_mesh                                                               ///< Mesh.
+                  );
+
+  /// @brief    **OpenGL culling setter.**
+  /// @details  It enables the GPU culling of the POINTS primitive mode. Before each draw, a
+  /// compute shader tests the node positions against the view frustum and writes the indices of
+  /// the visible nodes into a compacted index buffer, together with an indirect draw command:
+  /// the points are then drawn by glDrawElementsIndirect, hence the vertex shader still reads
+  /// its node data by means of gl_VertexID and the frame time tracks the visible nodes only.
+  /// If the LOD distance is positive, the nodes farther than it are decimated: a node at
+  /// distance "d" is kept with probability (LOD distance/d)^2, by means of a per-node hash
+  /// (stable from frame to frame). The positions data object must have already been set as a
+  /// kernel argument and the shader must have already been built.
+  void setcull (
+                nu::float4* loc_position,                                                           ///< Node positions.
+                GLfloat     loc_lod_distance                                                        ///< LOD distance (0.0 = LOD off).
+               );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////// setarg "functions" //////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -132,7 +240,7 @@ public:
               );
 
   /// @brief **Class destructor.**
-  /// @details It does nothing.
+  /// @details It deletes the element and culling buffers.
   ~shader ();
 };
 }
@@ -0,0 +1,147 @@
+/// @file     snapshot.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "snapshot" class (asynchronous state snapshots).
+///
+/// @details  Saving the state of a simulation by means of @link opencl::read @endlink stalls the
+/// loop for the whole transfer (each data object is read by a blocking read, between glFinish
+/// and clFinish) and for the whole file write. The @link snapshot @endlink class saves a set of
+/// selected data objects every "period" steps without stalling the loop: each @link take
+/// @endlink call only enqueues non-blocking reads of the OpenCL buffers into a ring of
+/// NU_SNAPSHOT_RING pinned staging buffers (allocated by OpenCL in host memory and mapped once),
+/// then returns. A background thread waits for the reads to complete and streams the staging
+/// buffer to file, directly from the pinned memory. The loop waits only if all the staging
+/// buffers are still waiting to be written (bounded memory).
+///
+/// The file names are "<prefix>_<step>.nus". The binary file layout is (host byte order):
+///
+/// - header: "NUSNAPSH", format, objects, step (64 bit), metadata size (64 bit), metadata
+/// - object: type, layout, size (64 bit), name size, 0, name, data
+///
+/// The header, each object header and each object data are padded to 8 bytes.
+
+#ifndef snapshot_hpp
+#define snapshot_hpp
+
+#include "neutrino.hpp"
+#include "opencl.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <atomic>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "snapshot" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class snapshot
+/// ### Asynchronous snapshot.
+/// Declares an asynchronous snapshot service.
+/// To be used for periodically saving data objects to file, without stalling the loop.
+class snapshot : public neutrino                                                                    /// @brief **Asynchronous snapshot.**
+{
+private:
+  std::string             prefix;                                                                   ///< @brief **File name prefix.**
+  size_t                  period;                                                                   ///< @brief **Snapshot period [steps].**
+  std::vector<nu::data*>  object;                                                                   ///< @brief **Selected data objects.**
+  std::vector<size_t>     offset;                                                                   ///< @brief **Object offsets in the staging buffers [bytes].**
+  std::vector<size_t>     size;                                                                     ///< @brief **Object sizes [bytes].**
+  size_t                  bytes;                                                                    ///< @brief **Staging buffer size [bytes].**
+  std::vector<cl_mem>     staging;                                                                  ///< @brief **Pinned staging buffer ring.**
+  std::vector<char*>      staging_map;                                                              ///< @brief **Mapped staging buffers.**
+  std::vector<cl_event>   event;                                                                    ///< @brief **Staging buffer read events.**
+  std::vector<size_t>     staging_step;                                                             ///< @brief **Staging buffer steps.**
+  std::vector<bool>       busy;                                                                     ///< @brief **Staging buffer busy flags (waiting to be written).**
+  size_t                  head;                                                                     ///< @brief **Staging ring head (next buffer to be filled).**
+  std::thread             writer;                                                                   ///< @brief **Writer thread.**
+  std::mutex              queue_lock;                                                               ///< @brief **Writer queue lock.**
+  std::condition_variable queue_signal;                                                             ///< @brief **Writer queue signal.**
+  std::deque<size_t>      queue;                                                                    ///< @brief **Writer queue (staging buffer indexes).**
+  bool                    stop;                                                                     ///< @brief **Writer stop flag.**
+  std::string             failure;                                                                  ///< @brief **Writer failure: file name ("" = no failure).**
+
+  /// @brief **Staging ring allocator.**
+  /// @details Computes the object offsets and allocates and maps the pinned staging buffers.
+  void        allocate ();
+
+  /// @brief **Writer thread loop.**
+  /// @details Pops the staging buffers from the writer queue, waits for their reads and writes
+  /// them to file. If a file cannot be written, it records the failure, drops the pending
+  /// snapshots and stops: the error is reported by @link check @endlink, on the caller thread.
+  void        write ();
+
+  /// @brief **Writer failure check.**
+  /// @details Exits (on the caller thread) if the writer thread failed to write a file.
+  void        check ();
+
+  /// @brief **Snapshot file writer.**
+  /// @details Writes a staging buffer to file (one write per object, from the pinned memory). It
+  /// returns "false" if the file cannot be written.
+  bool        save (
+                    size_t loc_slot                                                                 ///< Staging ring slot.
+                   );
+
+public:
+  std::atomic<size_t>     written;                                                                  ///< @brief **Number of snapshots written to file.**
+
+  /// @brief **Object locator.**
+  /// @details Gets the OpenCL buffer, the size, the name, the layout and the "ready" flag of a
+  /// data object (also used by @link checkpoint @endlink).
+  static void locate (
+                      nu::data*    loc_data,                                                        ///< Data object.
+                      cl_mem*      loc_buffer,                                                      ///< OpenCL buffer.
+                      size_t*      loc_size,                                                        ///< Object size [bytes].
+                      std::string* loc_name,                                                        ///< Object name.
+                      GLuint*      loc_layout,                                                      ///< Object layout index.
+                      bool*        loc_ready                                                        ///< Object buffer "ready" flag.
+                     );
+
+  /// @brief **Object interoperability function.**
+  /// @details Acquires (or releases) the OpenCL buffer of a data object (also used by @link
+  /// checkpoint @endlink).
+  static void interop (
+                       nu::data* loc_data,                                                          ///< Data object.
+                       bool      loc_acquire                                                        ///< Acquire flag (false = release).
+                      );
+
+  /// @brief **Class constructor.**
+  /// @details Starts the writer thread. The staging ring is allocated at the first snapshot.
+  snapshot (
+            std::string loc_prefix,                                                                 ///< File name prefix (path included).
+            size_t      loc_period                                                                  ///< Snapshot period [steps].
+           );
+
+  /// @brief **Object selector.**
+  /// @details Adds a data object to the snapshot. To be invoked before the first snapshot,
+  /// after the kernel arguments have been set.
+  void        add (
+                   nu::data* loc_data                                                               ///< Data object.
+                  );
+
+  /// @brief **Snapshot function.**
+  /// @details If "loc_step" is a multiple of the period, enqueues the non-blocking reads of the
+  /// selected objects into the staging ring and returns true; otherwise, it returns false. To be
+  /// invoked after @link opencl::execute @endlink, instead of @link opencl::read @endlink: it
+  /// acquires all the objects, enqueues all the reads, then releases all the objects. If
+  /// cl_khr_gl_event is available, the release does not wait; otherwise, the release waits for
+  /// the OpenCL queue to finish (see @link neutrino::fence_cl @endlink), hence for the reads: the
+  /// loop still pays the transfer time, but not the file write. It exits if the writer thread
+  /// failed to write a previous snapshot.
+  bool        take (
+                    size_t loc_step                                                                 ///< Simulation step.
+                   );
+
+  /// @brief **Flush function.**
+  /// @details Waits for all the pending snapshots to be written to file. It exits if the writer
+  /// thread failed to write a snapshot.
+  void        flush ();
+
+  /// @brief **Class destructor.**
+  /// @details Waits for the writer thread to write the pending snapshots and deletes the
+  /// staging ring.
+  ~snapshot ();
+};
+}
+#endif
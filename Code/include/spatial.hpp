@@ -0,0 +1,174 @@
+/// @file     spatial.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "spatial" class (spatial index over mesh nodes).
+///
+/// @details  The topological neighbours of a node are given by the @link mesh @endlink class.
+/// Contact detection, picking and probes need instead the nodes which are geometrically close to
+/// a given point. The @link spatial @endlink class builds a spatial index over a set of node
+/// coordinates (e.g. the "node_coordinates" of a @link mesh @endlink) as a uniform grid (cell
+/// list) or as an octree. The uniform grid can be built either on the host PC or on the client
+/// GPU. The index is stored in CSR (Compressed Sparse Row) arrays, which can be directly copied
+/// into Neutrino data objects and consumed by OpenCL kernels:
+/// - **cell_offset**: cumulative end offset of each cell in the "cell_node" array. The nodes of
+///   the "c" cell are cell_node[b], ..., cell_node[e - 1], where b = cell_offset[c - 1] (or 0 if
+///   c = 0) and e = cell_offset[c].
+/// - **cell_node**: node indices, sorted by cell.
+/// - **node_cell**: cell index of each node.
+///
+/// The "c" cell of a point "p" is c = i + cells_x*(j + cells_y*k), where
+/// i = floor((p.x - origin.x)/cell_size), j = floor((p.y - origin.y)/cell_size) and
+/// k = floor((p.z - origin.z)/cell_size), each one clamped to the grid.
+
+#ifndef spatial_hpp
+#define spatial_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+
+namespace nu
+{
+// Spatial index mode:
+typedef enum
+{
+  GRID,                                                                                             ///< Spatial index as uniform grid (cell list).
+  OCTREE                                                                                            ///< Spatial index as octree.
+} spatial_mode;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "spatial" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class spatial
+/// ### Spatial index.
+/// Declares a spatial index over a set of nodes.
+/// To be used for nearest-neighbour and range queries.
+class spatial : public neutrino                                                                     /// @brief **Spatial index.**
+{
+private:
+  spatial_mode                     mode;                                                            ///< @brief **Spatial index mode.**
+  cl_program                       program;                                                         ///< @brief **Device build program.**
+  cl_kernel                        count_kernel;                                                    ///< @brief **Device build "count" kernel.**
+  cl_kernel                        scan_kernel;                                                     ///< @brief **Device build "scan" kernel.**
+  cl_kernel                        scan_block_kernel;                                               ///< @brief **Device build "scan_block" kernel.**
+  cl_kernel                        scan_add_kernel;                                                 ///< @brief **Device build "scan_add" kernel.**
+  cl_kernel                        scatter_kernel;                                                  ///< @brief **Device build "scatter" kernel.**
+  cl_mem                           count_buffer;                                                    ///< @brief **Device build cell node count buffer.**
+  cl_mem                           rank_buffer;                                                     ///< @brief **Device build node rank buffer.**
+  cl_mem                           block_buffer;                                                    ///< @brief **Device build scan block sum buffer.**
+  size_t                           count_size;                                                      ///< @brief **Device build cell node count buffer size.**
+  size_t                           rank_size;                                                       ///< @brief **Device build node rank buffer size.**
+  size_t                           block_size;                                                      ///< @brief **Device build scan block sum buffer size.**
+  size_t                           scan_group;                                                      ///< @brief **Device build scan work-group size.**
+
+  /// @brief **Octree node builder.**
+  /// @details Recursively splits the "n" octree node in 8 children, sorting its nodes in the
+  /// "cell_node" array.
+  void  octree_split (
+                      size_t loc_octree_node,                                                       ///< Octree node index.
+                      size_t loc_depth                                                              ///< Octree node depth.
+                     );
+
+  /// @brief **Octree radius query.**
+  /// @details Recursively finds the nodes within a given radius from a point.
+  void  octree_radius (
+                       size_t               loc_octree_node,                                        ///< Octree node index.
+                       nu_float4_structure  loc_point,                                              ///< Query point.
+                       GLfloat              loc_radius,                                             ///< Query radius.
+                       std::vector<GLint>&  loc_result                                              ///< Node indices found.
+                      );
+
+  /// @brief **Octree nearest query.**
+  /// @details Recursively finds the nearest node to a point.
+  void  octree_nearest (
+                        size_t              loc_octree_node,                                        ///< Octree node index.
+                        nu_float4_structure loc_point,                                              ///< Query point.
+                        GLint&              loc_nearest,                                            ///< Nearest node index.
+                        GLfloat&            loc_distance                                            ///< Squared distance of nearest node.
+                       );
+
+  /// @brief **Device build program builder.**
+  /// @details Builds the OpenCL program used for building the uniform grid on the client GPU.
+  void  device_init ();
+
+public:
+  nu_float4_structure              origin;                                                          ///< @brief **Grid origin (minimum corner).**
+  GLfloat                          cell_size;                                                       ///< @brief **Grid cell size.**
+  GLint                            cells_x;                                                         ///< @brief **Number of grid cells along "x".**
+  GLint                            cells_y;                                                         ///< @brief **Number of grid cells along "y".**
+  GLint                            cells_z;                                                         ///< @brief **Number of grid cells along "z".**
+
+  std::vector<GLint>               cell_offset;                                                     ///< @brief **Cell offset indices (CSR, cumulative end).**
+  std::vector<GLint>               cell_node;                                                       ///< @brief **Node indices, sorted by cell (CSR).**
+  std::vector<GLint>               node_cell;                                                       ///< @brief **Cell index of each node.**
+  std::vector<nu_float4_structure> cell_coordinates;                                                ///< @brief **Node coordinates, sorted as "cell_node".**
+
+  std::vector<nu_float4_structure> octree_box;                                                      ///< @brief **Octree node box (center "xyz", half size "w").**
+  std::vector<GLint>               octree_child;                                                    ///< @brief **Octree node first child index (8 children, -1 = leaf).**
+  std::vector<nu_int2_structure>   octree_range;                                                    ///< @brief **Octree node range in "cell_node" (begin "x", end "y").**
+
+  /// @brief **Class constructor.**
+  /// @details Resets the grid to a single cell.
+  spatial ();
+
+  /// @brief **Grid domain setter.**
+  /// @details Sets the grid origin and the number of cells from a bounding box and a cell size.
+  /// To be used before a device build, in order to size the "cell_offset" data object.
+  void   domain (
+                 nu_float4_structure loc_min,                                                       ///< Bounding box minimum corner.
+                 nu_float4_structure loc_max,                                                       ///< Bounding box maximum corner.
+                 GLfloat             loc_cell_size                                                  ///< Cell size.
+                );
+
+  /// @brief **Number of cells getter.**
+  /// @details Returns the total number of cells of the grid.
+  size_t cells ();
+
+  /// @brief **Cell index getter.**
+  /// @details Returns the index of the grid cell containing a point (clamped to the grid).
+  GLint  cell (
+               nu_float4_structure loc_point                                                        ///< Point.
+              );
+
+  /// @brief **Host build function.**
+  /// @details Builds the spatial index on the host PC. In GRID mode, the cell size is the grid
+  /// cell size; in OCTREE mode, it is the minimum octree node size.
+  void   build (
+                std::vector<nu_float4_structure>& loc_node,                                         ///< Node coordinates.
+                GLfloat                           loc_cell_size,                                    ///< Cell size.
+                spatial_mode                      loc_mode                                          ///< Spatial index mode.
+               );
+
+  /// @overload build(nu::float4* loc_node, nu::int1* loc_cell_offset, nu::int1* loc_cell_node, nu::int1* loc_node_cell)
+  /// @details Builds the uniform grid on the client GPU, directly into the OpenCL buffers of
+  /// the given data objects (their arguments must have already been set on a kernel). The grid
+  /// domain must have been previously set by the @link domain @endlink method: the
+  /// "loc_cell_offset" data size must be at least the number of @link cells @endlink, while the
+  /// "loc_cell_node" and "loc_node_cell" data sizes must be at least the number of nodes.
+  /// Host queries are not available after a device build, unless the arrays are read back.
+  void   build (
+                nu::float4* loc_node,                                                               ///< Node coordinates.
+                nu::int1*   loc_cell_offset,                                                        ///< Cell offset indices.
+                nu::int1*   loc_cell_node,                                                          ///< Node indices, sorted by cell.
+                nu::int1*   loc_node_cell                                                           ///< Cell index of each node.
+               );
+
+  /// @brief **Radius query.**
+  /// @details Finds all nodes within a given radius from a point.
+  void   radius (
+                 nu_float4_structure loc_point,                                                     ///< Query point.
+                 GLfloat             loc_radius,                                                    ///< Query radius.
+                 std::vector<GLint>& loc_result                                                     ///< Node indices found.
+                );
+
+  /// @brief **Nearest query.**
+  /// @details Returns the index of the node nearest to a point (-1 if the index is empty).
+  GLint  nearest (
+                  nu_float4_structure loc_point                                                     ///< Query point.
+                 );
+
+  /// @brief **Class destructor.**
+  /// @details Releases the device build OpenCL objects.
+  ~spatial ();
+};
+}
+#endif
@@ -0,0 +1,123 @@
+/// @file     vtkfile.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "vtkfile" class (VTK unstructured grid time series).
+///
+/// @details  The @link vtkfile @endlink class writes the topology of a @link mesh @endlink
+/// ("node_coordinates", "element", "element_offset") and a set of selected @link float1
+/// @endlink and @link float4 @endlink fields as a time series of VTK XML unstructured grid files
+/// ("<prefix>_<number>.vtu"), collected by a ParaView data file ("<prefix>.pvd").
+///
+/// The arrays are stored in the appended section of each file, as raw binary data (host byte
+/// order, 64 bit block sizes): the element nodes, the element offsets and the fields are
+/// written directly from the host vectors, without intermediate copies; only the node
+/// coordinates (4 to 3 components) and the cell types are converted, NU_VTKFILE_CHUNK values
+/// at a time. A field is written as point data if its size is the number of node coordinates,
+/// or as cell data if its size is the number of elements. The @link float4 @endlink fields
+/// keep their 4 components.
+///
+/// The cell types are given by the GMSH element types of the mesh requests (first order
+/// elements and points). For the elements of unknown type (incremental updates), or whose number
+/// of nodes does not match the type of their request, the cell type is guessed from the number of
+/// element nodes (a 4-node element is guessed as a quadrangle). The field names and the file
+/// names are escaped in the XML attributes. The collection file is rewritten at each step: it is
+/// always valid, even if the simulation is interrupted.
+
+#ifndef vtkfile_hpp
+#define vtkfile_hpp
+
+#include "neutrino.hpp"
+#include "mesh.hpp"
+#include "profiler.hpp"
+#include <cstdint>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "vtkfile" class ////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class vtkfile
+/// ### VTK unstructured grid time series.
+/// Declares a VTK unstructured grid time series.
+/// To be used for post-processing simulation results in ParaView.
+class vtkfile : public neutrino                                                                     /// @brief **VTK unstructured grid time series.**
+{
+private:
+  std::string              prefix;                                                                  ///< @brief **File name prefix.**
+  std::vector<std::string> field_name;                                                              ///< @brief **Field names.**
+  std::vector<nu::data*>   field;                                                                   ///< @brief **Fields (float1 or float4).**
+  std::vector<double>      series_time;                                                             ///< @brief **Time series: times.**
+  std::vector<std::string> series_file;                                                             ///< @brief **Time series: file names (no path).**
+
+  /// @brief **Cell type getter.**
+  /// @details Returns the VTK cell type of a GMSH element type, or 0 if it is not supported. If
+  /// the element type is unknown (0) or its number of nodes differs from the number of element
+  /// nodes (incremental element added to a request of a different type), the cell type is
+  /// guessed from the number of element nodes.
+  static uint8_t     cell_type (
+                                GLint  loc_element_type,                                            ///< GMSH element type.
+                                size_t loc_element_nodes                                            ///< Number of element nodes.
+                               );
+
+  /// @brief **XML escape function.**
+  /// @details Returns a text escaped for an XML attribute value (& < > " ').
+  static std::string escape (
+                             std::string loc_text                                                   ///< Text.
+                            );
+
+  /// @brief **Field getter.**
+  /// @details Gets the host data, the number of values and the number of components of a field.
+  static void        get_field (
+                                nu::data*     loc_data,                                             ///< Field.
+                                const char**  loc_value,                                            ///< Field host data.
+                                size_t*       loc_size,                                             ///< Number of values.
+                                size_t*       loc_components                                        ///< Number of components.
+                               );
+
+  /// @brief **Block write method.**
+  /// @details Writes an appended data block (64 bit size, then data) on a VTU file.
+  static void        block (
+                            std::ofstream& loc_file,                                                ///< VTU file.
+                            const void*    loc_data,                                                ///< Block data.
+                            uint64_t       loc_size                                                 ///< Block size [bytes].
+                           );
+
+  /// @brief **Collection write method.**
+  /// @details Rewrites the ParaView data file of the time series.
+  void               collection ();
+
+public:
+  /// @brief **Class constructor.**
+  /// @details Sets the file name prefix of the time series (path included).
+  vtkfile (
+           std::string loc_prefix                                                                   ///< File name prefix.
+          );
+
+  /// @brief **Field selector.**
+  /// @details Adds a **float1** field (1 component) to the time series.
+  void               add (
+                          std::string  loc_name,                                                    ///< Field name.
+                          nu::float1*  loc_data                                                     ///< Field.
+                         );
+
+  /// @details Adds a **float4** field (4 components) to the time series.
+  void               add (
+                          std::string  loc_name,                                                    ///< Field name.
+                          nu::float4*  loc_data                                                     ///< Field.
+                         );
+
+  /// @brief **Write method.**
+  /// @details Writes the mesh topology and the selected fields (from their host vectors: see
+  /// @link opencl::read @endlink) as a new VTU file of the time series, and updates the
+  /// collection file.
+  void               write (
+                            nu::mesh* loc_mesh,                                                     ///< Mesh.
+                            double    loc_time                                                      ///< Simulation time.
+                           );
+
+  /// @brief **Class destructor.**
+  /// @details It does nothing.
+  ~vtkfile ();
+};
+}
+#endif
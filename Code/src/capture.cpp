@@ -0,0 +1,482 @@
+/// @file     capture.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "capture" class (asynchronous frame export).
+
+#include "capture.hpp"
+
+// CRC-32 (PNG chunk checksum):
+static uint32_t nu_capture_crc (
+                                const unsigned char* loc_data,                                      // Data.
+                                size_t               loc_size,                                      // Data size.
+                                uint32_t             loc_crc                                        // Previous CRC (0 at start).
+                               )
+{
+  static uint32_t loc_table[256];                                                                   // CRC table.
+  static bool     loc_table_done = false;                                                           // CRC table flag.
+  uint32_t        loc_c;                                                                            // CRC table entry.
+  size_t          i;                                                                                // Index.
+  size_t          j;                                                                                // Bit index.
+
+  if(!loc_table_done)
+  {
+    for(i = 0; i < 256; i++)
+    {
+      loc_c = (uint32_t)i;                                                                          // Initializing entry...
+
+      for(j = 0; j < 8; j++)
+      {
+        loc_c = (loc_c & 1) ? (0xEDB88320u ^ (loc_c >> 1)) : (loc_c >> 1);                          // Computing entry...
+      }
+
+      loc_table[i] = loc_c;                                                                         // Setting entry...
+    }
+
+    loc_table_done = true;                                                                          // Setting CRC table flag...
+  }
+
+  loc_crc = loc_crc ^ 0xFFFFFFFFu;                                                                  // Initializing CRC...
+
+  for(i = 0; i < loc_size; i++)
+  {
+    loc_crc = loc_table[(loc_crc ^ loc_data[i]) & 0xFF] ^ (loc_crc >> 8);                           // Updating CRC...
+  }
+
+  return loc_crc ^ 0xFFFFFFFFu;                                                                     // Returning CRC...
+}
+
+// Big-endian 32-bit writer:
+static void nu_capture_put (
+                            std::vector<unsigned char>& loc_buffer,                                 // Buffer.
+                            uint32_t                    loc_value                                   // Value.
+                           )
+{
+  loc_buffer.push_back ((unsigned char)(loc_value >> 24));                                          // Writing byte 3...
+  loc_buffer.push_back ((unsigned char)(loc_value >> 16));                                          // Writing byte 2...
+  loc_buffer.push_back ((unsigned char)(loc_value >> 8));                                           // Writing byte 1...
+  loc_buffer.push_back ((unsigned char)(loc_value));                                                // Writing byte 0...
+}
+
+// PNG chunk writer:
+static void nu_capture_chunk (
+                              std::ofstream&              loc_file,                                 // File.
+                              const char*                 loc_type,                                 // Chunk type.
+                              std::vector<unsigned char>& loc_data                                  // Chunk data.
+                             )
+{
+  std::vector<unsigned char> loc_chunk;                                                             // Chunk.
+
+  nu_capture_put (loc_chunk, (uint32_t)loc_data.size ());                                           // Writing chunk length...
+  loc_chunk.insert (loc_chunk.end (), loc_type, loc_type + 4);                                      // Writing chunk type...
+  loc_chunk.insert (loc_chunk.end (), loc_data.begin (), loc_data.end ());                          // Writing chunk data...
+  nu_capture_put (loc_chunk, nu_capture_crc (loc_chunk.data () + 4, loc_chunk.size () - 4, 0));     // Writing chunk CRC (type and data)...
+  loc_file.write ((const char*)loc_chunk.data (), loc_chunk.size ());                               // Writing chunk...
+}
+
+nu::capture::capture (
+                      std::string    loc_prefix,                                                    // File name prefix (path included).
+                      capture_format loc_format                                                     // File format.
+                     )
+{
+  neutrino::action ("initializing frame capture...");                                               // Printing message...
+
+  prefix  = loc_prefix;                                                                             // Initializing file name prefix...
+  format  = loc_format;                                                                             // Initializing file format...
+  head    = 0;                                                                                      // Initializing PBO ring head...
+  frame   = 0;                                                                                      // Initializing frame number...
+  size_x  = 0;                                                                                      // Initializing PBO frame x-size...
+  size_y  = 0;                                                                                      // Initializing PBO frame y-size...
+  stop    = false;                                                                                  // Initializing encoder stop flag...
+  failure = "";                                                                                     // Initializing capture failure...
+  written = 0;                                                                                      // Initializing number of frames written...
+  encoder = std::thread (&nu::capture::encode, this);                                               // Starting encoder thread...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+bool nu::capture::collect (
+                           size_t loc_slot,                                                         // PBO ring slot.
+                           bool   loc_wait                                                          // Wait flag.
+                          )
+{
+  GLenum        loc_status;                                                                         // Fence status.
+  capture_frame loc_frame;                                                                          // Frame.
+  size_t        loc_size;                                                                           // Frame size [bytes].
+  void*         loc_map;                                                                            // Mapped PBO.
+
+  if(fence[loc_slot] == NULL)
+  {
+    return true;                                                                                    // PBO free...
+  }
+
+  do
+  {
+    loc_status = glClientWaitSync (
+                                   fence[loc_slot],
+                                   GL_SYNC_FLUSH_COMMANDS_BIT,
+                                   loc_wait ? NU_SYNC_TIMEOUT : 0
+                                  );                                                                // Checking transfer...
+  }
+  while(loc_wait && (loc_status == GL_TIMEOUT_EXPIRED));
+
+  if(loc_status == GL_TIMEOUT_EXPIRED)
+  {
+    return false;                                                                                   // Transfer in progress...
+  }
+
+  glDeleteSync (fence[loc_slot]);                                                                   // Deleting fence...
+  fence[loc_slot]  = NULL;                                                                          // Freeing PBO...
+
+  if(loc_status == GL_WAIT_FAILED)
+  {
+    fail ("unable to read capture frame " + std::to_string (pbo_frame[loc_slot]) + " (fence wait)");
+    return true;                                                                                    // Frame dropped...
+  }
+
+  loc_size         = (size_t)size_x*(size_t)size_y*4;                                               // Computing frame size [bytes]...
+  loc_frame.number = pbo_frame[loc_slot];                                                           // Setting frame number...
+  loc_frame.size_x = size_x;                                                                        // Setting frame x-size...
+  loc_frame.size_y = size_y;                                                                        // Setting frame y-size...
+  loc_frame.pixel.resize (loc_size);                                                                // Allocating frame pixels...
+
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, pbo[loc_slot]);                                               // Binding PBO...
+  loc_map          = glMapBufferRange (GL_PIXEL_PACK_BUFFER, 0, loc_size, GL_MAP_READ_BIT);         // Mapping PBO...
+
+  if(loc_map == NULL)
+  {
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);                                                         // Unbinding PBO...
+    fail ("unable to read capture frame " + std::to_string (pbo_frame[loc_slot]) + " (PBO map)");
+    return true;                                                                                    // Frame dropped...
+  }
+
+  memcpy (loc_frame.pixel.data (), loc_map, loc_size);                                              // Copying frame pixels...
+  glUnmapBuffer (GL_PIXEL_PACK_BUFFER);                                                             // Unmapping PBO...
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);                                                           // Unbinding PBO...
+
+  // Pushing frame to encoder queue (waiting if the encoder is too late, dropping it if it failed):
+  std::unique_lock<std::mutex> loc_lock (queue_lock);
+  queue_signal.wait (
+                     loc_lock,
+                     [this] {return !failure.empty () || (queue.size () < NU_CAPTURE_QUEUE);}
+                    );                                                                              // Waiting for encoder queue room...
+
+  if(failure.empty ())
+  {
+    queue.push_back (std::move (loc_frame));                                                        // Pushing frame...
+  }
+
+  loc_lock.unlock ();                                                                               // Unlocking encoder queue...
+  queue_signal.notify_all ();                                                                       // Signaling encoder...
+
+  return true;                                                                                      // Frame collected...
+}
+
+void nu::capture::grab (
+                        nu::opengl* loc_gui                                                         // OpenGL GUI.
+                       )
+{
+  size_t i;                                                                                         // PBO index.
+
+  check ();                                                                                         // Checking capture failure...
+  loc_gui->resolve ();                                                                              // Resolving dynamic resolution framebuffer...
+
+  // (Re)allocating PBO ring on framebuffer size change:
+  if((loc_gui->framebuffer_size_x != size_x) || (loc_gui->framebuffer_size_y != size_y))
+  {
+    flush ();                                                                                       // Collecting pending frames...
+
+    if(pbo.size () == 0)
+    {
+      pbo.resize (NU_CAPTURE_RING);                                                                 // Allocating PBO ring...
+      fence.assign (NU_CAPTURE_RING, NULL);                                                         // Allocating PBO ring fences...
+      pbo_frame.assign (NU_CAPTURE_RING, 0);                                                        // Allocating PBO ring frame numbers...
+      glGenBuffers (NU_CAPTURE_RING, pbo.data ());                                                  // Generating PBOs...
+    }
+
+    size_x = loc_gui->framebuffer_size_x;                                                           // Setting PBO frame x-size...
+    size_y = loc_gui->framebuffer_size_y;                                                           // Setting PBO frame y-size...
+
+    for(i = 0; i < pbo.size (); i++)
+    {
+      glBindBuffer (GL_PIXEL_PACK_BUFFER, pbo[i]);                                                  // Binding PBO...
+      glBufferData (
+                    GL_PIXEL_PACK_BUFFER,                                                           // Buffer target.
+                    (size_t)size_x*(size_t)size_y*4,                                                // Buffer size.
+                    NULL,                                                                           // Buffer data.
+                    GL_STREAM_READ                                                                  // Buffer usage.
+                   );
+    }
+
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);                                                         // Unbinding PBO...
+  }
+
+  // Collecting the oldest frame, if the ring is full:
+  collect (head, true);
+
+  // Starting asynchronous transfer:
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, pbo[head]);                                                   // Binding PBO...
+  glPixelStorei (GL_PACK_ALIGNMENT, 1);                                                             // Setting tight row packing...
+  glReadPixels (0, 0, size_x, size_y, GL_RGBA, GL_UNSIGNED_BYTE, 0);                                // Reading pixels into PBO...
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);                                                           // Unbinding PBO...
+  fence[head]     = glFenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);                                 // Fencing transfer...
+  pbo_frame[head] = frame;                                                                          // Setting frame number...
+  frame++;                                                                                          // Incrementing frame number...
+  head            = (head + 1)%pbo.size ();                                                         // Advancing PBO ring head...
+
+  // Collecting completed frames, from the oldest one (without waiting):
+  for(i = 0; i < pbo.size (); i++)
+  {
+    if(!collect ((head + i)%pbo.size (), false))
+    {
+      break;                                                                                        // Transfer in progress...
+    }
+  }
+}
+
+void nu::capture::flush ()
+{
+  size_t i;                                                                                         // PBO index.
+
+  for(i = 0; i < pbo.size (); i++)
+  {
+    collect ((head + i)%pbo.size (), true);                                                         // Collecting frame...
+  }
+
+  check ();                                                                                         // Checking capture failure...
+}
+
+void nu::capture::check ()
+{
+  std::string loc_failure;                                                                          // Capture failure.
+
+  {
+    std::lock_guard<std::mutex> loc_lock (queue_lock);
+    loc_failure = failure;                                                                          // Getting capture failure...
+  }
+
+  if(!loc_failure.empty ())
+  {
+    neutrino::error (loc_failure + "!");                                                            // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+void nu::capture::fail (
+                        std::string loc_failure                                                     // Failure message.
+                       )
+{
+  {
+    std::lock_guard<std::mutex> loc_lock (queue_lock);
+
+    if(failure.empty ())
+    {
+      failure = loc_failure;                                                                        // Setting first failure...
+    }
+
+    queue.clear ();                                                                                 // Dropping pending frames...
+  }
+
+  queue_signal.notify_all ();                                                                       // Signaling queue room...
+}
+
+void nu::capture::encode ()
+{
+  capture_frame loc_frame;                                                                          // Frame.
+  std::string   loc_number;                                                                         // Frame number string.
+  std::string   loc_file_name;                                                                      // File name.
+  bool          loc_written;                                                                        // File written flag.
+
+  while(true)
+  {
+    // Popping frame from encoder queue:
+    std::unique_lock<std::mutex> loc_lock (queue_lock);
+    queue_signal.wait (loc_lock, [this] {return stop || !queue.empty ();});                         // Waiting for frames...
+
+    if(queue.empty ())
+    {
+      break;                                                                                        // Stopping encoder...
+    }
+
+    loc_frame = std::move (queue.front ());                                                         // Popping frame...
+    queue.pop_front ();
+    loc_lock.unlock ();                                                                             // Unlocking encoder queue...
+    queue_signal.notify_all ();                                                                     // Signaling queue room...
+
+    loc_number = std::to_string (loc_frame.number);                                                 // Building frame number...
+    loc_number = std::string (loc_number.size () < 6 ? 6 - loc_number.size () : 0, '0') + loc_number;
+
+    loc_written = false;                                                                            // Resetting file written flag...
+
+    switch(format)
+    {
+      case PNG:
+        loc_file_name = prefix + "_" + loc_number + ".png";                                         // Building file name...
+        loc_written   = write_png (loc_frame, loc_file_name);                                       // Writing PNG file...
+        break;
+
+      case RAW:
+        loc_file_name = prefix + "_" + loc_number + "_" +
+                        std::to_string (loc_frame.size_x) + "x" +
+                        std::to_string (loc_frame.size_y) + ".raw";                                 // Building file name...
+        loc_written   = write_raw (loc_frame, loc_file_name);                                       // Writing RAW file...
+        break;
+    }
+
+    // Recording failure for the render thread (no exit from the encoder thread):
+    if(!loc_written)
+    {
+      fail ("unable to write capture file " + loc_file_name);                                       // Setting encoder failure...
+      break;                                                                                        // Stopping encoder...
+    }
+
+    written++;                                                                                      // Counting frames written...
+  }
+}
+
+bool nu::capture::write_png (
+                             capture_frame& loc_frame,                                              // Frame.
+                             std::string    loc_file_name                                           // File name.
+                            )
+{
+  std::ofstream              loc_file;                                                              // File.
+  std::vector<unsigned char> loc_header;                                                            // IHDR chunk data.
+  std::vector<unsigned char> loc_image;                                                             // Filtered image data.
+  std::vector<unsigned char> loc_data;                                                              // IDAT chunk data (zlib stream).
+  std::vector<unsigned char> loc_end;                                                               // IEND chunk data.
+  size_t                     loc_row;                                                               // Row size [bytes].
+  size_t                     loc_block;                                                             // Deflate block size [bytes].
+  size_t                     loc_offset;                                                            // Deflate block offset [bytes].
+  uint32_t                   loc_a;                                                                 // Adler-32 "a" sum.
+  uint32_t                   loc_b;                                                                 // Adler-32 "b" sum.
+  int                        y;                                                                     // Row index.
+  size_t                     i;                                                                     // Byte index.
+  const unsigned char        loc_signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};                  // PNG signature.
+
+  loc_row = (size_t)loc_frame.size_x*4;                                                             // Computing row size...
+
+  // Filtering image (filter type 0, rows from top to bottom):
+  for(y = loc_frame.size_y - 1; y >= 0; y--)
+  {
+    loc_image.push_back (0);                                                                        // Adding row filter type...
+    loc_image.insert (
+                      loc_image.end (),
+                      loc_frame.pixel.begin () + (size_t)y*loc_row,
+                      loc_frame.pixel.begin () + (size_t)(y + 1)*loc_row
+                     );                                                                             // Adding row...
+  }
+
+  // Building zlib stream (stored deflate blocks):
+  loc_data.push_back (0x78);                                                                        // Adding zlib CMF...
+  loc_data.push_back (0x01);                                                                        // Adding zlib FLG...
+  loc_offset = 0;                                                                                   // Resetting block offset...
+
+  do
+  {
+    loc_block  = std::min (loc_image.size () - loc_offset, (size_t)65535);                          // Computing block size...
+    loc_data.push_back ((loc_offset + loc_block == loc_image.size ()) ? 1 : 0);                     // Adding block header (BFINAL, BTYPE = 00)...
+    loc_data.push_back ((unsigned char)(loc_block & 0xFF));                                         // Adding LEN (low byte)...
+    loc_data.push_back ((unsigned char)(loc_block >> 8));                                           // Adding LEN (high byte)...
+    loc_data.push_back ((unsigned char)(~loc_block & 0xFF));                                        // Adding NLEN (low byte)...
+    loc_data.push_back ((unsigned char)((~loc_block >> 8) & 0xFF));                                 // Adding NLEN (high byte)...
+    loc_data.insert (
+                     loc_data.end (),
+                     loc_image.begin () + loc_offset,
+                     loc_image.begin () + loc_offset + loc_block
+                    );                                                                              // Adding block data...
+    loc_offset += loc_block;                                                                        // Advancing block offset...
+  }
+  while(loc_offset < loc_image.size ());
+
+  loc_a = 1;                                                                                        // Initializing Adler-32 "a" sum...
+  loc_b = 0;                                                                                        // Initializing Adler-32 "b" sum...
+
+  for(i = 0; i < loc_image.size (); i++)
+  {
+    loc_a = (loc_a + loc_image[i])%65521;                                                           // Updating Adler-32 "a" sum...
+    loc_b = (loc_b + loc_a)%65521;                                                                  // Updating Adler-32 "b" sum...
+  }
+
+  nu_capture_put (loc_data, (loc_b << 16) | loc_a);                                                 // Adding Adler-32 checksum...
+
+  // Building header (8-bit RGBA, no interlace):
+  nu_capture_put (loc_header, (uint32_t)loc_frame.size_x);                                          // Adding width...
+  nu_capture_put (loc_header, (uint32_t)loc_frame.size_y);                                          // Adding height...
+  loc_header.push_back (8);                                                                         // Adding bit depth...
+  loc_header.push_back (6);                                                                         // Adding color type (RGBA)...
+  loc_header.push_back (0);                                                                         // Adding compression method...
+  loc_header.push_back (0);                                                                         // Adding filter method...
+  loc_header.push_back (0);                                                                         // Adding interlace method...
+
+  loc_file.open (loc_file_name, std::ios::out | std::ios::binary);                                  // Opening file...
+
+  if(!loc_file.is_open ())
+  {
+    return false;                                                                                   // Returning failure...
+  }
+
+  loc_file.write ((const char*)loc_signature, 8);                                                   // Writing PNG signature...
+  nu_capture_chunk (loc_file, "IHDR", loc_header);                                                  // Writing header...
+  nu_capture_chunk (loc_file, "IDAT", loc_data);                                                    // Writing image data...
+  nu_capture_chunk (loc_file, "IEND", loc_end);                                                     // Writing end...
+  loc_file.close ();                                                                                // Closing file...
+
+  return !loc_file.fail ();                                                                         // Returning write status...
+}
+
+bool nu::capture::write_raw (
+                             capture_frame& loc_frame,                                              // Frame.
+                             std::string    loc_file_name                                           // File name.
+                            )
+{
+  std::ofstream loc_file;                                                                           // File.
+  size_t        loc_row;                                                                            // Row size [bytes].
+  int           y;                                                                                  // Row index.
+
+  loc_row = (size_t)loc_frame.size_x*4;                                                             // Computing row size...
+  loc_file.open (loc_file_name, std::ios::out | std::ios::binary);                                  // Opening file...
+
+  if(!loc_file.is_open ())
+  {
+    return false;                                                                                   // Returning failure...
+  }
+
+  // Writing rows from top to bottom:
+  for(y = loc_frame.size_y - 1; y >= 0; y--)
+  {
+    loc_file.write ((const char*)loc_frame.pixel.data () + (size_t)y*loc_row, loc_row);             // Writing row...
+  }
+
+  loc_file.close ();                                                                                // Closing file...
+
+  return !loc_file.fail ();                                                                         // Returning write status...
+}
+
+nu::capture::~capture ()
+{
+  size_t i;                                                                                         // PBO index.
+
+  // Collecting pending frames (no exit from the destructor: the failure is reported below):
+  for(i = 0; i < pbo.size (); i++)
+  {
+    collect ((head + i)%pbo.size (), true);                                                         // Collecting frame...
+  }
+
+  // Stopping encoder thread:
+  {
+    std::lock_guard<std::mutex> loc_lock (queue_lock);
+    stop = true;                                                                                    // Setting encoder stop flag...
+  }
+
+  queue_signal.notify_all ();                                                                       // Signaling encoder...
+  encoder.join ();                                                                                  // Waiting for encoder to write all frames...
+
+  if(!failure.empty ())
+  {
+    neutrino::error (failure + "!");                                                                // Printing message...
+  }
+
+  if(pbo.size () > 0)
+  {
+    glDeleteBuffers ((GLsizei)pbo.size (), pbo.data ());                                            // Deleting PBOs...
+  }
+}
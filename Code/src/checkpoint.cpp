@@ -0,0 +1,359 @@
+/// @file     checkpoint.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "checkpoint" class (simulation checkpoint and restart).
+
+#include "checkpoint.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "checkpoint" class /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::checkpoint::checkpoint ()
+{
+  step     = 0;                                                                                     // Initializing checkpoint step...
+  metadata = "";                                                                                    // Initializing checkpoint metadata...
+}
+
+void nu::checkpoint::check (
+                            size_t loc_offset,                                                      // Block offset [bytes].
+                            size_t loc_size,                                                        // Block size [bytes].
+                            size_t loc_file_size                                                    // File size [bytes].
+                           )
+{
+  if((loc_offset > loc_file_size) || (loc_size > loc_file_size - loc_offset))
+  {
+    neutrino::error ("corrupted checkpoint file!");                                                 // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+bool nu::checkpoint::sync (
+                           std::string loc_file_name                                                // File (or directory) name.
+                          )
+{
+  bool loc_synced = false;                                                                          // Synced flag.
+
+  #ifdef WIN32
+    HANDLE loc_handle;                                                                              // File handle.
+
+    loc_handle = CreateFileA (
+                              loc_file_name.c_str (),
+                              GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE,
+                              NULL,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              NULL
+                             );
+
+    if(loc_handle != INVALID_HANDLE_VALUE)
+    {
+      loc_synced = (FlushFileBuffers (loc_handle) != 0);                                            // Flushing file to disk...
+      CloseHandle (loc_handle);                                                                     // Closing file...
+    }
+  #endif
+
+  #if defined(__linux__) || defined(__APPLE__)
+    int loc_descriptor;                                                                             // File descriptor.
+
+    loc_descriptor = ::open (loc_file_name.c_str (), O_RDONLY);                                     // Opening file...
+
+    if(loc_descriptor != -1)
+    {
+      loc_synced = (::fsync (loc_descriptor) == 0);                                                 // Flushing file to disk...
+      ::close (loc_descriptor);                                                                     // Closing file...
+    }
+  #endif
+
+  return loc_synced;                                                                                // Returning synced flag...
+}
+
+void nu::checkpoint::save (
+                           std::string loc_file_name,                                               // Checkpoint file name.
+                           size_t      loc_step,                                                    // Simulation step.
+                           std::string loc_metadata                                                 // User metadata.
+                          )
+{
+  nu::zone        loc_zone ("checkpoint");                                                          // Profiling zone...
+  const char      loc_zero[8] = {0};                                                                // Padding bytes.
+  std::string     loc_temp_name = loc_file_name + ".tmp";                                           // Temporary file name.
+  std::ofstream   loc_file;                                                                         // Checkpoint file.
+  std::error_code loc_rename_error;                                                                 // Rename error code.
+  cl_int          loc_error;                                                                        // Error code.
+  cl_mem          loc_buffer;                                                                       // OpenCL buffer.
+  size_t          loc_size;                                                                         // Object size [bytes].
+  std::string     loc_name;                                                                         // Object name.
+  GLuint          loc_layout;                                                                       // Object layout index.
+  bool            loc_ready;                                                                        // Object buffer "ready" flag.
+  char*           loc_map;                                                                          // Mapped OpenCL buffer.
+  uint32_t        loc_word[4];                                                                      // Header words.
+  uint64_t        loc_long[2];                                                                      // Header long words.
+  size_t          i;                                                                                // Object index.
+
+  neutrino::action ("saving checkpoint " + loc_file_name + "...");                                  // Printing message...
+
+  loc_file.open (loc_temp_name, std::ios::binary | std::ios::trunc);                                // Opening temporary file...
+
+  if(!loc_file)
+  {
+    neutrino::error ("unable to write checkpoint file " + loc_temp_name + "!");                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+
+  // Writing header:
+  loc_word[0] = NU_SNAPSHOT_FORMAT;                                                                 // Setting format version...
+  loc_word[1] = (uint32_t)nu::data::container.size ();                                              // Setting number of objects...
+  loc_long[0] = (uint64_t)loc_step;                                                                 // Setting step...
+  loc_long[1] = (uint64_t)loc_metadata.size ();                                                     // Setting metadata size...
+  loc_file.write (NU_SNAPSHOT_MAGIC, 8);                                                            // Writing magic...
+  loc_file.write ((const char*)loc_word, 2*sizeof (uint32_t));                                      // Writing format and number of objects...
+  loc_file.write ((const char*)loc_long, 2*sizeof (uint64_t));                                      // Writing step and metadata size...
+  loc_file.write (loc_metadata.data (), (std::streamsize)loc_metadata.size ());                     // Writing metadata...
+  loc_file.write (loc_zero, (std::streamsize)((8 - loc_metadata.size ()%8)%8));                     // Padding header...
+
+  for(i = 0; i < nu::data::container.size (); i++)
+  {
+    nu::snapshot::locate (
+                          nu::data::container[i],
+                          &loc_buffer,
+                          &loc_size,
+                          &loc_name,
+                          &loc_layout,
+                          &loc_ready
+                         );
+
+    if(!loc_ready)
+    {
+      neutrino::error ("checkpoint object not initialized (see kernel::setarg)!");                  // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    // Writing object header:
+    loc_word[0] = (uint32_t)nu::data::container[i]->type;                                           // Setting object type...
+    loc_word[1] = (uint32_t)loc_layout;                                                             // Setting object layout index...
+    loc_long[0] = (uint64_t)loc_size;                                                               // Setting object size...
+    loc_word[2] = (uint32_t)loc_name.size ();                                                       // Setting object name size...
+    loc_word[3] = 0;                                                                                // Setting reserved word...
+    loc_file.write ((const char*)loc_word, 2*sizeof (uint32_t));                                    // Writing type and layout...
+    loc_file.write ((const char*)loc_long, sizeof (uint64_t));                                      // Writing object size...
+    loc_file.write ((const char*)&loc_word[2], 2*sizeof (uint32_t));                                // Writing name size...
+    loc_file.write (loc_name.data (), (std::streamsize)loc_name.size ());                           // Writing object name...
+    loc_file.write (loc_zero, (std::streamsize)((8 - loc_name.size ()%8)%8));                       // Padding object header...
+
+    if(loc_size == 0)
+    {
+      continue;                                                                                     // Nothing to map...
+    }
+
+    // Mapping OpenCL buffer on host (no copy in the host data vector):
+    nu::snapshot::interop (nu::data::container[i], true);                                           // Acquiring object...
+    loc_map = (char*)clEnqueueMapBuffer (
+                                         neutrino::queue_id,
+                                         loc_buffer,
+                                         CL_TRUE,
+                                         CL_MAP_READ,
+                                         0,
+                                         loc_size,
+                                         0,
+                                         NULL,
+                                         NULL,
+                                         &loc_error
+                                        );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+
+    loc_file.write (loc_map, (std::streamsize)loc_size);                                            // Writing object data (one write)...
+    loc_file.write (loc_zero, (std::streamsize)((8 - loc_size%8)%8));                               // Padding object data...
+
+    // Unmapping OpenCL buffer:
+    loc_error = clEnqueueUnmapMemObject (neutrino::queue_id, loc_buffer, loc_map, 0, NULL, NULL);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+    nu::snapshot::interop (nu::data::container[i], false);                                          // Releasing object...
+  }
+
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  loc_file.close ();                                                                                // Closing temporary file...
+
+  if(!loc_file)
+  {
+    neutrino::error ("unable to write checkpoint file " + loc_temp_name + "!");                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Flushing temporary file to disk (the rename must never expose a partial file):
+  if(!sync (loc_temp_name))
+  {
+    neutrino::error ("unable to flush checkpoint file " + loc_temp_name + "!");                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Replacing checkpoint file (atomic: the previous checkpoint is never removed first):
+  std::filesystem::rename (loc_temp_name, loc_file_name, loc_rename_error);                         // Renaming temporary file...
+
+  if(loc_rename_error)
+  {
+    neutrino::error ("unable to rename checkpoint file " + loc_temp_name + "!");                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  #if defined(__linux__) || defined(__APPLE__)
+    // Flushing directory entry to disk (best effort: not supported by all file systems):
+    sync (std::filesystem::absolute (loc_file_name).parent_path ().string ());
+  #endif
+
+  step     = loc_step;                                                                              // Setting checkpoint step...
+  metadata = loc_metadata;                                                                          // Setting checkpoint metadata...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::checkpoint::restart (
+                              std::string loc_file_name                                             // Checkpoint file name.
+                             )
+{
+  nu::zone    loc_zone ("restart");                                                                 // Profiling zone...
+  nu::mapfile loc_file;                                                                             // Mapped checkpoint file.
+  const char* loc_data;                                                                             // Mapped bytes.
+  size_t      loc_file_size;                                                                        // File size [bytes].
+  size_t      loc_offset;                                                                           // File offset [bytes].
+  size_t      loc_objects;                                                                          // Number of objects.
+  uint32_t    loc_word[4];                                                                          // Header words.
+  uint64_t    loc_long[2];                                                                          // Header long words.
+  cl_int      loc_error;                                                                            // Error code.
+  cl_mem      loc_buffer;                                                                           // OpenCL buffer.
+  size_t      loc_size;                                                                             // Object size [bytes].
+  std::string loc_name;                                                                             // Object name.
+  std::string loc_stored_name;                                                                      // Object name (file).
+  GLuint      loc_layout;                                                                           // Object layout index.
+  bool        loc_ready;                                                                            // Object buffer "ready" flag.
+  bool        loc_found;                                                                            // Object found flag.
+  size_t      i;                                                                                    // Object index (file).
+  size_t      j;                                                                                    // Object index (container).
+  size_t      k;                                                                                    // Search index (container).
+
+  neutrino::action ("restarting from checkpoint " + loc_file_name + "...");                         // Printing message...
+
+  loc_file.open (loc_file_name);                                                                    // Mapping checkpoint file...
+  loc_data      = loc_file.data ();                                                                 // Getting mapped bytes...
+  loc_file_size = loc_file.size ();                                                                 // Getting file size...
+
+  // Reading header:
+  check (0, 32, loc_file_size);                                                                     // Checking header size...
+
+  if(std::memcmp (loc_data, NU_SNAPSHOT_MAGIC, 8) != 0)
+  {
+    neutrino::error ("not a checkpoint file: " + loc_file_name + "!");                              // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  std::memcpy (loc_word, loc_data + 8, 2*sizeof (uint32_t));                                        // Reading format and number of objects...
+  std::memcpy (loc_long, loc_data + 16, 2*sizeof (uint64_t));                                       // Reading step and metadata size...
+
+  if(loc_word[0] != NU_SNAPSHOT_FORMAT)
+  {
+    neutrino::error ("unsupported checkpoint file format!");                                        // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_objects = (size_t)loc_word[1];                                                                // Getting number of objects...
+  check (32, (size_t)loc_long[1], loc_file_size);                                                   // Checking metadata size...
+  step        = (size_t)loc_long[0];                                                                // Getting step...
+  metadata    = std::string (loc_data + 32, (size_t)loc_long[1]);                                   // Getting metadata...
+  loc_offset  = (32 + (size_t)loc_long[1] + 7)/8*8;                                                 // Skipping padded header...
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+
+  for(i = 0; i < loc_objects; i++)
+  {
+    // Reading object header:
+    check (loc_offset, 24, loc_file_size);                                                          // Checking object header size...
+    std::memcpy (loc_word, loc_data + loc_offset, 2*sizeof (uint32_t));                             // Reading type and layout...
+    std::memcpy (loc_long, loc_data + loc_offset + 8, sizeof (uint64_t));                           // Reading object size...
+    std::memcpy (&loc_word[2], loc_data + loc_offset + 16, 2*sizeof (uint32_t));                    // Reading name size...
+    loc_offset += 24;                                                                               // Skipping object header...
+    check (loc_offset, (size_t)loc_word[2], loc_file_size);                                         // Checking object name size...
+    loc_stored_name = std::string (loc_data + loc_offset, (size_t)loc_word[2]);                     // Reading object name...
+    loc_offset     += ((size_t)loc_word[2] + 7)/8*8;                                                // Skipping padded object name...
+    check (loc_offset, (size_t)loc_long[0], loc_file_size);                                         // Checking object data size...
+
+    // Finding object by container order, then by layout index, type and name:
+    loc_found = false;                                                                              // Resetting object found flag...
+    j         = 0;                                                                                  // Resetting object index...
+
+    for(k = 0; (k <= nu::data::container.size ()) && !loc_found; k++)
+    {
+      j = (k == 0) ? i : k - 1;                                                                     // Trying same position first...
+
+      if(j >= nu::data::container.size ())
+      {
+        continue;                                                                                   // No object at this position...
+      }
+
+      nu::snapshot::locate (
+                            nu::data::container[j],
+                            &loc_buffer,
+                            &loc_size,
+                            &loc_name,
+                            &loc_layout,
+                            &loc_ready
+                           );
+
+      loc_found = (loc_layout == loc_word[1]) &&
+                  ((uint32_t)nu::data::container[j]->type == loc_word[0]) &&
+                  (loc_name == loc_stored_name);                                                    // Checking object...
+    }
+
+    if(!loc_found || !loc_ready || (loc_size != (size_t)loc_long[0]))
+    {
+      neutrino::error (
+                       "checkpoint object " + std::to_string (loc_word[1]) + " (" + loc_stored_name +
+                       ") does not match!"
+                      );                                                                            // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    // Uploading object data directly from the mapped file:
+    if(loc_size != 0)
+    {
+      nu::snapshot::interop (nu::data::container[j], true);                                         // Acquiring object...
+      loc_error = clEnqueueWriteBuffer (
+                                        neutrino::queue_id,
+                                        loc_buffer,
+                                        CL_TRUE,
+                                        0,
+                                        loc_size,
+                                        loc_data + loc_offset,
+                                        0,
+                                        NULL,
+                                        NULL
+                                       );
+      neutrino::check_error (loc_error);                                                            // Checking error...
+      nu::snapshot::interop (nu::data::container[j], false);                                        // Releasing object...
+    }
+
+    loc_offset += (loc_size + 7)/8*8;                                                               // Skipping padded object data...
+  }
+
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  loc_file.close ();                                                                                // Unmapping checkpoint file...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+size_t nu::checkpoint::get_step ()
+{
+  return step;                                                                                      // Returning checkpoint step...
+}
+
+std::string nu::checkpoint::get_metadata ()
+{
+  return metadata;                                                                                  // Returning checkpoint metadata...
+}
+
+nu::checkpoint::~checkpoint ()
+{
+  // Doing nothing!
+}
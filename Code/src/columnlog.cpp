@@ -0,0 +1,791 @@
+/// @file     columnlog.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "columnlog" class (binary columnar log file).
+
+#include "columnlog.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "columnlog" class //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::columnlog::columnlog ()
+{
+  codec   = COLUMN_RAW;                                                                             // Initializing column codec...
+  current = 0;                                                                                      // Initializing current column...
+  rows    = 0;                                                                                      // Initializing number of rows...
+}
+
+uint32_t nu::columnlog::word (
+                              const char* loc_data                                                  // Word address.
+                             )
+{
+  uint32_t loc_word;                                                                                // Word.
+
+  memcpy (&loc_word, loc_data, sizeof (uint32_t));                                                  // Getting word...
+
+  return loc_word;                                                                                  // Returning word...
+}
+
+void nu::columnlog::put (
+                         uint32_t loc_word                                                          // Word.
+                        )
+{
+  out_file.write ((const char*)&loc_word, sizeof (uint32_t));                                       // Writing word...
+}
+
+void nu::columnlog::pad ()
+{
+  const char loc_zero[8] = {0};                                                                     // Padding bytes.
+  size_t     loc_offset;                                                                            // File offset.
+
+  loc_offset = (size_t)out_file.tellp ();                                                           // Getting file offset...
+  out_file.write (loc_zero, (std::streamsize)((8 - loc_offset%8)%8));                               // Padding to 8 bytes...
+}
+
+void nu::columnlog::append (
+                            uint32_t    loc_value,                                                  // Value (bit pattern).
+                            column_type loc_type                                                    // Value type.
+                           )
+{
+  if(!out_file.is_open ())
+  {
+    neutrino::error ("binary log file not open in write mode!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(current >= type.size ())
+  {
+    neutrino::error ("too many values in binary log row!");                                         // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(type[current] != loc_type)
+  {
+    neutrino::error ("wrong value type for binary log column " + name[current] + "!");              // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  chunk[current].push_back (loc_value);                                                             // Appending value...
+  current++;                                                                                        // Advancing column...
+}
+
+void nu::columnlog::flush ()
+{
+  std::vector<char> loc_packed;                                                                     // Packed block.
+  size_t            loc_rows;                                                                       // Number of chunk rows.
+  size_t            c;                                                                              // Column index.
+
+  loc_rows = chunk[0].size ();                                                                      // Getting number of chunk rows...
+
+  if(loc_rows == 0)
+  {
+    return;                                                                                         // Nothing to write...
+  }
+
+  put ((uint32_t)loc_rows);                                                                         // Writing number of chunk rows...
+  put (0);                                                                                          // Writing reserved word...
+
+  for(c = 0; c < chunk.size (); c++)
+  {
+    if(codec == COLUMN_PACK)
+    {
+      pack (chunk[c], type[c], loc_packed);                                                         // Packing column block...
+    }
+
+    if((codec == COLUMN_PACK) && (loc_packed.size () < loc_rows*sizeof (uint32_t)))
+    {
+      put (COLUMN_PACK);                                                                            // Writing block codec...
+      put ((uint32_t)loc_packed.size ());                                                           // Writing block size...
+      out_file.write (loc_packed.data (), (std::streamsize)loc_packed.size ());                     // Writing packed block...
+    }
+
+    else
+    {
+      put (COLUMN_RAW);                                                                             // Writing block codec...
+      put ((uint32_t)(loc_rows*sizeof (uint32_t)));                                                 // Writing block size...
+      out_file.write ((const char*)chunk[c].data (),
+                      (std::streamsize)(loc_rows*sizeof (uint32_t)));                               // Writing raw block...
+    }
+
+    pad ();                                                                                         // Padding block...
+    chunk[c].clear ();                                                                              // Clearing column values...
+  }
+
+  if(!out_file)
+  {
+    neutrino::error ("unable to write binary log file!");                                           // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+void nu::columnlog::pack (
+                          std::vector<uint32_t>& loc_value,                                         // Column values (bit patterns).
+                          column_type            loc_type,                                          // Column type.
+                          std::vector<char>&     loc_packed                                         // Packed block.
+                         )
+{
+  size_t               loc_rows  = loc_value.size ();                                               // Number of values.
+  size_t               loc_bytes = loc_rows*sizeof (uint32_t);                                      // Number of bytes.
+  std::vector<uint8_t> loc_shuffled (loc_bytes);                                                    // Shuffled bytes.
+  uint32_t             loc_previous = 0;                                                            // Previous value.
+  uint32_t             loc_delta;                                                                   // Delta value.
+  size_t               loc_run;                                                                     // Run length.
+  size_t               i;                                                                           // Value index.
+  size_t               j;                                                                           // Byte index.
+  size_t               b;                                                                           // Byte plane index.
+
+  // Delta encoding and byte shuffling:
+  for(i = 0; i < loc_rows; i++)
+  {
+    loc_delta    = (loc_type == COLUMN_FLOAT) ? (loc_value[i] ^ loc_previous) :
+                   (loc_value[i] - loc_previous);                                                   // Computing delta...
+    loc_previous = loc_value[i];                                                                    // Setting previous value...
+
+    for(b = 0; b < sizeof (uint32_t); b++)
+    {
+      loc_shuffled[b*loc_rows + i] = (uint8_t)(loc_delta >> (8*b));                                 // Shuffling byte...
+    }
+  }
+
+  loc_packed.clear ();                                                                              // Clearing packed block...
+  i = 0;                                                                                            // Resetting byte index...
+
+  // Run-length encoding (control byte: 0...127 = 1...128 literals, 128...255 = run of 3...130):
+  while(i < loc_bytes)
+  {
+    loc_run = 1;                                                                                    // Resetting run length...
+
+    while((i + loc_run < loc_bytes) && (loc_run < 130) &&
+          (loc_shuffled[i + loc_run] == loc_shuffled[i]))
+    {
+      loc_run++;                                                                                    // Measuring run...
+    }
+
+    if(loc_run >= 3)
+    {
+      loc_packed.push_back ((char)(uint8_t)(loc_run + 125));                                        // Writing run control byte...
+      loc_packed.push_back ((char)loc_shuffled[i]);                                                 // Writing run byte...
+      i += loc_run;                                                                                 // Advancing byte index...
+    }
+
+    else
+    {
+      j = i;                                                                                        // Setting literal end...
+
+      while((j < loc_bytes) && (j - i < 128) &&
+            !((j + 2 < loc_bytes) && (loc_shuffled[j] == loc_shuffled[j + 1]) &&
+              (loc_shuffled[j] == loc_shuffled[j + 2])))
+      {
+        j++;                                                                                        // Extending literals (up to the next run)...
+      }
+
+      loc_packed.push_back ((char)(uint8_t)(j - i - 1));                                            // Writing literal control byte...
+      loc_packed.insert (loc_packed.end (), loc_shuffled.begin () + i, loc_shuffled.begin () + j);  // Writing literals...
+      i = j;                                                                                        // Advancing byte index...
+    }
+  }
+}
+
+bool nu::columnlog::unpack (
+                            const char*        loc_packed,                                          // Packed block.
+                            size_t             loc_size,                                            // Packed block size [bytes].
+                            column_type        loc_type,                                            // Column type.
+                            size_t             loc_rows,                                            // Number of values.
+                            std::vector<char>& loc_scratch,                                         // Scratch buffer.
+                            char*              loc_value                                            // Column values (bit patterns).
+                           )
+{
+  size_t   loc_bytes    = loc_rows*sizeof (uint32_t);                                               // Number of bytes.
+  size_t   loc_out      = 0;                                                                        // Shuffled byte index.
+  size_t   loc_in       = 0;                                                                        // Packed byte index.
+  uint32_t loc_previous = 0;                                                                        // Previous value.
+  uint32_t loc_delta;                                                                               // Delta value.
+  size_t   loc_count;                                                                               // Control byte count.
+  uint8_t  loc_control;                                                                             // Control byte.
+  size_t   i;                                                                                       // Value index.
+  size_t   b;                                                                                       // Byte plane index.
+
+  loc_scratch.resize (loc_bytes);                                                                   // Resizing scratch buffer...
+
+  // Run-length decoding:
+  while(loc_in < loc_size)
+  {
+    loc_control = (uint8_t)loc_packed[loc_in++];                                                    // Getting control byte...
+
+    if(loc_control < 128)
+    {
+      loc_count = (size_t)loc_control + 1;                                                          // Getting number of literals...
+
+      if((loc_in + loc_count > loc_size) || (loc_out + loc_count > loc_bytes))
+      {
+        return false;                                                                               // Corrupted block...
+      }
+
+      memcpy (loc_scratch.data () + loc_out, loc_packed + loc_in, loc_count);                       // Copying literals...
+      loc_in += loc_count;                                                                          // Advancing packed byte index...
+    }
+
+    else
+    {
+      loc_count = (size_t)loc_control - 125;                                                        // Getting run length...
+
+      if((loc_in >= loc_size) || (loc_out + loc_count > loc_bytes))
+      {
+        return false;                                                                               // Corrupted block...
+      }
+
+      memset (loc_scratch.data () + loc_out, loc_packed[loc_in++], loc_count);                      // Expanding run...
+    }
+
+    loc_out += loc_count;                                                                           // Advancing shuffled byte index...
+  }
+
+  if(loc_out != loc_bytes)
+  {
+    return false;                                                                                   // Corrupted block...
+  }
+
+  // Byte unshuffling and delta decoding:
+  for(i = 0; i < loc_rows; i++)
+  {
+    loc_delta = 0;                                                                                  // Resetting delta...
+
+    for(b = 0; b < sizeof (uint32_t); b++)
+    {
+      loc_delta |= (uint32_t)(uint8_t)loc_scratch[b*loc_rows + i] << (8*b);                         // Unshuffling byte...
+    }
+
+    loc_previous = (loc_type == COLUMN_FLOAT) ? (loc_delta ^ loc_previous) :
+                   (loc_delta + loc_previous);                                                      // Decoding delta...
+    memcpy (loc_value + i*sizeof (uint32_t), &loc_previous, sizeof (uint32_t));                     // Setting value...
+  }
+
+  return true;
+}
+
+void nu::columnlog::decode (
+                            size_t             loc_chunk,                                           // Chunk index.
+                            size_t             loc_column,                                          // Column index.
+                            std::vector<char>& loc_scratch,                                         // Scratch buffer.
+                            char*              loc_value                                            // Column values (bit patterns).
+                           )
+{
+  const char* loc_block = in_file.data () + block[loc_chunk*name.size () + loc_column];             // Column block.
+  uint32_t    loc_codec = word (loc_block);                                                         // Block codec.
+  uint32_t    loc_size  = word (loc_block + 4);                                                     // Block size [bytes].
+
+  if(loc_codec == COLUMN_RAW)
+  {
+    memcpy (loc_value, loc_block + 8, loc_size);                                                    // Copying raw block...
+  }
+
+  else if(!unpack (loc_block + 8, loc_size, type[loc_column], chunk_rows[loc_chunk], loc_scratch,
+                   loc_value))
+  {
+    neutrino::error ("corrupted binary log block in column " + name[loc_column] + "!");             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+template <typename T>
+void nu::columnlog::column (
+                            size_t          loc_column,                                             // Column index.
+                            std::vector<T>* loc_data,                                               // Column data.
+                            column_type     loc_type                                                // Expected column type.
+                           )
+{
+  std::vector<char> loc_scratch;                                                                    // Scratch buffer.
+  const T*          loc_raw;                                                                        // Raw block values.
+  size_t            loc_size;                                                                       // Previous data size.
+  size_t            k;                                                                              // Chunk index.
+
+  if(loc_column >= name.size ())
+  {
+    neutrino::error ("binary log column index out of range!");                                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(type[loc_column] != loc_type)
+  {
+    neutrino::error ("wrong data type for binary log column " + name[loc_column] + "!");            // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_data->reserve (loc_data->size () + rows);                                                     // Reserving column data...
+
+  for(k = 0; k < chunk_rows.size (); k++)
+  {
+    if(word (in_file.data () + block[k*name.size () + loc_column]) == COLUMN_RAW)
+    {
+      loc_raw = (const T*)(in_file.data () + block[k*name.size () + loc_column] + 8);               // Getting raw block (8 bytes aligned)...
+      loc_data->insert (loc_data->end (), loc_raw, loc_raw + chunk_rows[k]);                        // Appending raw block from mapped pages...
+    }
+
+    else
+    {
+      loc_size = loc_data->size ();                                                                 // Getting previous data size...
+      loc_data->resize (loc_size + chunk_rows[k]);                                                  // Resizing column data...
+      decode (k, loc_column, loc_scratch, (char*)(loc_data->data () + loc_size));                   // Decoding block into column data...
+    }
+  }
+}
+
+void nu::columnlog::create (
+                            std::string              loc_file_name,                                 // Binary log file name.
+                            std::string              loc_header,                                    // Log header.
+                            std::vector<std::string> loc_name,                                      // Column names.
+                            std::vector<column_type> loc_type,                                      // Column types.
+                            column_codec             loc_codec                                      // Column codec.
+                           )
+{
+  size_t c;                                                                                         // Column index.
+
+  close ();                                                                                         // Closing previous file...
+
+  if(loc_name.empty () || (loc_name.size () != loc_type.size ()))
+  {
+    neutrino::error ("invalid binary log schema!");                                                 // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  header  = loc_header;                                                                             // Setting log header...
+  name    = loc_name;                                                                               // Setting column names...
+  type    = loc_type;                                                                               // Setting column types...
+  codec   = loc_codec;                                                                              // Setting column codec...
+  current = 0;                                                                                      // Resetting current column...
+  rows    = 0;                                                                                      // Resetting number of rows...
+  chunk.assign (name.size (), std::vector<uint32_t> ());                                            // Initializing pending chunk...
+
+  for(c = 0; c < chunk.size (); c++)
+  {
+    chunk[c].reserve (NU_COLUMNLOG_CHUNK);                                                          // Reserving pending chunk...
+  }
+
+  out_file.open (loc_file_name, std::ios::binary | std::ios::trunc);                                // Opening binary log file...
+
+  if(!out_file)
+  {
+    neutrino::error ("unable to create binary log file " + loc_file_name + "!");                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Writing schema:
+  out_file.write (NU_COLUMNLOG_MAGIC, 8);                                                           // Writing magic...
+  put (NU_COLUMNLOG_FORMAT);                                                                        // Writing format version...
+  put ((uint32_t)name.size ());                                                                     // Writing number of columns...
+  put ((uint32_t)header.size ());                                                                   // Writing header size...
+  out_file.write (header.data (), (std::streamsize)header.size ());                                 // Writing header...
+
+  for(c = 0; c < name.size (); c++)
+  {
+    put ((uint32_t)type[c]);                                                                        // Writing column type...
+    put ((uint32_t)name[c].size ());                                                                // Writing column name size...
+    out_file.write (name[c].data (), (std::streamsize)name[c].size ());                             // Writing column name...
+  }
+
+  pad ();                                                                                           // Padding schema...
+}
+
+void nu::columnlog::write (
+                           unsigned int loc_int                                                     // Unsigned integer value.
+                          )
+{
+  append ((uint32_t)loc_int, COLUMN_UINT);                                                          // Appending value...
+}
+
+void nu::columnlog::write (
+                           int loc_int                                                              // Integer value.
+                          )
+{
+  append ((uint32_t)loc_int, COLUMN_INT);                                                           // Appending value...
+}
+
+void nu::columnlog::write (
+                           float loc_float                                                          // Float value.
+                          )
+{
+  uint32_t loc_value;                                                                               // Value (bit pattern).
+
+  memcpy (&loc_value, &loc_float, sizeof (uint32_t));                                               // Getting bit pattern...
+  append (loc_value, COLUMN_FLOAT);                                                                 // Appending value...
+}
+
+void nu::columnlog::endline ()
+{
+  if(current != type.size ())
+  {
+    neutrino::error ("incomplete binary log row!");                                                 // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  current = 0;                                                                                      // Resetting current column...
+  rows++;                                                                                           // Counting row...
+
+  if(chunk[0].size () == NU_COLUMNLOG_CHUNK)
+  {
+    flush ();                                                                                       // Writing chunk...
+  }
+}
+
+void nu::columnlog::open (
+                          std::string loc_file_name                                                 // Binary log file name.
+                         )
+{
+  const char* loc_data;                                                                             // Mapped bytes.
+  size_t      loc_size;                                                                             // Mapped size [bytes].
+  size_t      loc_position;                                                                         // Read position.
+  size_t      loc_columns;                                                                          // Number of columns.
+  size_t      loc_length;                                                                           // Text length.
+  size_t      loc_rows;                                                                             // Number of chunk rows.
+  uint32_t    loc_codec;                                                                            // Block codec.
+  size_t      c;                                                                                    // Column index.
+
+  close ();                                                                                         // Closing previous file...
+  in_file.open (loc_file_name);                                                                     // Mapping binary log file...
+  loc_data = in_file.data ();                                                                       // Getting mapped bytes...
+  loc_size = in_file.size ();                                                                       // Getting mapped size...
+
+  if((loc_size < 20) || (memcmp (loc_data, NU_COLUMNLOG_MAGIC, 8) != 0) ||
+     (word (loc_data + 8) != NU_COLUMNLOG_FORMAT))
+  {
+    neutrino::error ("invalid binary log file " + loc_file_name + "!");                             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Reading schema:
+  loc_columns  = word (loc_data + 12);                                                              // Getting number of columns...
+  loc_length   = word (loc_data + 16);                                                              // Getting header size...
+  loc_position = 20 + loc_length;                                                                   // Skipping header...
+
+  if(loc_position > loc_size)
+  {
+    neutrino::error ("truncated binary log file " + loc_file_name + "!");                           // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  header.assign (loc_data + 20, loc_length);                                                        // Getting header...
+  name.clear ();                                                                                    // Clearing column names...
+  type.clear ();                                                                                    // Clearing column types...
+
+  for(c = 0; c < loc_columns; c++)
+  {
+    if((loc_position + 8 > loc_size) ||
+       (loc_position + 8 + word (loc_data + loc_position + 4) > loc_size))
+    {
+      neutrino::error ("truncated binary log file " + loc_file_name + "!");                         // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    loc_length    = word (loc_data + loc_position + 4);                                             // Getting column name size...
+    type.push_back ((column_type)word (loc_data + loc_position));                                   // Getting column type...
+    name.push_back (std::string (loc_data + loc_position + 8, loc_length));                         // Getting column name...
+    loc_position += 8 + loc_length;                                                                 // Advancing read position...
+  }
+
+  loc_position = (loc_position + 7)/8*8;                                                            // Skipping schema padding...
+  rows         = 0;                                                                                 // Resetting number of rows...
+
+  // Indexing chunks:
+  while(loc_position < loc_size)
+  {
+    if(loc_position + 8 > loc_size)
+    {
+      neutrino::error ("truncated binary log file " + loc_file_name + "!");                         // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    loc_rows      = word (loc_data + loc_position);                                                 // Getting number of chunk rows...
+    loc_position += 8;                                                                              // Skipping chunk header...
+    chunk_rows.push_back (loc_rows);                                                                // Setting chunk rows...
+    rows         += loc_rows;                                                                       // Counting rows...
+
+    for(c = 0; c < loc_columns; c++)
+    {
+      if(loc_position + 8 > loc_size)
+      {
+        neutrino::error ("truncated binary log file " + loc_file_name + "!");                       // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      loc_codec  = word (loc_data + loc_position);                                                  // Getting block codec...
+      loc_length = word (loc_data + loc_position + 4);                                              // Getting block size...
+
+      if(((loc_codec == COLUMN_RAW) && (loc_length != loc_rows*sizeof (uint32_t))) ||
+         ((loc_codec != COLUMN_RAW) && (loc_codec != COLUMN_PACK)) ||
+         (loc_position + 8 + loc_length > loc_size))
+      {
+        neutrino::error ("corrupted binary log file " + loc_file_name + "!");                       // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      block.push_back (loc_position);                                                               // Setting block offset...
+      loc_position += 8 + (loc_length + 7)/8*8;                                                     // Skipping block...
+    }
+  }
+}
+
+void nu::columnlog::read (
+                          size_t                     loc_column,                                    // Column index.
+                          std::vector<unsigned int>* loc_data                                       // Column data.
+                         )
+{
+  column (loc_column, loc_data, COLUMN_UINT);                                                       // Reading column...
+}
+
+void nu::columnlog::read (
+                          size_t            loc_column,                                             // Column index.
+                          std::vector<int>* loc_data                                                // Column data.
+                         )
+{
+  column (loc_column, loc_data, COLUMN_INT);                                                        // Reading column...
+}
+
+void nu::columnlog::read (
+                          size_t              loc_column,                                           // Column index.
+                          std::vector<float>* loc_data                                              // Column data.
+                         )
+{
+  column (loc_column, loc_data, COLUMN_FLOAT);                                                      // Reading column...
+}
+
+size_t nu::columnlog::get_column (
+                                  std::string loc_name                                              // Column name.
+                                 )
+{
+  size_t c;                                                                                         // Column index.
+
+  for(c = 0; c < name.size (); c++)
+  {
+    if(name[c] == loc_name)
+    {
+      return c;                                                                                     // Returning column index...
+    }
+  }
+
+  neutrino::error ("binary log column " + loc_name + " not found!");                                // Printing message...
+  exit (EXIT_FAILURE);                                                                              // Exiting...
+}
+
+size_t nu::columnlog::get_columns ()
+{
+  return name.size ();                                                                              // Returning number of columns...
+}
+
+size_t nu::columnlog::get_rows ()
+{
+  return rows;                                                                                      // Returning number of rows...
+}
+
+std::string nu::columnlog::get_name (
+                                     size_t loc_column                                              // Column index.
+                                    )
+{
+  return name.at (loc_column);                                                                      // Returning column name...
+}
+
+nu::column_type nu::columnlog::get_type (
+                                         size_t loc_column                                          // Column index.
+                                        )
+{
+  return type.at (loc_column);                                                                      // Returning column type...
+}
+
+std::string nu::columnlog::get_header ()
+{
+  return header;                                                                                    // Returning log header...
+}
+
+void nu::columnlog::import_text (
+                                 std::string              loc_text_file_name,                       // Text log file name (with extension).
+                                 std::string              loc_delimiter,                            // Text log file delimiter.
+                                 std::vector<std::string> loc_name,                                 // Column names.
+                                 std::vector<column_type> loc_type,                                 // Column types.
+                                 std::string              loc_file_name,                            // Binary log file name.
+                                 column_codec             loc_codec                                 // Column codec.
+                                )
+{
+  std::ifstream loc_file (loc_text_file_name);                                                      // Text log file.
+  std::string   loc_line;                                                                           // Text line.
+  std::string   loc_header;                                                                         // Log header.
+  std::string   loc_token;                                                                          // Text token.
+  size_t        loc_begin;                                                                          // Token begin.
+  size_t        loc_end;                                                                            // Token end.
+  bool          loc_stamp = false;                                                                  // Time stamp flag.
+
+  if(!loc_file)
+  {
+    neutrino::error ("unable to open text log file " + loc_text_file_name + "!");                   // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_delimiter.empty ())
+  {
+    neutrino::error ("empty text log file delimiter!");                                             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Reading header (up to the time stamp):
+  while(!loc_stamp && std::getline (loc_file, loc_line))
+  {
+    if(loc_line.compare (0, 12, "Time stamp: ") == 0)
+    {
+      loc_stamp = true;                                                                             // Setting time stamp flag...
+    }
+
+    else
+    {
+      loc_header += (loc_header.empty () ? "" : "\n") + loc_line;                                   // Appending header line...
+    }
+  }
+
+  if(!loc_stamp)
+  {
+    neutrino::error ("invalid text log file " + loc_text_file_name + ": missing time stamp!");      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  create (loc_file_name, loc_header, loc_name, loc_type, loc_codec);                                // Creating binary log file...
+
+  // Converting rows:
+  while(std::getline (loc_file, loc_line))
+  {
+    loc_begin = 0;                                                                                  // Resetting token begin...
+
+    while(loc_begin < loc_line.size ())
+    {
+      loc_end   = loc_line.find (loc_delimiter, loc_begin);                                         // Finding token end...
+      loc_end   = (loc_end == std::string::npos) ? loc_line.size () : loc_end;                      // Setting last token end...
+      loc_token = loc_line.substr (loc_begin, loc_end - loc_begin);                                 // Getting token...
+      loc_begin = loc_end + loc_delimiter.size ();                                                  // Advancing to next token...
+
+      if(current >= type.size ())
+      {
+        neutrino::error ("too many values in text log row!");                                       // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      switch(type[current])
+      {
+        case COLUMN_UINT:
+          write ((unsigned int)strtoll (loc_token.c_str (), NULL, 10));                             // Converting unsigned integer...
+          break;
+
+        case COLUMN_INT:
+          write ((int)strtol (loc_token.c_str (), NULL, 10));                                       // Converting integer...
+          break;
+
+        case COLUMN_FLOAT:
+          write (strtof (loc_token.c_str (), NULL));                                                // Converting float...
+          break;
+      }
+    }
+
+    if(current > 0)
+    {
+      endline ();                                                                                   // Ending row (empty lines are skipped)...
+    }
+  }
+
+  close ();                                                                                         // Closing binary log file...
+}
+
+void nu::columnlog::export_text (
+                                 std::string loc_text_file_name,                                    // Text log file name.
+                                 std::string loc_text_file_extension,                               // Text log file extension.
+                                 std::string loc_delimiter                                          // Text log file delimiter.
+                                )
+{
+  nu::logfile*                        loc_log;                                                      // Text log file.
+  std::ofstream                       loc_target;                                                   // Text log file target.
+  std::vector<std::vector<uint32_t> > loc_value (name.size ());                                     // Chunk values, per column.
+  std::vector<char>                   loc_scratch;                                                  // Scratch buffer.
+  float                               loc_float;                                                    // Float value.
+  size_t                              k;                                                            // Chunk index.
+  size_t                              c;                                                            // Column index.
+  size_t                              i;                                                            // Row index.
+
+  if(in_file.data () == nullptr)
+  {
+    neutrino::error ("binary log file not open in read mode!");                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Truncating target (the text log file is opened in append mode):
+  loc_target.open (loc_text_file_name + "." + loc_text_file_extension, std::ios::trunc);            // Truncating text log file...
+
+  if(!loc_target)
+  {
+    neutrino::error ("unable to create text log file " + loc_text_file_name + "!");                 // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_target.close ();                                                                              // Closing text log file...
+  loc_log = new nu::logfile ();                                                                     // Creating text log file...
+  loc_log->open (loc_text_file_name, loc_text_file_extension, header, loc_delimiter, WRITE_ASYNC);  // Opening text log file...
+
+  for(k = 0; k < chunk_rows.size (); k++)
+  {
+    for(c = 0; c < name.size (); c++)
+    {
+      loc_value[c].resize (chunk_rows[k]);                                                          // Resizing chunk values...
+      decode (k, c, loc_scratch, (char*)loc_value[c].data ());                                      // Decoding column block...
+    }
+
+    for(i = 0; i < chunk_rows[k]; i++)
+    {
+      for(c = 0; c < name.size (); c++)
+      {
+        switch(type[c])
+        {
+          case COLUMN_UINT:
+            loc_log->write ((unsigned int)loc_value[c][i]);                                         // Writing unsigned integer...
+            break;
+
+          case COLUMN_INT:
+            loc_log->write ((int)loc_value[c][i]);                                                  // Writing integer...
+            break;
+
+          case COLUMN_FLOAT:
+            memcpy (&loc_float, &loc_value[c][i], sizeof (float));                                  // Getting float...
+            loc_log->write (loc_float);                                                             // Writing float...
+            break;
+        }
+      }
+
+      loc_log->endline ();                                                                          // Ending row...
+    }
+  }
+
+  loc_log->close (WRITE_ASYNC);                                                                     // Closing text log file...
+  delete loc_log;                                                                                   // Deleting text log file...
+}
+
+void nu::columnlog::close ()
+{
+  if(out_file.is_open ())
+  {
+    if(current != 0)
+    {
+      neutrino::error ("incomplete binary log row!");                                               // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    flush ();                                                                                       // Writing pending chunk...
+    out_file.close ();                                                                              // Closing binary log file...
+
+    if(!out_file)
+    {
+      neutrino::error ("unable to close binary log file!");                                         // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  in_file.close ();                                                                                 // Unmapping binary log file...
+  chunk_rows.clear ();                                                                              // Clearing chunk rows...
+  block.clear ();                                                                                   // Clearing block offsets...
+}
+
+nu::columnlog::~columnlog ()
+{
+  close ();                                                                                         // Closing binary log file...
+}
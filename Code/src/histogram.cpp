@@ -0,0 +1,298 @@
+/// @file     histogram.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "histogram" class (lock-free time statistics).
+
+#include "neutrino.hpp"                                                                             // Neutrino macros (it includes "histogram.hpp").
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "histogram" class //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::histogram::histogram (
+                          std::string loc_name                                                      // Histogram name.
+                         )
+  : buckets (bucket (((uint64_t)1 << NU_HISTOGRAM_RANGE) - 1) + 1),
+    count ((NU_HISTOGRAM_SLICES + 1)*(bucket (((uint64_t)1 << NU_HISTOGRAM_RANGE) - 1) + 1)),
+    peak (NU_HISTOGRAM_SLICES + 1)
+{
+  name  = loc_name;                                                                                 // Setting histogram name...
+  epoch = (int64_t)floor (clock ()/NU_HISTOGRAM_SLICE);                                             // Setting current epoch...
+  reset ();                                                                                         // Clearing slices...
+}
+
+size_t nu::histogram::bucket (
+                              uint64_t loc_time                                                     // Time [ns].
+                             )
+{
+  const uint64_t loc_sub  = (uint64_t)1 << NU_HISTOGRAM_BITS;                                       // Sub-buckets per power of two (x2).
+  const uint64_t loc_half = loc_sub >> 1;                                                           // Sub-buckets per power of two.
+  uint64_t       k        = 0;                                                                      // Power of two shift.
+
+  if(loc_time < loc_sub)
+  {
+    return (size_t)loc_time;                                                                        // Linear range...
+  }
+
+  while((loc_time >> k) >= loc_sub)
+  {
+    k++;                                                                                            // Finding shift...
+  }
+
+  return (size_t)(k*loc_half + (loc_time >> k));                                                    // Returning bucket index...
+}
+
+uint64_t nu::histogram::value (
+                               size_t loc_bucket                                                    // Bucket index.
+                              )
+{
+  const uint64_t loc_sub  = (uint64_t)1 << NU_HISTOGRAM_BITS;                                       // Sub-buckets per power of two (x2).
+  const uint64_t loc_half = loc_sub >> 1;                                                           // Sub-buckets per power of two.
+  uint64_t       k;                                                                                 // Power of two shift.
+  uint64_t       m;                                                                                 // Sub-bucket.
+
+  if(loc_bucket < loc_sub)
+  {
+    return (uint64_t)loc_bucket;                                                                    // Linear range...
+  }
+
+  k = loc_bucket/loc_half - 1;                                                                      // Computing shift...
+  m = loc_bucket - k*loc_half;                                                                      // Computing sub-bucket...
+
+  return (m << k) + (((uint64_t)1 << k) >> 1);                                                      // Returning bucket mid value [ns]...
+}
+
+double nu::histogram::clock ()
+{
+  std::chrono::duration<double> loc_time;                                                           // Monotonic time [s].
+
+  loc_time = std::chrono::steady_clock::now ().time_since_epoch ();                                 // Getting monotonic time [s]...
+
+  return loc_time.count ();                                                                         // Returning time [s]...
+}
+
+void nu::histogram::advance ()
+{
+  int64_t loc_epoch;                                                                                // Current epoch.
+  int64_t loc_old;                                                                                  // Previous epoch.
+  int64_t e;                                                                                        // Expired epoch.
+  size_t  loc_slice;                                                                                // Expired slice.
+  size_t  i;                                                                                        // Bucket index.
+
+  loc_epoch = (int64_t)floor (clock ()/NU_HISTOGRAM_SLICE);                                         // Getting current epoch...
+  loc_old   = epoch.load (std::memory_order_relaxed);                                               // Getting previous epoch...
+
+  if((loc_epoch <= loc_old) || !epoch.compare_exchange_strong (loc_old, loc_epoch))
+  {
+    return;                                                                                         // Nothing expired (or another thread advancing)...
+  }
+
+  // Clearing expired slices:
+  for(e = std::max (loc_old + 1, loc_epoch - NU_HISTOGRAM_SLICES + 1); e <= loc_epoch; e++)
+  {
+    loc_slice = (size_t)(e % NU_HISTOGRAM_SLICES);                                                  // Computing slice...
+
+    for(i = 0; i < buckets; i++)
+    {
+      count[loc_slice*buckets + i].store (0, std::memory_order_relaxed);                            // Clearing bucket...
+    }
+
+    peak[loc_slice].store (0, std::memory_order_relaxed);                                           // Clearing maximum...
+  }
+}
+
+void nu::histogram::record (
+                            double loc_time                                                         // Time [s].
+                           )
+{
+  const uint64_t loc_max = ((uint64_t)1 << NU_HISTOGRAM_RANGE) - 1;                                 // Maximum time [ns].
+  uint64_t       loc_ns;                                                                            // Time [ns].
+  uint64_t       loc_peak;                                                                          // Maximum time [ns].
+  size_t         loc_bucket;                                                                        // Bucket index.
+  size_t         loc_slice[2];                                                                      // Current and total slices.
+  size_t         i;                                                                                 // Slice index.
+
+  loc_ns       = (loc_time <= 0.0) ? 0 : (uint64_t)std::min (loc_time*1.0E9, (double)loc_max);      // Converting time [ns]...
+  loc_bucket   = bucket (loc_ns);                                                                   // Getting bucket index...
+
+  advance ();                                                                                       // Advancing slice ring...
+
+  loc_slice[0] = (size_t)(epoch.load (std::memory_order_relaxed) % NU_HISTOGRAM_SLICES);            // Setting current slice...
+  loc_slice[1] = NU_HISTOGRAM_SLICES;                                                               // Setting total slice...
+
+  for(i = 0; i < 2; i++)
+  {
+    count[loc_slice[i]*buckets + loc_bucket].fetch_add (1, std::memory_order_relaxed);              // Counting sample...
+    loc_peak = peak[loc_slice[i]].load (std::memory_order_relaxed);                                 // Getting maximum...
+
+    while((loc_ns > loc_peak) &&
+          !peak[loc_slice[i]].compare_exchange_weak (loc_peak, loc_ns, std::memory_order_relaxed))
+    {
+      // Retrying maximum update...
+    }
+  }
+}
+
+uint64_t nu::histogram::samples (
+                                 bool loc_total                                                     // Total slice flag.
+                                )
+{
+  uint64_t loc_samples = 0;                                                                         // Number of samples.
+  size_t   loc_first;                                                                               // First slice.
+  size_t   loc_last;                                                                                // Last slice.
+  size_t   s;                                                                                       // Slice index.
+  size_t   i;                                                                                       // Bucket index.
+
+  advance ();                                                                                       // Advancing slice ring...
+
+  loc_first = loc_total ? NU_HISTOGRAM_SLICES : 0;                                                  // Setting first slice...
+  loc_last  = loc_total ? NU_HISTOGRAM_SLICES + 1 : NU_HISTOGRAM_SLICES;                            // Setting last slice...
+
+  for(s = loc_first; s < loc_last; s++)
+  {
+    for(i = 0; i < buckets; i++)
+    {
+      loc_samples += count[s*buckets + i].load (std::memory_order_relaxed);                         // Summing samples...
+    }
+  }
+
+  return loc_samples;                                                                               // Returning number of samples...
+}
+
+uint64_t nu::histogram::quantile (
+                                  double loc_percentile,                                            // Percentile [0...100].
+                                  bool   loc_total                                                  // Total slice flag.
+                                 )
+{
+  uint64_t loc_samples;                                                                             // Number of samples.
+  uint64_t loc_target;                                                                              // Percentile rank.
+  uint64_t loc_sum = 0;                                                                             // Cumulative count.
+  size_t   loc_first;                                                                               // First slice.
+  size_t   loc_last;                                                                                // Last slice.
+  size_t   s;                                                                                       // Slice index.
+  size_t   i;                                                                                       // Bucket index.
+
+  loc_samples = samples (loc_total);                                                                // Getting number of samples...
+
+  if(loc_samples == 0)
+  {
+    return 0;                                                                                       // No samples...
+  }
+
+  loc_percentile = std::min (std::max (loc_percentile, 0.0), 100.0);                                // Constraining percentile...
+  loc_target     = (uint64_t)ceil (loc_percentile/100.0*(double)loc_samples);                       // Computing percentile rank...
+  loc_target     = std::max (loc_target, (uint64_t)1);                                              // Constraining percentile rank...
+  loc_first      = loc_total ? NU_HISTOGRAM_SLICES : 0;                                             // Setting first slice...
+  loc_last       = loc_total ? NU_HISTOGRAM_SLICES + 1 : NU_HISTOGRAM_SLICES;                       // Setting last slice...
+
+  for(i = 0; i < buckets; i++)
+  {
+    for(s = loc_first; s < loc_last; s++)
+    {
+      loc_sum += count[s*buckets + i].load (std::memory_order_relaxed);                             // Accumulating count...
+    }
+
+    if(loc_sum >= loc_target)
+    {
+      return std::min (value (i), maximum (loc_total));                                             // Returning percentile [ns]...
+    }
+  }
+
+  return maximum (loc_total);                                                                       // Returning maximum (samples added meanwhile)...
+}
+
+uint64_t nu::histogram::maximum (
+                                 bool loc_total                                                     // Total slice flag.
+                                )
+{
+  uint64_t loc_maximum = 0;                                                                         // Maximum time [ns].
+  size_t   s;                                                                                       // Slice index.
+
+  if(loc_total)
+  {
+    return peak[NU_HISTOGRAM_SLICES].load (std::memory_order_relaxed);                              // Returning total maximum [ns]...
+  }
+
+  for(s = 0; s < NU_HISTOGRAM_SLICES; s++)
+  {
+    loc_maximum = std::max (loc_maximum, peak[s].load (std::memory_order_relaxed));                 // Finding maximum [ns]...
+  }
+
+  return loc_maximum;                                                                               // Returning maximum [ns]...
+}
+
+double nu::histogram::percentile (
+                                  double loc_percentile                                             // Percentile [0...100].
+                                 )
+{
+  return 1.0E-9*(double)quantile (loc_percentile, false);                                           // Returning percentile [s]...
+}
+
+double nu::histogram::max ()
+{
+  advance ();                                                                                       // Advancing slice ring...
+
+  return 1.0E-9*(double)maximum (false);                                                            // Returning maximum [s]...
+}
+
+uint64_t nu::histogram::size ()
+{
+  return samples (false);                                                                           // Returning number of samples...
+}
+
+std::string nu::histogram::get_name ()
+{
+  return name;                                                                                      // Returning histogram name...
+}
+
+void nu::histogram::reset ()
+{
+  size_t i;                                                                                         // Index.
+
+  for(i = 0; i < count.size (); i++)
+  {
+    count[i].store (0, std::memory_order_relaxed);                                                  // Clearing bucket...
+  }
+
+  for(i = 0; i < peak.size (); i++)
+  {
+    peak[i].store (0, std::memory_order_relaxed);                                                   // Clearing maximum...
+  }
+}
+
+void nu::histogram::dump (
+                          std::ofstream& loc_file                                                   // Output file.
+                         )
+{
+  uint64_t loc_count;                                                                               // Bucket count.
+  size_t   s;                                                                                       // Window/total index.
+  size_t   i;                                                                                       // Bucket index.
+
+  loc_file << "# " << name << "\n";                                                                 // Writing histogram name...
+  loc_file << "# range    samples    p50 [us]    p90 [us]    p99 [us]  p99.9 [us]    max [us]\n";   // Writing header...
+
+  for(s = 0; s < 2; s++)
+  {
+    loc_file << ((s == 0) ? "window   " : "total    ") <<
+                std::setw (8) << samples (s == 1) << std::fixed << std::setprecision (1) <<
+                std::setw (12) << 1.0E-3*(double)quantile (50.0, s == 1) <<
+                std::setw (12) << 1.0E-3*(double)quantile (90.0, s == 1) <<
+                std::setw (12) << 1.0E-3*(double)quantile (99.0, s == 1) <<
+                std::setw (12) << 1.0E-3*(double)quantile (99.9, s == 1) <<
+                std::setw (12) << 1.0E-3*(double)maximum (s == 1) << "\n";                          // Writing percentiles...
+  }
+
+  loc_file << "# bucket [us]      count\n";                                                         // Writing bucket header...
+
+  for(i = 0; i < buckets; i++)
+  {
+    loc_count = count[NU_HISTOGRAM_SLICES*buckets + i].load (std::memory_order_relaxed);            // Getting total count...
+
+    if(loc_count > 0)
+    {
+      loc_file << std::setw (13) << std::setprecision (3) << 1.0E-3*(double)value (i) <<
+                  std::setw (11) << loc_count << "\n";                                              // Writing bucket...
+    }
+  }
+
+  loc_file << "\n";                                                                                 // Writing separator...
+}
@@ -4,6 +4,7 @@
 /// @brief    Definition of the "nu::imgui" class.
 
 #include "imgui.hpp"
+#include "opengl.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////// "nu::imgui" class //////////////////////////////////////////
@@ -228,6 +229,38 @@ void nu::imgui::lineplot (
   }
 }
 
+void nu::imgui::statistics ()
+{
+  nu::histogram* loc_histogram[3];                                                                  // Time histograms.
+  size_t         i;                                                                                 // Histogram index.
+
+  loc_histogram[0] = &neutrino::loop_histogram;                                                     // Setting loop time histogram...
+  loc_histogram[1] = &neutrino::kernel_histogram;                                                   // Setting kernel time histogram...
+  loc_histogram[2] = &neutrino::transfer_histogram;                                                 // Setting transfer time histogram...
+
+  ImGui::TextColored (
+                      ImVec4 (0.0f, 1.0f, 0.0f, 1.0f),
+                      "%-14s %9s %9s %9s %9s",
+                      "[us]",
+                      "p50",
+                      "p90",
+                      "p99",
+                      "max"
+                     );                                                                             // Writing header...
+
+  for(i = 0; i < 3; i++)
+  {
+    ImGui::Text (
+                 "%-14s %9.1f %9.1f %9.1f %9.1f",
+                 loc_histogram[i]->get_name ().c_str (),
+                 1.0E6*loc_histogram[i]->percentile (50.0),
+                 1.0E6*loc_histogram[i]->percentile (90.0),
+                 1.0E6*loc_histogram[i]->percentile (99.0),
+                 1.0E6*loc_histogram[i]->max ()
+                );                                                                                  // Writing percentiles...
+  }
+}
+
 bool nu::imgui::button (
                         std::string loc_name,                                                       // Button name.
                         int         loc_width                                                       // Button width.
@@ -255,8 +288,47 @@ void nu::imgui::finish ()
 
 void nu::imgui::end ()
 {
+  nu::opengl* loc_gui;                                                                              // OpenGL GUI.
+
+  // Resolving dynamic resolution framebuffer (GUI drawn at full resolution):
+  loc_gui = (nu::opengl*) glfwGetWindowUserPointer (neutrino::glfw_window);                         // Getting window pointer...
+
+  if(loc_gui != NULL)
+  {
+    loc_gui->resolve ();                                                                            // Upscaling plots to window...
+  }
+
+  // Dynamic resolution overlay:
+  if(neutrino::render_dynamic)
+  {
+    ImGui::SetNextWindowPos (ImVec2 (10.0f, 10.0f), ImGuiCond_Always);                              // Setting overlay position...
+    ImGui::SetNextWindowBgAlpha (0.35f);                                                            // Setting overlay transparency...
+    ImGui::Begin (
+                  "dynamic resolution",
+                  NULL,
+                  ImGuiWindowFlags_NoDecoration |
+                  ImGuiWindowFlags_AlwaysAutoResize |
+                  ImGuiWindowFlags_NoSavedSettings |
+                  ImGuiWindowFlags_NoFocusOnAppearing |
+                  ImGuiWindowFlags_NoNav |
+                  ImGuiWindowFlags_NoMove
+                 );                                                                                 // Beginning overlay...
+    ImGui::Text (
+                 "render scale = %.2f (GPU = %.2f ms)",
+                 neutrino::render_scale,
+                 1000.0*(
+                         neutrino::get_gpu_time (nu::GPU_CLEAR) +
+                         neutrino::get_gpu_time (nu::GPU_PLOT) +
+                         neutrino::get_gpu_time (nu::GPU_GUI)
+                        )
+                );                                                                                  // Writing render scale...
+    ImGui::End ();                                                                                  // Finishing overlay...
+  }
+
   ImGui::Render ();                                                                                 // Rendering windows...
+  neutrino::gpu_begin (nu::GPU_GUI);                                                                // Beginning GPU timer...
   ImGui_ImplOpenGL3_RenderDrawData (ImGui::GetDrawData ());                                         // Rendering windows...
+  neutrino::gpu_end ();                                                                             // Ending GPU timer...
 }
 
 nu::imgui::~imgui()
@@ -44,11 +44,28 @@ void nu::logfile::open (
       in_file.open (file_name);                                                                     // Opening data log file (read mode)...
       break;
 
+    case READ_MAPPED:
+      in_map.open (file_name);                                                                      // Mapping data log file (memory-mapped read mode)...
+      break;
+
     case WRITE:
+    case WRITE_ASYNC:
       out_file.open (file_name, std::ios::app);                                                     // Opening data log file (appending mode)...
       out_file << loc_log_header << std::endl;                                                      // Writing header...
       out_file << "Time stamp: " << time_text << std::endl;                                         // Writing time stamp...
       out_file << std::endl;                                                                        // Writing blank line...
+
+      if(loc_mode == WRITE_ASYNC)
+      {
+        ring.resize (NU_LOGFILE_RING);                                                              // Allocating record ring...
+        ring_head.store (0);                                                                        // Resetting ring head...
+        ring_tail.store (0);                                                                        // Resetting ring tail...
+        ring_limit = NU_LOGFILE_RING;                                                               // Resetting ring limit...
+        ring_stop.store (false);                                                                    // Resetting writer stop flag...
+        async      = true;                                                                          // Setting asynchronous mode...
+        writer     = std::thread (&nu::logfile::drain, this);                                       // Starting writer thread...
+      }
+
       break;
   }
 }
@@ -57,37 +74,93 @@ void nu::logfile::write (
                          std::string loc_string                                                     // String value.
                         )
 {
-  out_file << loc_string << delimiter;                                                              // Writing data...
+  logfile_record loc_record;                                                                        // Log record.
+  size_t         loc_size;                                                                          // String size [bytes].
+  size_t         i = 0;                                                                             // String index.
+
+  if(async)
+  {
+    loc_size = loc_string.size ();                                                                  // Getting string size...
+
+    // Splitting string in chunks:
+    do
+    {
+      loc_record.size = (uint8_t)std::min (loc_size - i, (size_t)NU_LOGFILE_TEXT);                  // Setting chunk size...
+      loc_record.type = (i + loc_record.size < loc_size) ? LOG_TEXT : LOG_TEXT_END;                 // Setting chunk type...
+      memcpy (loc_record.value.text, loc_string.data () + i, loc_record.size);                      // Copying chunk...
+      push (loc_record);                                                                            // Queueing chunk...
+      i += loc_record.size;                                                                         // Advancing string index...
+    }
+    while(i < loc_size);
+  }
+
+  else
+  {
+    out_file << loc_string << delimiter;                                                            // Writing data...
+  }
 }
 
 void nu::logfile::write (
                          unsigned int loc_int                                                       // Integer value.
                         )
 {
-  char buffer[1024];                                                                                // Text buffer.
+  char           buffer[1024];                                                                      // Text buffer.
+  logfile_record loc_record;                                                                        // Log record.
+
+  if(async)
+  {
+    loc_record.type                   = LOG_UINT;                                                   // Setting record type...
+    loc_record.value.unsigned_integer = loc_int;                                                    // Setting record value...
+    push (loc_record);                                                                              // Queueing record...
+  }
 
-  snprintf (buffer, 1024, "%d", loc_int);                                                           // Compiling data string...
-  out_file << std::string (buffer) << delimiter;                                                    // Writing data to file...
+  else
+  {
+    snprintf (buffer, 1024, "%d", loc_int);                                                         // Compiling data string...
+    out_file << std::string (buffer) << delimiter;                                                  // Writing data to file...
+  }
 }
 
 void nu::logfile::write (
                          int loc_int                                                                // Integer value.
                         )
 {
-  char buffer[1024];                                                                                // Text buffer.
+  char           buffer[1024];                                                                      // Text buffer.
+  logfile_record loc_record;                                                                        // Log record.
 
-  snprintf (buffer, 1024, "%+d", loc_int);                                                          // Compiling data string...
-  out_file << std::string (buffer) << delimiter;                                                    // Writing data to file...
+  if(async)
+  {
+    loc_record.type          = LOG_INT;                                                             // Setting record type...
+    loc_record.value.integer = loc_int;                                                             // Setting record value...
+    push (loc_record);                                                                              // Queueing record...
+  }
+
+  else
+  {
+    snprintf (buffer, 1024, "%+d", loc_int);                                                        // Compiling data string...
+    out_file << std::string (buffer) << delimiter;                                                  // Writing data to file...
+  }
 }
 
 void nu::logfile::write (
                          float loc_float                                                            // Float value.
                         )
 {
-  char buffer[1024];                                                                                // Text buffer.
+  char           buffer[1024];                                                                      // Text buffer.
+  logfile_record loc_record;                                                                        // Log record.
 
-  snprintf (buffer, 1024, "%+.6E", loc_float);                                                      // Compiling data string...
-  out_file << std::string (buffer) << delimiter;                                                    // Writing data to file...
+  if(async)
+  {
+    loc_record.type       = LOG_FLOAT;                                                              // Setting record type...
+    loc_record.value.real = loc_float;                                                              // Setting record value...
+    push (loc_record);                                                                              // Queueing record...
+  }
+
+  else
+  {
+    snprintf (buffer, 1024, "%+.6E", loc_float);                                                    // Compiling data string...
+    out_file << std::string (buffer) << delimiter;                                                  // Writing data to file...
+  }
 }
 
 void nu::logfile::read ()
@@ -99,7 +172,18 @@ void nu::logfile::read ()
 
 void nu::logfile::endline ()
 {
-  out_file << std::endl;                                                                            // Ending line...
+  logfile_record loc_record;                                                                        // Log record.
+
+  if(async)
+  {
+    loc_record.type = LOG_ENDLINE;                                                                  // Setting record type...
+    push (loc_record);                                                                              // Queueing record...
+  }
+
+  else
+  {
+    out_file << std::endl;                                                                          // Ending line...
+  }
 }
 
 void nu::logfile::close (
@@ -112,7 +196,17 @@ void nu::logfile::close (
       in_file.close ();                                                                             // Closing file...
       break;
 
+    case READ_MAPPED:
+      in_map.close ();                                                                              // Unmapping file...
+      break;
+
     case WRITE:
+    case WRITE_ASYNC:
+      if(async)
+      {
+        stop ();                                                                                    // Draining ring and stopping writer thread...
+      }
+
       out_file.close ();                                                                            // Closing file...
       break;
   }
@@ -123,7 +217,121 @@ bool nu::logfile::eof ()
   return END;                                                                                       // Returning END...
 }
 
+void nu::logfile::push (
+                        logfile_record& loc_record                                                  // Log record.
+                       )
+{
+  size_t loc_head = ring_head.load (std::memory_order_relaxed);                                     // Ring head (owned by this thread).
+
+  // Waiting for ring room (refreshing the cached limit only when the ring looks full):
+  while(loc_head == ring_limit)
+  {
+    ring_limit = ring_tail.load (std::memory_order_acquire) + ring.size ();                         // Refreshing ring limit...
+
+    if(loc_head == ring_limit)
+    {
+      std::this_thread::yield ();                                                                   // Waiting for writer...
+    }
+  }
+
+  ring[loc_head & (ring.size () - 1)] = loc_record;                                                 // Copying record...
+  ring_head.store (loc_head + 1, std::memory_order_release);                                        // Publishing record...
+}
+
+void nu::logfile::drain ()
+{
+  std::string loc_batch;                                                                            // Text batch.
+  char        buffer[1024];                                                                         // Text buffer.
+  size_t      loc_mask = ring.size () - 1;                                                          // Ring index mask.
+  size_t      loc_head;                                                                             // Ring head.
+  size_t      loc_tail;                                                                             // Ring tail.
+  bool        loc_stop;                                                                             // Stop flag.
+  bool        loc_idle;                                                                             // Idle flag.
+
+  loc_batch.reserve (NU_LOGFILE_BATCH + 1024);                                                      // Reserving text batch...
+
+  do
+  {
+    loc_stop = ring_stop.load (std::memory_order_acquire);                                          // Getting stop flag (before head)...
+    loc_head = ring_head.load (std::memory_order_acquire);                                          // Getting ring head...
+    loc_tail = ring_tail.load (std::memory_order_relaxed);                                          // Getting ring tail (owned by this thread)...
+    loc_idle = (loc_head == loc_tail);                                                              // Setting idle flag...
+
+    // Formatting queued records:
+    while(loc_tail != loc_head)
+    {
+      const logfile_record& loc_record = ring[loc_tail & loc_mask];                                 // Log record.
+
+      switch(loc_record.type)
+      {
+        case LOG_UINT:
+          snprintf (buffer, 1024, "%d", loc_record.value.unsigned_integer);                         // Compiling data string...
+          loc_batch += buffer + delimiter;                                                          // Appending data...
+          break;
+
+        case LOG_INT:
+          snprintf (buffer, 1024, "%+d", loc_record.value.integer);                                 // Compiling data string...
+          loc_batch += buffer + delimiter;                                                          // Appending data...
+          break;
+
+        case LOG_FLOAT:
+          snprintf (buffer, 1024, "%+.6E", loc_record.value.real);                                  // Compiling data string...
+          loc_batch += buffer + delimiter;                                                          // Appending data...
+          break;
+
+        case LOG_TEXT:
+          loc_batch.append (loc_record.value.text, loc_record.size);                                // Appending string chunk...
+          break;
+
+        case LOG_TEXT_END:
+          loc_batch.append (loc_record.value.text, loc_record.size);                                // Appending last string chunk...
+          loc_batch += delimiter;                                                                   // Appending delimiter...
+          break;
+
+        case LOG_ENDLINE:
+          loc_batch += '\n';                                                                        // Ending line...
+          break;
+      }
+
+      loc_tail++;                                                                                   // Advancing ring tail...
+
+      if(loc_batch.size () >= NU_LOGFILE_BATCH)
+      {
+        ring_tail.store (loc_tail, std::memory_order_release);                                      // Releasing formatted records...
+        out_file.write (loc_batch.data (), loc_batch.size ());                                      // Writing batch...
+        loc_batch.clear ();                                                                         // Clearing batch...
+      }
+    }
+
+    ring_tail.store (loc_tail, std::memory_order_release);                                          // Releasing formatted records...
+
+    // Writing pending batch and waiting for new records (when idle):
+    if(loc_idle || loc_stop)
+    {
+      out_file.write (loc_batch.data (), loc_batch.size ());                                        // Writing batch...
+      out_file.flush ();                                                                            // Flushing file...
+      loc_batch.clear ();                                                                           // Clearing batch...
+
+      if(!loc_stop)
+      {
+        std::this_thread::sleep_for (std::chrono::microseconds (NU_LOGFILE_SLEEP));                 // Sleeping...
+      }
+    }
+  }
+  while(!loc_stop);
+}
+
+void nu::logfile::stop ()
+{
+  ring_stop.store (true, std::memory_order_release);                                                // Setting writer stop flag...
+  writer.join ();                                                                                   // Waiting for writer to drain the ring...
+  async = false;                                                                                    // Resetting asynchronous mode...
+}
+
 nu::logfile::~logfile()
 {
-  // Doing nothing!
+  if(async)
+  {
+    stop ();                                                                                        // Draining ring and stopping writer thread...
+  }
 }
\ No newline at end of file
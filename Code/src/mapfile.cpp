@@ -0,0 +1,133 @@
+/// @file     mapfile.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "mapfile" class (read-only memory-mapped file).
+
+#include "mapfile.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "mapfile" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::mapfile::mapfile ()
+{
+  // Doing nothing!
+}
+
+void nu::mapfile::open (
+                        std::string loc_file_name                                                   // File name.
+                       )
+{
+  close ();                                                                                         // Unmapping previous file...
+
+  #ifdef WIN32
+    LARGE_INTEGER loc_size;                                                                         // File size [bytes].
+
+    file_handle = CreateFileA (loc_file_name.c_str (), GENERIC_READ, FILE_SHARE_READ, NULL,
+                               OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);                     // Opening file...
+
+    if((file_handle == INVALID_HANDLE_VALUE) || !GetFileSizeEx (file_handle, &loc_size))
+    {
+      neutrino::error ("unable to open file " + loc_file_name + "!");                               // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    length = (size_t)loc_size.QuadPart;                                                             // Setting mapped size...
+
+    if(length > 0)
+    {
+      map_handle = CreateFileMappingA (file_handle, NULL, PAGE_READONLY, 0, 0, NULL);               // Creating file mapping...
+      buffer     = (map_handle == NULL) ? nullptr :
+                   (const char*)MapViewOfFile (map_handle, FILE_MAP_READ, 0, 0, 0);                 // Mapping file...
+
+      if(buffer == nullptr)
+      {
+        neutrino::error ("unable to map file " + loc_file_name + "!");                              // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+    }
+  #endif
+
+  #if defined(__linux__) || defined(__APPLE__)
+    struct stat loc_stat;                                                                           // File status.
+    void*       loc_map;                                                                            // Mapping.
+
+    descriptor = ::open (loc_file_name.c_str (), O_RDONLY);                                         // Opening file...
+
+    if((descriptor < 0) || (fstat (descriptor, &loc_stat) != 0))
+    {
+      neutrino::error ("unable to open file " + loc_file_name + "!");                               // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    length = (size_t)loc_stat.st_size;                                                              // Setting mapped size...
+
+    if(length > 0)
+    {
+      loc_map = mmap (NULL, length, PROT_READ, MAP_PRIVATE, descriptor, 0);                         // Mapping file...
+
+      if(loc_map == MAP_FAILED)
+      {
+        neutrino::error ("unable to map file " + loc_file_name + "!");                              // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      madvise (loc_map, length, MADV_SEQUENTIAL);                                                   // Advising sequential read-ahead...
+      buffer = (const char*)loc_map;                                                                // Setting mapped bytes...
+    }
+  #endif
+}
+
+const char* nu::mapfile::data ()
+{
+  return buffer;                                                                                    // Returning mapped bytes...
+}
+
+size_t nu::mapfile::size ()
+{
+  return length;                                                                                    // Returning mapped size...
+}
+
+void nu::mapfile::close ()
+{
+  #ifdef WIN32
+    if(buffer != nullptr)
+    {
+      UnmapViewOfFile (buffer);                                                                     // Unmapping file...
+    }
+
+    if(map_handle != NULL)
+    {
+      CloseHandle (map_handle);                                                                     // Closing file mapping...
+    }
+
+    if(file_handle != INVALID_HANDLE_VALUE)
+    {
+      CloseHandle (file_handle);                                                                    // Closing file...
+    }
+
+    map_handle  = NULL;                                                                             // Resetting file mapping handle...
+    file_handle = INVALID_HANDLE_VALUE;                                                             // Resetting file handle...
+  #endif
+
+  #if defined(__linux__) || defined(__APPLE__)
+    if(buffer != nullptr)
+    {
+      munmap ((void*)buffer, length);                                                               // Unmapping file...
+    }
+
+    if(descriptor >= 0)
+    {
+      ::close (descriptor);                                                                         // Closing file...
+    }
+
+    descriptor = -1;                                                                                // Resetting file descriptor...
+  #endif
+
+  buffer = nullptr;                                                                                 // Resetting mapped bytes...
+  length = 0;                                                                                       // Resetting mapped size...
+}
+
+nu::mapfile::~mapfile ()
+{
+  close ();                                                                                         // Unmapping file...
+}
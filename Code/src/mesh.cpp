@@ -11,34 +11,124 @@
 nu::mesh::mesh(
                std::string loc_file_name                                                            // GMSH .msh file name.
               )
+#ifndef NU_NO_GMSH
+  : mesh (loc_file_name, GMSH)                                                                      // Reading mesh by means of the GMSH API...
+#else
+  : mesh (loc_file_name, NATIVE)                                                                    // Reading mesh by means of the native reader...
+#endif
 {
-  neutrino::action ("initializing GMSH...");                                                        // Printing message...
-  gmsh::initialize ();                                                                              // Initializing GMSH...
-  gmsh::model::add ("neutrino");                                                                    // Adding a new GMSH model (named "neutrino")...
-  gmsh::option::setNumber ("General.Terminal", 0);                                                  // Not allowing GMSH to write on stdout...
-  gmsh::open (loc_file_name.c_str ());                                                              // Opening GMSH model from file...
-  gmsh::model::getEntities (entity_list);                                                           // Getting entity list...
-  gmsh::model::mesh::renumberNodes ();                                                              // Renumbering the node tags in a continuous sequence...
-  gmsh::model::mesh::renumberElements ();                                                           // Renumbering the element tags in a continuous sequence...
-  entities = entity_list.size ();                                                                   // Getting number of entities...
+}
+
+nu::mesh::mesh(
+               std::string loc_file_name,                                                           // GMSH .msh file name.
+               mesh_reader loc_reader                                                               // Mesh reader.
+              )
+{
+  reader        = loc_reader;                                                                       // Setting mesh reader...
+  nodes_ready   = false;                                                                            // Resetting node coordinates flag...
+  topology      = FULL;                                                                             // Resetting topology mode...
+  topology_link = true;                                                                             // Resetting topology link flag...
+  request_node_ready = false;                                                                       // Resetting request node position maps flag...
+  clear_changes ();                                                                                 // Resetting change set...
+
+  switch(reader)
+  {
+    case GMSH:
+      #ifndef NU_NO_GMSH
+        neutrino::action ("initializing GMSH...");                                                  // Printing message...
+        gmsh::initialize ();                                                                        // Initializing GMSH...
+        gmsh::model::add ("neutrino");                                                              // Adding a new GMSH model (named "neutrino")...
+        gmsh::option::setNumber ("General.Terminal", 0);                                            // Not allowing GMSH to write on stdout...
+        gmsh::open (loc_file_name.c_str ());                                                        // Opening GMSH model from file...
+        gmsh::model::getEntities (entity_list);                                                     // Getting entity list...
+        gmsh::model::mesh::renumberNodes ();                                                        // Renumbering the node tags in a continuous sequence...
+        gmsh::model::mesh::renumberElements ();                                                     // Renumbering the element tags in a continuous sequence...
+        entities = entity_list.size ();                                                             // Getting number of entities...
+        neutrino::done ();                                                                          // Printing message...
+      #else
+        neutrino::error ("GMSH reader not available: Neutrino has been built with NU_NO_GMSH!");    // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      #endif
+      break;
+
+    case NATIVE:
+      neutrino::action ("reading MSH file (native reader)...");                                     // Printing message...
+      msh_read (loc_file_name);                                                                     // Reading MSH file...
+      neutrino::done ();                                                                            // Printing message...
+      break;
+  }
+}
+
+void nu::mesh::process_nodes ()
+{
+  // INDICES:
+  size_t e;                                                                                         // Entity index.
+  size_t i;                                                                                         // Node index.
+
+  // Node coordinates are read only once (the native reader reads them in the constructor):
+  if(nodes_ready || (reader == NATIVE))
+  {
+    return;
+  }
+
+  #ifndef NU_NO_GMSH
+  node_coordinates.clear ();                                                                        // Clearing node coordinates (all nodes on all entities)...
+
+  for(e = 0; e < entities; e++)
+  {
+    neutrino::work ();                                                                              // Getting initial task time...
+    entity_dimension = entity_list[e].first;                                                        // Getting entity dimension [#]...
+    entity_tag       = entity_list[e].second;                                                       // Getting entity tag [#]...
+
+    // Getting entity nodes, where:
+    // N = number of nodes
+    // dim = entity dimension
+    gmsh::model::mesh::getNodes (
+                                 all_node_list,                                                     // Node tags list [N].
+                                 all_node_coordinates,                                              // Node coordinates list [3*N].
+                                 all_node_parametric_coordinates,                                   // Node parametric coordinates [dim*N].
+                                 entity_dimension,                                                  // Entity dimension [#].
+                                 entity_tag                                                         // Entity tag [#].
+                                );
+
+    all_nodes = all_node_list.size ();                                                              // Getting the nubmer of all mesh nodes...
+
+    // For each mesh node:
+    for(i = 0; i < all_nodes; i++)
+    {
+      node_coordinates.push_back (
+      {
+        (float)all_node_coordinates[3*i + 0],                                                       // Setting node "x" coordinate...
+        (float)all_node_coordinates[3*i + 1],                                                       // Setting node "y"coordinate...
+        (float)all_node_coordinates[3*i + 2],                                                       // Setting node "z" coordinate...
+        1.0f                                                                                        // Setting node "w" coordinate...
+      }
+                                 );                                                                 // Adding node to node vector...
+    }
+
+    neutrino::progress ("finding all mesh node coordinates... ", 0, entities, e);                   // Printing progress message...
+  }
+
   neutrino::done ();                                                                                // Printing message...
+  #endif
+
+  nodes_ready = true;                                                                               // Setting node coordinates flag...
 }
 
-void nu::mesh::process (
-                        int loc_physical_group_tag,                                                 // Physical group tag.
-                        int loc_physical_group_dimension,                                           // Physical group dimension.
-                        int loc_element_type                                                        // Element type.
-                       )
+void nu::mesh::process_request (
+                                int loc_physical_group_tag,                                         // Physical group tag.
+                                int loc_physical_group_dimension,                                   // Physical group dimension.
+                                int loc_element_type                                                // Element type.
+                               )
 {
   // NODE VARIABLES:
   std::vector<size_t> loc_node_tag;                                                                 // Node tags of the given physical group.
-  std::vector<size_t> loc_node_tag_sorted;                                                          // Sorted node tags of the given physical group.
+  std::vector<bool>   loc_node_member;                                                              // Physical group membership flag (index = node tag).
   std::vector<double> loc_node_coordinates;                                                         // Node coordinates of the given physical group.
   size_t              loc_node_size;                                                                // Number of nodes of the given physical group.
   size_t              loc_node_found;                                                               // Number of element nodes founded to be present in the physical group.
 
   // INDICES:
-  size_t              e;                                                                            // Entity index.
   size_t              i;                                                                            // Node index.
   size_t              j;                                                                            // Node tag - 1;
   size_t              loc_element_offset;                                                           // Element offset.
@@ -53,7 +143,12 @@ void nu::mesh::process (
   size_t              loc_all_element_size;                                                         // Number of all elements in all entities.
   std::vector<size_t> loc_all_element_tag;                                                          // Tags of all elements in all entities.
   std::vector<size_t> loc_all_element_node;                                                         // Node tags of all elements in all entities.
-  size_t              loc_element_size;                                                             // Number of all elements in the physical group.
+  size_t              loc_element_node_tag;                                                         // Node tag of the current element node.
+  size_t              loc_element_base;                                                             // First element index of the request.
+  size_t              loc_element_size;                                                             // Number of all elements (all requests up to this one).
+  size_t              loc_element_nodes;                                                            // Number of nodes in element type.
+  std::vector<size_t> loc_incidence;                                                                // Element node positions "m" of each node (CSR, by node index).
+  std::vector<size_t> loc_incidence_offset;                                                         // Incidence offsets (one per node index, + 1).
 
   // GROUP VARIABLES:
   size_t              loc_group_offset;                                                             // Group offset.
@@ -70,6 +165,9 @@ void nu::mesh::process (
   std::vector<size_t> loc_neighbour;                                                                // Neighbour unit.
   GLint               loc_neighbour_offset;                                                         // Neighbour offset.
   GLint               loc_neighbour_size;                                                           // Number of neighbours.
+  std::vector<std::pair<size_t, GLint> >
+                      loc_local;                                                                    // Local index of each node tag (sorted by tag).
+  GLint               loc_local_index;                                                              // Local index of neighbour node.
 
   // LINK VARIABLES:
   GLfloat             loc_link_x;                                                                   // Link "x" coordinate.
@@ -79,64 +177,68 @@ void nu::mesh::process (
 
   neutrino::action ("finding mesh nodes in the given physical group...");                           // Printing message...
 
-  // Clearing arrays:
-  node.clear ();                                                                                    // Clearing node indices (all nodes on physical group)...
-  node_coordinates.clear ();                                                                        // Clearing node coordinates (all nodes on all entities)...
-  element.clear ();                                                                                 // Clearing element indices...
-  element_offset.clear ();                                                                          // Clearing element offset indices...
-  group.clear ();                                                                                   // Clearing group indices...
-  group_offset.clear ();                                                                            // Clearing group offset indices...
-  neighbour.clear ();                                                                               // Clearing neighbour indices...
-  neighbour_offset.clear ();                                                                        // Clearing neighbour offset indices...
-  neighbour_link.clear ();                                                                          // Clearing neighbour links...
-  neighbour_length.clear ();                                                                        // Clearing neighbour link lengths...
+  loc_type_size        = 0;                                                                         // Resetting number of nodes in element type...
+  loc_all_element_size = 0;                                                                         // Resetting number of elements...
 
-  for(e = 0; e < entities; e++)
+  if(reader == NATIVE)
   {
-    neutrino::work ();                                                                              // Getting initial task time...
-    entity_dimension = entity_list[e].first;                                                        // Getting entity dimension [#]...
-    entity_tag       = entity_list[e].second;                                                       // Getting entity tag [#]...
-
-    // Getting entity nodes, where:
-    // N = number of nodes
-    // dim = entity dimension
-    gmsh::model::mesh::getNodes (
-                                 all_node_list,                                                     // Node tags list [N].
-                                 all_node_coordinates,                                              // Node coordinates list [3*N].
-                                 all_node_parametric_coordinates,                                   // Node parametric coordinates [dim*N].
-                                 entity_dimension,                                                  // Entity dimension [#].
-                                 entity_tag                                                         // Entity tag [#].
-                                );
-
-    all_nodes = all_node_list.size ();                                                              // Getting the nubmer of all mesh nodes...
+    // Getting nodes in the physical group:
+    msh_physical_nodes (
+                        loc_physical_group_tag,                                                     // Physical group tag.
+                        loc_physical_group_dimension,                                               // Physical group dimension.
+                        loc_node_tag                                                                // Node tags.
+                       );
 
-    // For each mesh node:
-    for(i = 0; i < all_nodes; i++)
+    // Checking element type:
+    if((loc_element_type < 1) || (loc_element_type > MSH_MAX_NUM) ||
+       (msh_element_size (loc_element_type) == 0))
     {
-      node_coordinates.push_back (
-      {
-        (float)all_node_coordinates[3*i + 0],                                                       // Setting node "x" coordinate...
-        (float)all_node_coordinates[3*i + 1],                                                       // Setting node "y"coordinate...
-        (float)all_node_coordinates[3*i + 2],                                                       // Setting node "z" coordinate...
-        1.0f                                                                                        // Setting node "w" coordinate...
-      }
-                                 );                                                                 // Adding node to node vector...
+      neutrino::error ("unsupported MSH element type!");                                            // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
     }
 
-    neutrino::progress ("finding all mesh node coordinates... ", 0, entities, e);                   // Printing progress message...
+    loc_type_size        = (int)msh_element_size (loc_element_type);                                // Getting number of nodes for given element type...
+    loc_all_element_size = msh_element_node[loc_element_type].size ()/loc_type_size;                // Getting number of element among all entities...
   }
 
-  neutrino::done ();                                                                                // Printing message...
+  #ifndef NU_NO_GMSH
+  if(reader == GMSH)
+  {
+    // Getting nodes in the physical group:
+    gmsh::model::mesh::getNodesForPhysicalGroup (
+                                                 loc_physical_group_dimension,                      // Physical group dimension.
+                                                 loc_physical_group_tag,                            // Physical group tag.
+                                                 loc_node_tag,                                      // Node tags.
+                                                 loc_node_coordinates                               // Node coordinates.
+                                                );
+
+    // Getting element type properties:
+    gmsh::model::mesh::getElementProperties (
+                                             loc_element_type,                                      // Element type [#].
+                                             loc_type_name,                                         // Element type name [string].
+                                             loc_type_dimension,                                    // Element type dimension [#].
+                                             loc_type_order,                                        // Element type order [#].
+                                             loc_type_size,                                         // Number of nodes for given element type [#].
+                                             loc_type_node_coordinates,                             // Element type node local coordinates [vector].
+                                             loc_type_primary_nodes                                 // Number of primary type nodes [#].
+                                            );
 
-  // Getting nodes in the physical group:
-  gmsh::model::mesh::getNodesForPhysicalGroup (
-                                               loc_physical_group_dimension,                        // Physical group dimension.
-                                               loc_physical_group_tag,                              // Physical group tag.
-                                               loc_node_tag,                                        // Node tags.
-                                               loc_node_coordinates                                 // Node coordinates.
-                                              );
+    // Getting elements for all entities:
+    gmsh::model::mesh::getElementsByType (
+                                          loc_element_type,
+                                          loc_all_element_tag,
+                                          loc_all_element_node,
+                                          -1,
+                                          0,
+                                          1
+                                         );
+
+    loc_all_element_size = loc_all_element_tag.size ();                                             // Getting number of element among all entities...
+  }
+  #endif
 
-  loc_node_size = loc_node_tag.size ();                                                             // Getting node tag vector size...
+  loc_node_size     = loc_node_tag.size ();                                                         // Getting node tag vector size...
+  loc_element_nodes = (size_t)loc_type_size;                                                        // Getting number of nodes in element type...
 
   neutrino::done ();                                                                                // Printing message...
 
@@ -153,75 +255,122 @@ void nu::mesh::process (
 
   neutrino::action ("finding mesh elements in the given physical group...");                        // Printing message...
 
-  // Getting element type properties:
-  gmsh::model::mesh::getElementProperties (
-                                           loc_element_type,                                        // Element type [#].
-                                           loc_type_name,                                           // Element type name [string].
-                                           loc_type_dimension,                                      // Element type dimension [#].
-                                           loc_type_order,                                          // Element type order [#].
-                                           loc_type_size,                                           // Number of nodes for given element type [#].
-                                           loc_type_node_coordinates,                               // Element type node local coordinates [vector].
-                                           loc_type_primary_nodes                                   // Number of primary type nodes [#].
-                                          );
-
-  // Getting elements for all entities:
-  gmsh::model::mesh::getElementsByType (
-                                        loc_element_type,
-                                        loc_all_element_tag,
-                                        loc_all_element_node,
-                                        -1,
-                                        0,
-                                        1
-                                       );
-
-  loc_all_element_size = loc_all_element_tag.size ();                                               // Getting number of element among all entities...
-  loc_node_tag_sorted  = loc_node_tag;                                                              // Initializing sorted node tags...
-  std::sort (loc_node_tag_sorted.begin (), loc_node_tag_sorted.end ());                             // Sorting node tag vector (for fast binary search)...
-  s                    = 0;                                                                         // Resetting stride index...
+  // Building membership table (constant time node lookup):
+  loc_node_member.assign (
+                          loc_node_size ? *std::max_element (loc_node_tag.begin (), loc_node_tag.end ()) + 1 : 0,
+                          false
+                         );
+
+  for(i = 0; i < loc_node_size; i++)
+  {
+    loc_node_member[loc_node_tag[i]] = true;                                                        // Setting node membership...
+  }
+
+  s                = element.size ();                                                               // Initializing stride index (shared arrays)...
+  loc_element_base = element_offset.size ();                                                        // Getting first element index of the request...
 
   // For each "k" element:
   for(k = 0; k < loc_all_element_size; k++)
   {
     neutrino::work ();                                                                              // Getting initial task time...
 
-    loc_element_offset = k*loc_type_size;                                                           // Computing element offset...
+    loc_element_offset = k*loc_element_nodes;                                                       // Computing element offset...
     loc_node_found     = 0;                                                                         // Resetting found nodes counter...
 
     // For each "n" node in the element stride:
-    for(n = 0; n < loc_type_size; n++)
+    for(n = 0; n < loc_element_nodes; n++)
     {
       m               = loc_element_offset + n;                                                     // Computing node index...
 
+      // Getting node tag of the "m" node:
+      if(reader == NATIVE)
+      {
+        loc_element_node_tag = (size_t)msh_element_node[loc_element_type][m] + 1;                   // Getting node tag from native reader...
+      }
+      else
+      {
+        loc_element_node_tag = loc_all_element_node[m];                                             // Getting node tag from GMSH...
+      }
+
       // Counting how many "m" nodes of the "k" element are present in the physical group:
-      loc_node_found += std::binary_search (
-                                            loc_node_tag_sorted.begin (),
-                                            loc_node_tag_sorted.end (),
-                                            loc_all_element_node[m]
-                                           );
+      loc_node_found += (loc_element_node_tag < loc_node_member.size ()) &&
+                        loc_node_member[loc_element_node_tag];
     }
 
     // Checking whether all nodes of the "k" elements are present in the physical group:
-    if(loc_node_found == loc_type_size)
+    if(loc_node_found == loc_element_nodes)
     {
       // Building vector of the element nodes present in the physical group:
-      for(n = 0; n < loc_type_size; n++)
+      for(n = 0; n < loc_element_nodes; n++)
       {
         m = loc_element_offset + n;                                                                 // Computing node index...
-        element.push_back ((GLint)(loc_all_element_node[m] - 1));                                   // Adding index of node tag to element vector...
+
+        if(reader == NATIVE)
+        {
+          element.push_back (msh_element_node[loc_element_type][m]);                                // Adding index of node tag to element vector...
+        }
+        else
+        {
+          element.push_back ((GLint)(loc_all_element_node[m] - 1));                                 // Adding index of node tag to element vector...
+        }
       }
 
-      s += loc_type_size;                                                                           // Incrementing stride index...
+      s += loc_element_nodes;                                                                       // Incrementing stride index...
       element_offset.push_back ((GLint)s);                                                          // Setting element offset...
     }
 
-    neutrino::progress ("building element vectors... ", 0, loc_node_size, i);                       // Printing progress message...
+    neutrino::progress ("building element vectors... ", 0, loc_all_element_size, k);                // Printing progress message...
   }
 
   neutrino::done ();                                                                                // Printing message...
 
-  loc_element_size     = element_offset.size ();                                                    // Getting the number of elements in the physical group...
-  loc_group_offset     = 0;                                                                         // Resetting group offset counter...
-  loc_neighbour_offset = 0;                                                                         // Resetting neighbour offeset counter...
+  loc_element_size     = element_offset.size ();                                                    // Getting the number of elements (all requests up to this one)...
+  loc_group_offset     = group.size ();                                                             // Initializing group offset counter (shared arrays)...
+  loc_neighbour_offset = neighbour_offset.empty () ? 0 : neighbour_offset.back ();                  // Initializing neighbour offeset counter (shared arrays)...
+
+  if(topology == COMPACT_16)
+  {
+    // Checking number of nodes:
+    if(loc_node_size > NU_MESH_LOCAL_16_MAX)
+    {
+      neutrino::error ("too many nodes in physical group for COMPACT_16 topology!");                // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    // Building local index table:
+    for(i = 0; i < loc_node_size; i++)
+    {
+      loc_local.push_back (std::make_pair (loc_node_tag[i] - 1, (GLint)i));                         // Adding local index of "i" node...
+    }
+
+    std::sort (loc_local.begin (), loc_local.end ());                                               // Sorting local index table by node index...
+  }
+
+  // Building node to element incidence of the request (CSR, elements in ascending order):
+  loc_incidence_offset.assign (loc_node_member.size () + 1, 0);
+
+  for(m = (loc_element_base == 0) ? 0 : element_offset[loc_element_base - 1]; m < element.size (); m++)
+  {
+    if((size_t)element[m] + 1 < loc_node_member.size ())
+    {
+      loc_incidence_offset[element[m] + 2]++;                                                       // Counting "m" position of the node...
+    }
+  }
+
+  for(j = 1; j < loc_incidence_offset.size (); j++)
+  {
+    loc_incidence_offset[j] += loc_incidence_offset[j - 1];                                         // Accumulating node incidence offsets...
+  }
+
+  loc_incidence.resize (loc_incidence_offset.back ());                                              // Allocating incidence...
+
+  for(m = (loc_element_base == 0) ? 0 : element_offset[loc_element_base - 1]; m < element.size (); m++)
+  {
+    if((size_t)element[m] + 1 < loc_node_member.size ())
+    {
+      loc_incidence[loc_incidence_offset[element[m] + 1]++] = m;                                    // Adding "m" position to the node...
+    }
+  }
 
   // For each "i" node:
   for(i = 0; i < loc_node_size; i++)
@@ -230,37 +379,26 @@ void nu::mesh::process (
 
     j = loc_node_tag[i] - 1;                                                                        // Setting index of node tag...
 
-    // For each "k" element:
-    for(k = 0; k < loc_element_size; k++)
+    // For each "m" position of the "j" node in the elements of the request (ascending "k"):
+    for(n = loc_incidence_offset[j]; n < loc_incidence_offset[j + 1]; n++)
     {
-      // Computing minimum element offset index:
-      if(k == 0)
-      {
-        m_min = 0;                                                                                  // Setting minimum element offset index...
-      }
-      else
-      {
-        m_min = element_offset[k - 1];                                                              // Setting minimum element offset index...
-      }
-
+      m = loc_incidence[n];                                                                         // Getting element node position...
+      k = (size_t)(std::upper_bound (
+                                     element_offset.begin () + loc_element_base,
+                                     element_offset.begin () + loc_element_size,
+                                     (GLint)m
+                                    ) - element_offset.begin ());                                   // Getting element containing "m"...
+      m_min = (k == 0) ? 0 : element_offset[k - 1];                                                 // Setting minimum element offset index...
       m_max = element_offset[k];                                                                    // Setting maximum element offset index...
 
-      // For each "m" node in the "k" element:
-      for(m = m_min; m < m_max; m++)
-      {
-        // Checking whether the "k" element contains the "j" node:
-        if(element[m] == j)
-        {
-          group.push_back ((GLint)k);                                                               // Adding "k" element to the group...
-          loc_group_offset++;                                                                       // Incrementing group offset counter...
-          loc_neighbour.insert (
-                                loc_neighbour.end (),
-                                element.begin () + m_min,
-                                element.begin () + m_max
-                               );                                                                   // Appending the "k" element type nodes to the neighbour unit...
-          loc_neighbour.erase (loc_neighbour.end () - m_max + m);                                   // Erasing the central node from the neighbour unit...
-        }
-      }
+      group.push_back ((GLint)k);                                                                   // Adding "k" element to the group...
+      loc_group_offset++;                                                                           // Incrementing group offset counter...
+      loc_neighbour.insert (
+                            loc_neighbour.end (),
+                            element.begin () + m_min,
+                            element.begin () + m_max
+                           );                                                                       // Appending the "k" element type nodes to the neighbour unit...
+      loc_neighbour.erase (loc_neighbour.end () - m_max + m);                                       // Erasing the central node from the neighbour unit...
     }
 
     // Eliminating repeated indexes:
@@ -284,34 +422,72 @@ void nu::mesh::process (
     group_offset.push_back ((GLint)loc_group_offset);                                               // Setting "i" group offset...
 
     // For each "s" neighbour node in the "j" stride:
-    for(s = 0; s < loc_neighbour_size; s++)
+    for(s = 0; s < (size_t)loc_neighbour_size; s++)
     {
       n          = loc_neighbour[s];                                                                // Getting neighbour index...
-      neighbour.push_back ((GLint)n);                                                               // Setting neighbour index...
-      neighbour_center.push_back ((GLint)j);                                                        // Setting neighbour center...
       loc_link_x = node_coordinates[n].x - node_coordinates[j].x;                                   // Setting link "x" coordinate...
       loc_link_y = node_coordinates[n].y - node_coordinates[j].y;                                   // Setting link "y" coordinate...
       loc_link_z = node_coordinates[n].z - node_coordinates[j].z;                                   // Setting link "z" coordinate...
       loc_link_w = 0.0f;                                                                            // Setting link "w" coordinate...
 
-      // Setting neighbour link vector:
-      neighbour_link.push_back (
+      switch(topology)
       {
-        loc_link_x,                                                                                 // Setting link "x" component...
-        loc_link_y,                                                                                 // Setting link "y" component...
-        loc_link_z,                                                                                 // Setting link "z" component...
-        loc_link_w                                                                                  // Setting link "w" component...
+        case FULL:
+          neighbour.push_back ((GLint)n);                                                           // Setting neighbour index...
+          neighbour_center.push_back ((GLint)j);                                                    // Setting neighbour center...
+
+          // Setting neighbour link vector:
+          neighbour_link.push_back (
+          {
+            loc_link_x,                                                                             // Setting link "x" component...
+            loc_link_y,                                                                             // Setting link "y" component...
+            loc_link_z,                                                                             // Setting link "z" component...
+            loc_link_w                                                                              // Setting link "w" component...
+          }
+                                   );
+
+          // Setting neighbour length vector:
+          neighbour_length.push_back (
+                                      (GLfloat)sqrt (
+                                                     pow (loc_link_x, 2) +
+                                                     pow (loc_link_y, 2) +
+                                                     pow (loc_link_z, 2)
+                                                    )
+                                     );
+          break;
+
+        case COMPACT:
+          neighbour.push_back ((GLint)n);                                                           // Setting neighbour index...
+          break;
+
+        case COMPACT_16:
+          loc_local_index = std::lower_bound (
+                                              loc_local.begin (),
+                                              loc_local.end (),
+                                              std::make_pair (n, (GLint)0)
+                                             )->second;                                             // Finding neighbour local index...
+          m               = loc_neighbour_offset - loc_neighbour_size + s;                          // Computing global neighbour entry...
+
+          // Packing two 16-bit local indices per integer:
+          if((m & 1) == 0)
+          {
+            neighbour_local.push_back (loc_local_index);                                            // Setting low half...
+          }
+          else
+          {
+            neighbour_local.back () |= (GLint)((GLuint)loc_local_index << 16);                      // Setting high half...
+          }
+
+          break;
       }
-                               );
 
-      // Setting neighbour length vector:
-      neighbour_length.push_back (
-                                  (GLfloat)sqrt (
-                                                 pow (loc_link_x, 2) +
-                                                 pow (loc_link_y, 2) +
-                                                 pow (loc_link_z, 2)
-                                                )
-                                 );
+      // Setting packed neighbour link vector:
+      if((topology != FULL) && topology_link)
+      {
+        neighbour_link_packed.push_back (loc_link_x);                                               // Setting link "x" component...
+        neighbour_link_packed.push_back (loc_link_y);                                               // Setting link "y" component...
+        neighbour_link_packed.push_back (loc_link_z);                                               // Setting link "z" component...
+      }
     }
 
     loc_neighbour.clear ();                                                                         // Clearing neighbour unit for next "i"...
@@ -322,10 +498,1137 @@ void nu::mesh::process (
   neutrino::done ();                                                                                // Printing message...
 }
 
+void nu::mesh::process (
+                        int loc_physical_group_tag,                                                 // Physical group tag.
+                        int loc_physical_group_dimension,                                           // Physical group dimension.
+                        int loc_element_type                                                        // Element type.
+                       )
+{
+  // Processing a batch made of one single request:
+  process (
+           std::vector<mesh_request> (
+                                      1,
+                                      {
+                                        loc_physical_group_tag,                                     // Physical group tag.
+                                        loc_physical_group_dimension,                               // Physical group dimension.
+                                        loc_element_type                                            // Element type.
+                                      }
+                                     )
+          );
+}
+
+void nu::mesh::process (
+                        std::vector<mesh_request> loc_request                                       // Request list.
+                       )
+{
+  size_t r;                                                                                         // Request index.
+
+  // Clearing arrays:
+  node.clear ();                                                                                    // Clearing node indices (all nodes on physical group)...
+  element.clear ();                                                                                 // Clearing element indices...
+  element_offset.clear ();                                                                          // Clearing element offset indices...
+  group.clear ();                                                                                   // Clearing group indices...
+  group_offset.clear ();                                                                            // Clearing group offset indices...
+  neighbour.clear ();                                                                               // Clearing neighbour indices...
+  neighbour_center.clear ();                                                                        // Clearing neighbour center indices...
+  neighbour_offset.clear ();                                                                        // Clearing neighbour offset indices...
+  neighbour_link.clear ();                                                                          // Clearing neighbour links...
+  neighbour_length.clear ();                                                                        // Clearing neighbour link lengths...
+  neighbour_link_packed.clear ();                                                                   // Clearing packed neighbour links...
+  neighbour_local.clear ();                                                                         // Clearing neighbour local indices...
+  request_node_offset.clear ();                                                                     // Clearing request node offsets...
+  request_element_offset.clear ();                                                                  // Clearing request element offsets...
+  request_element_type.clear ();                                                                    // Clearing request element types...
+  request_node_ready = false;                                                                       // Invalidating request node position maps...
+  clear_changes ();                                                                                 // Clearing change set...
+
+  process_nodes ();                                                                                 // Reading node coordinates (once for all requests)...
+
+  // For each "r" request:
+  for(r = 0; r < loc_request.size (); r++)
+  {
+    process_request (
+                     loc_request[r].tag,                                                            // Physical group tag.
+                     loc_request[r].dimension,                                                      // Physical group dimension.
+                     loc_request[r].type                                                            // Element type.
+                    );
+
+    request_node_offset.push_back ((GLint)node.size ());                                            // Setting "r" request node offset...
+    request_element_offset.push_back ((GLint)element_offset.size ());                               // Setting "r" request element offset...
+    request_element_type.push_back (loc_request[r].type);                                           // Setting "r" request element type...
+  }
+}
+
+void nu::mesh::set_topology (
+                             mesh_topology loc_topology,                                            // Topology mode.
+                             bool          loc_link                                                 // Link flag.
+                            )
+{
+  topology      = loc_topology;                                                                     // Setting topology mode...
+  topology_link = loc_link;                                                                         // Setting topology link flag...
+}
+
+size_t nu::mesh::neighbour_bytes ()
+{
+  return sizeof (GLint)*neighbour.size () +                                                         // Neighbour indices...
+         sizeof (GLint)*neighbour_center.size () +                                                  // Neighbour center indices...
+         sizeof (GLint)*neighbour_offset.size () +                                                  // Neighbour offset indices...
+         sizeof (nu_float4_structure)*neighbour_link.size () +                                      // Neighbour links...
+         sizeof (GLfloat)*neighbour_length.size () +                                                // Neighbour link lengths...
+         sizeof (GLfloat)*neighbour_link_packed.size () +                                           // Packed neighbour links...
+         sizeof (GLint)*neighbour_local.size ();                                                    // Neighbour local indices...
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
+////////////////////////////////////////// INCREMENTAL UPDATES ///////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-nu::mesh::~mesh()
+void nu::mesh::change (
+                       mesh_range& loc_range,                                                       // Changed range.
+                       size_t      loc_begin,                                                       // First index of the range.
+                       size_t      loc_end                                                          // Last index of the range + 1.
+                      )
+{
+  if(loc_begin >= loc_end)
+  {
+    return;                                                                                         // Nothing changed...
+  }
+
+  if(loc_range.begin >= loc_range.end)
+  {
+    loc_range.begin = (GLint)loc_begin;                                                             // Setting range begin...
+    loc_range.end   = (GLint)loc_end;                                                               // Setting range end...
+  }
+  else
+  {
+    loc_range.begin = std::min (loc_range.begin, (GLint)loc_begin);                                 // Extending range begin...
+    loc_range.end   = std::max (loc_range.end, (GLint)loc_end);                                     // Extending range end...
+  }
+}
+
+GLint nu::mesh::node_position (
+                               GLint  loc_node,                                                     // Node index.
+                               size_t loc_request                                                   // Request index.
+                              )
+{
+  std::map<GLint, GLint>::iterator loc_found;                                                       // Node position iterator.
+  size_t                           i;                                                               // Node position.
+  size_t                           r;                                                               // Request index.
+
+  // Rebuilding request node position maps:
+  if(!request_node_ready)
+  {
+    request_node_position.assign (request_node_offset.size (), std::map<GLint, GLint> ());
+
+    for(r = 0; r < request_node_offset.size (); r++)
+    {
+      for(i = ((r == 0) ? 0 : request_node_offset[r - 1]); i < (size_t)request_node_offset[r]; i++)
+      {
+        request_node_position[r][node[i]] = (GLint)i;                                               // Setting node position...
+      }
+    }
+
+    request_node_ready = true;                                                                      // Setting request node position maps flag...
+  }
+
+  loc_found = request_node_position[loc_request].find (loc_node);                                   // Finding node...
+
+  if(loc_found == request_node_position[loc_request].end ())
+  {
+    return -1;                                                                                      // Node not found...
+  }
+
+  return loc_found->second;                                                                         // Returning node position...
+}
+
+void nu::mesh::update_neighbour (
+                                 size_t loc_position                                                // Node position.
+                                )
 {
-  gmsh::finalize ();                                                                                // Finalizing GMSH...
+  std::vector<size_t>  loc_neighbour;                                                               // Neighbour unit.
+  std::vector<GLint>   loc_index;                                                                   // New neighbour indices.
+  std::vector<GLint>   loc_center;                                                                  // New neighbour centers.
+  std::vector<nu_float4_structure>
+                       loc_link;                                                                    // New neighbour links.
+  std::vector<GLfloat> loc_length;                                                                  // New neighbour lengths.
+  std::vector<GLfloat> loc_link_packed;                                                             // New packed neighbour links.
+  size_t               loc_begin;                                                                   // First neighbour entry of the node.
+  size_t               loc_end;                                                                     // Last neighbour entry of the node + 1.
+  GLint                loc_delta;                                                                   // Number of neighbour entries added.
+  size_t               j;                                                                           // Node index.
+  size_t               k;                                                                           // Element index.
+  size_t               g;                                                                           // Group entry index.
+  size_t               m;                                                                           // Element node index.
+  size_t               n;                                                                           // Neighbour index.
+  size_t               s;                                                                           // Neighbour entry index.
+  size_t               i;                                                                           // Node position.
+  GLfloat              loc_link_x;                                                                  // Link "x" coordinate.
+  GLfloat              loc_link_y;                                                                  // Link "y" coordinate.
+  GLfloat              loc_link_z;                                                                  // Link "z" coordinate.
+
+  j = node[loc_position];                                                                           // Getting node index...
+
+  // Building neighbour unit from the elements of the node group:
+  for(g = ((loc_position == 0) ? 0 : group_offset[loc_position - 1]); g < (size_t)group_offset[loc_position]; g++)
+  {
+    k = group[g];                                                                                   // Getting element index...
+
+    for(m = ((k == 0) ? 0 : element_offset[k - 1]); m < (size_t)element_offset[k]; m++)
+    {
+      if((size_t)element[m] != j)
+      {
+        loc_neighbour.push_back (element[m]);                                                       // Adding element node to the neighbour unit...
+      }
+    }
+  }
+
+  // Eliminating repeated indexes:
+  std::sort (loc_neighbour.begin (), loc_neighbour.end ());
+  loc_neighbour.erase (std::unique (loc_neighbour.begin (), loc_neighbour.end ()), loc_neighbour.end ());
+
+  loc_begin = (loc_position == 0) ? 0 : neighbour_offset[loc_position - 1];                         // Getting first neighbour entry...
+  loc_end   = neighbour_offset[loc_position];                                                       // Getting last neighbour entry + 1...
+  loc_delta = (GLint)loc_neighbour.size () - (GLint)(loc_end - loc_begin);                          // Computing number of entries added...
+
+  // Building new neighbour entries:
+  for(s = 0; s < loc_neighbour.size (); s++)
+  {
+    n          = loc_neighbour[s];                                                                  // Getting neighbour index...
+    loc_link_x = node_coordinates[n].x - node_coordinates[j].x;                                     // Setting link "x" coordinate...
+    loc_link_y = node_coordinates[n].y - node_coordinates[j].y;                                     // Setting link "y" coordinate...
+    loc_link_z = node_coordinates[n].z - node_coordinates[j].z;                                     // Setting link "z" coordinate...
+
+    loc_index.push_back ((GLint)n);                                                                 // Setting neighbour index...
+
+    if(topology == FULL)
+    {
+      loc_center.push_back ((GLint)j);                                                              // Setting neighbour center...
+      loc_link.push_back ({loc_link_x, loc_link_y, loc_link_z, 0.0f});                              // Setting neighbour link...
+      loc_length.push_back (
+                            (GLfloat)sqrt (
+                                           pow (loc_link_x, 2) +
+                                           pow (loc_link_y, 2) +
+                                           pow (loc_link_z, 2)
+                                          )
+                           );                                                                       // Setting neighbour length...
+    }
+
+    if((topology != FULL) && topology_link)
+    {
+      loc_link_packed.push_back (loc_link_x);                                                       // Setting packed link "x" component...
+      loc_link_packed.push_back (loc_link_y);                                                       // Setting packed link "y" component...
+      loc_link_packed.push_back (loc_link_z);                                                       // Setting packed link "z" component...
+    }
+  }
+
+  // Replacing old neighbour entries (one move of the following entries per array):
+  replace (neighbour, loc_begin, loc_end, loc_index);
+
+  if(topology == FULL)
+  {
+    replace (neighbour_center, loc_begin, loc_end, loc_center);
+    replace (neighbour_link, loc_begin, loc_end, loc_link);
+    replace (neighbour_length, loc_begin, loc_end, loc_length);
+  }
+
+  if((topology != FULL) && topology_link)
+  {
+    replace (neighbour_link_packed, 3*loc_begin, 3*loc_end, loc_link_packed);
+  }
+
+  // Patching neighbour offsets:
+  if(loc_delta != 0)
+  {
+    for(i = loc_position; i < neighbour_offset.size (); i++)
+    {
+      neighbour_offset[i] += loc_delta;                                                             // Shifting neighbour offset...
+    }
+
+    change (changed.neighbour, loc_begin, neighbour.size ());                                       // Setting changed neighbour range...
+    change (changed.neighbour_offset, loc_position, neighbour_offset.size ());                      // Setting changed neighbour offset range...
+  }
+  else
+  {
+    change (changed.neighbour, loc_begin, loc_end);                                                 // Setting changed neighbour range...
+  }
+}
+
+GLint nu::mesh::add_node (
+                          nu_float4_structure loc_coordinates                                       // Node coordinates.
+                         )
+{
+  GLint loc_node;                                                                                   // Node index.
+
+  if(request_node_offset.empty ())
+  {
+    request_node_offset.push_back (0);                                                              // Adding empty request...
+    request_element_offset.push_back (0);                                                           // Adding empty request...
+    request_element_type.push_back (0);                                                             // Adding empty request (unknown element type)...
+    request_node_ready = false;                                                                     // Invalidating request node position maps...
+  }
+
+  loc_node = (GLint)node_coordinates.size ();                                                       // Getting new node index...
+  node_coordinates.push_back (loc_coordinates);                                                     // Adding node coordinates...
+  node.push_back (loc_node);                                                                        // Adding node to the last request...
+
+  if(request_node_ready)
+  {
+    request_node_position.back ()[loc_node] = (GLint)(node.size () - 1);                            // Setting node position...
+  }
+
+  group_offset.push_back (group_offset.empty () ? 0 : group_offset.back ());                        // Adding empty group...
+  neighbour_offset.push_back (neighbour_offset.empty () ? 0 : neighbour_offset.back ());            // Adding empty neighbour unit...
+  request_node_offset.back ()++;                                                                    // Incrementing last request node offset...
+
+  change (changed.node_coordinates, loc_node, node_coordinates.size ());                            // Setting changed node coordinates range...
+  change (changed.node, node.size () - 1, node.size ());                                            // Setting changed node range...
+  change (changed.group_offset, node.size () - 1, node.size ());                                    // Setting changed group offset range...
+  change (changed.neighbour_offset, node.size () - 1, node.size ());                                // Setting changed neighbour offset range...
+
+  return loc_node;                                                                                  // Returning node index...
+}
+
+GLint nu::mesh::add_element (
+                             std::vector<GLint> loc_element_node                                    // Element node indices.
+                            )
+{
+  GLint              loc_element;                                                                   // Element index.
+  std::vector<GLint> loc_position;                                                                  // Element node positions.
+  size_t             loc_request;                                                                   // Request index.
+  size_t             loc_group;                                                                     // Group insertion index.
+  GLint              loc_found;                                                                     // Node position (-1 = not found).
+  size_t             i;                                                                             // Node position.
+  size_t             n;                                                                             // Element node index.
+
+  if(topology == COMPACT_16)
+  {
+    neutrino::error ("incremental mesh updates not supported in COMPACT_16 topology!");             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(request_node_offset.empty ())
+  {
+    request_node_offset.push_back (0);                                                              // Adding empty request...
+    request_element_offset.push_back (0);                                                           // Adding empty request...
+    request_element_type.push_back (0);                                                             // Adding empty request (unknown element type)...
+    request_node_ready = false;                                                                     // Invalidating request node position maps...
+  }
+
+  loc_request = request_node_offset.size () - 1;                                                    // Getting last request...
+
+  // Adding element:
+  loc_element = (GLint)element_offset.size ();                                                      // Getting new element index...
+  change (changed.element, element.size (), element.size () + loc_element_node.size ());            // Setting changed element range...
+  element.insert (element.end (), loc_element_node.begin (), loc_element_node.end ());              // Adding element nodes...
+  element_offset.push_back ((GLint)element.size ());                                                // Adding element offset...
+  request_element_offset.back ()++;                                                                 // Incrementing last request element offset...
+  change (changed.element_offset, loc_element, element_offset.size ());                             // Setting changed element offset range...
+
+  // For each "n" node of the element:
+  for(n = 0; n < loc_element_node.size (); n++)
+  {
+    if((loc_element_node[n] < 0) || ((size_t)loc_element_node[n] >= node_coordinates.size ()))
+    {
+      neutrino::error ("element node index out of range!");                                         // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    loc_found = node_position (loc_element_node[n], loc_request);                                   // Getting node position...
+
+    // Adding node to the request, if not present:
+    if(loc_found < 0)
+    {
+      node.push_back (loc_element_node[n]);                                                         // Adding node to the last request...
+      group_offset.push_back (group_offset.empty () ? 0 : group_offset.back ());                    // Adding empty group...
+      neighbour_offset.push_back (neighbour_offset.empty () ? 0 : neighbour_offset.back ());        // Adding empty neighbour unit...
+      request_node_offset.back ()++;                                                                // Incrementing last request node offset...
+      change (changed.node, node.size () - 1, node.size ());                                        // Setting changed node range...
+      loc_found = (GLint)(node.size () - 1);                                                        // Setting node position...
+      request_node_position[loc_request][loc_element_node[n]] = loc_found;                          // Setting node position map...
+    }
+
+    loc_position.push_back (loc_found);                                                             // Adding node position...
+  }
+
+  // Removing repeated positions (degenerate elements):
+  std::sort (loc_position.begin (), loc_position.end ());
+  loc_position.erase (std::unique (loc_position.begin (), loc_position.end ()), loc_position.end ());
+
+  // Adding element to the node groups:
+  for(n = 0; n < loc_position.size (); n++)
+  {
+    loc_group = group_offset[loc_position[n]];                                                      // Getting group insertion index...
+    group.insert (group.begin () + loc_group, loc_element);                                         // Adding element to the group...
+
+    for(i = loc_position[n]; i < group_offset.size (); i++)
+    {
+      group_offset[i]++;                                                                            // Shifting group offset...
+    }
+
+    change (changed.group, loc_group, group.size ());                                               // Setting changed group range...
+    change (changed.group_offset, loc_position[n], group_offset.size ());                           // Setting changed group offset range...
+  }
+
+  // Updating neighbours:
+  for(n = 0; n < loc_position.size (); n++)
+  {
+    update_neighbour (loc_position[n]);                                                             // Updating node neighbours...
+  }
+
+  return loc_element;                                                                               // Returning element index...
+}
+
+void nu::mesh::remove_element (
+                               GLint loc_element                                                    // Element index.
+                              )
+{
+  std::vector<GLint> loc_element_node;                                                              // Element node indices.
+  std::vector<GLint> loc_position;                                                                  // Element node positions.
+  size_t             loc_request;                                                                   // Request index.
+  size_t             loc_begin;                                                                     // First element node index.
+  size_t             loc_end;                                                                       // Last element node index + 1.
+  size_t             loc_group;                                                                     // Group entry index (new).
+  GLint              loc_first;                                                                     // First changed node position.
+  GLint              loc_found;                                                                     // Node position (-1 = not found).
+  size_t             g;                                                                             // Group entry index.
+  size_t             g_min;                                                                         // First group entry of the node.
+  size_t             i;                                                                             // Node position.
+  size_t             k;                                                                             // Element index.
+  size_t             n;                                                                             // Element node index.
+
+  if(topology == COMPACT_16)
+  {
+    neutrino::error ("incremental mesh updates not supported in COMPACT_16 topology!");             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if((loc_element < 0) || ((size_t)loc_element >= element_offset.size ()))
+  {
+    neutrino::error ("element index out of range!");                                                // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Finding element request:
+  loc_request = 0;                                                                                  // Resetting request index...
+
+  while(request_element_offset[loc_request] <= loc_element)
+  {
+    loc_request++;                                                                                  // Incrementing request index...
+  }
+
+  // Removing element:
+  loc_begin = (loc_element == 0) ? 0 : element_offset[loc_element - 1];                             // Getting first element node index...
+  loc_end   = element_offset[loc_element];                                                          // Getting last element node index + 1...
+  loc_element_node.assign (element.begin () + loc_begin, element.begin () + loc_end);               // Saving element nodes...
+  element.erase (element.begin () + loc_begin, element.begin () + loc_end);                         // Erasing element nodes...
+  element_offset.erase (element_offset.begin () + loc_element);                                     // Erasing element offset...
+
+  for(k = loc_element; k < element_offset.size (); k++)
+  {
+    element_offset[k] -= (GLint)(loc_end - loc_begin);                                              // Shifting element offset...
+  }
+
+  for(k = loc_request; k < request_element_offset.size (); k++)
+  {
+    request_element_offset[k]--;                                                                    // Shifting request element offset...
+  }
+
+  change (changed.element, loc_begin, element.size ());                                             // Setting changed element range...
+  change (changed.element_offset, loc_element, element_offset.size ());                             // Setting changed element offset range...
+
+  // Removing element from groups and renumbering the following elements:
+  loc_group = 0;                                                                                    // Resetting group entry index...
+  loc_first = -1;                                                                                   // Resetting first changed node position...
+  g_min     = 0;                                                                                    // Resetting first group entry...
+
+  for(i = 0; i < group_offset.size (); i++)
+  {
+    for(g = g_min; g < (size_t)group_offset[i]; g++)
+    {
+      if(group[g] != loc_element)
+      {
+        group[loc_group++] = group[g] - ((group[g] > loc_element) ? 1 : 0);                         // Renumbering group entry...
+      }
+      else if(loc_first < 0)
+      {
+        loc_first = (GLint)i;                                                                       // Setting first changed node position...
+      }
+    }
+
+    g_min           = group_offset[i];                                                              // Setting next first group entry...
+    group_offset[i] = (GLint)loc_group;                                                             // Setting new group offset...
+  }
+
+  group.resize (loc_group);                                                                         // Resizing group array...
+
+  if(loc_first >= 0)
+  {
+    g_min = (loc_first == 0) ? 0 : group_offset[loc_first - 1];                                     // Getting first changed group entry...
+    change (changed.group, g_min, group.size ());                                                   // Setting changed group range...
+    change (changed.group_offset, loc_first, group_offset.size ());                                 // Setting changed group offset range...
+  }
+
+  // Renumbered elements, not containing any of the removed element nodes:
+  for(g = 0; g < group.size (); g++)
+  {
+    if(group[g] >= loc_element)
+    {
+      change (changed.group, g, group.size ());                                                     // Setting changed group range...
+      break;
+    }
+  }
+
+  // Updating neighbours:
+  for(n = 0; n < loc_element_node.size (); n++)
+  {
+    loc_found = node_position (loc_element_node[n], loc_request);                                   // Getting node position...
+
+    if(loc_found >= 0)
+    {
+      update_neighbour (loc_found);                                                                 // Updating node neighbours...
+    }
+  }
+}
+
+void nu::mesh::remove_node (
+                            GLint loc_node                                                          // Node index.
+                           )
+{
+  std::vector<GLint> loc_element;                                                                   // Elements containing the node.
+  GLint              loc_found;                                                                     // Node position (-1 = not found).
+  size_t             r;                                                                             // Request index.
+  size_t             i;                                                                             // Node position.
+  size_t             k;                                                                             // Element index.
+  size_t             m;                                                                             // Element node index.
+
+  // Finding elements containing the node:
+  for(k = 0; k < element_offset.size (); k++)
+  {
+    for(m = ((k == 0) ? 0 : element_offset[k - 1]); m < (size_t)element_offset[k]; m++)
+    {
+      if(element[m] == loc_node)
+      {
+        loc_element.push_back ((GLint)k);                                                           // Adding element...
+        break;
+      }
+    }
+  }
+
+  // Removing elements (from the last one, not to renumber the others):
+  for(k = loc_element.size (); k > 0; k--)
+  {
+    remove_element (loc_element[k - 1]);                                                            // Removing element...
+  }
+
+  // Removing node from all requests (from the last one: the positions of the previous requests
+  // do not shift):
+  for(r = request_node_offset.size (); r > 0; r--)
+  {
+    loc_found = node_position (loc_node, r - 1);                                                    // Getting node position...
+
+    if(loc_found >= 0)
+    {
+      i = loc_found;                                                                                // Setting node position...
+      node.erase (node.begin () + i);                                                               // Erasing node...
+      group_offset.erase (group_offset.begin () + i);                                               // Erasing (empty) group...
+      neighbour_offset.erase (neighbour_offset.begin () + i);                                       // Erasing (empty) neighbour unit...
+
+      for(m = r - 1; m < request_node_offset.size (); m++)
+      {
+        request_node_offset[m]--;                                                                   // Shifting request node offset...
+      }
+
+      change (changed.node, i, node.size ());                                                       // Setting changed node range...
+      change (changed.group_offset, i, group_offset.size ());                                       // Setting changed group offset range...
+      change (changed.neighbour_offset, i, neighbour_offset.size ());                               // Setting changed neighbour offset range...
+    }
+  }
+
+  request_node_ready = false;                                                                       // Invalidating request node position maps (shifted)...
+}
+
+void nu::mesh::clear_changes ()
+{
+  changed.node_coordinates = {0, 0};                                                                // Clearing changed node coordinates range...
+  changed.node             = {0, 0};                                                                // Clearing changed node range...
+  changed.element          = {0, 0};                                                                // Clearing changed element range...
+  changed.element_offset   = {0, 0};                                                                // Clearing changed element offset range...
+  changed.group            = {0, 0};                                                                // Clearing changed group range...
+  changed.group_offset     = {0, 0};                                                                // Clearing changed group offset range...
+  changed.neighbour        = {0, 0};                                                                // Clearing changed neighbour range...
+  changed.neighbour_offset = {0, 0};                                                                // Clearing changed neighbour offset range...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// NATIVE MSH READER /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t nu::mesh::msh_element_size (
+                                   int loc_element_type                                             // Element type.
+                                  )
+{
+  // Number of nodes of each MSH element type (0 = variable or not supported):
+  static const size_t loc_size[MSH_MAX_NUM + 1] =
+  {
+    0,   2,   3,   4,   4,   8,   6,   5,   3,   6,                                                 // Types   0...9.
+    9,   10,  27,  18,  14,  1,   8,   20,  15,  13,                                                // Types  10...19.
+    9,   10,  12,  15,  15,  21,  4,   5,   6,   20,                                                // Types  20...29.
+    35,  56,  22,  28,  0,   0,   16,  25,  36,  12,                                                // Types  30...39.
+    16,  20,  28,  36,  45,  55,  66,  49,  64,  81,                                                // Types  40...49.
+    100, 121, 18,  21,  24,  27,  30,  24,  28,  32,                                                // Types  50...59.
+    36,  40,  7,   8,   9,   10,  11,  0,   0,   0,                                                 // Types  60...69.
+    0,   84,  120, 165, 220, 286, 0,   0,   0,   34,                                                // Types  70...79.
+    40,  46,  52,  58,  1,   1,   1,   1,   1,   1,                                                 // Types  80...89.
+    40,  75,  64,  125, 216, 343, 512, 729, 1000, 32,                                               // Types  90...99.
+    44,  56,  68,  80,  92,  104, 126, 196, 288, 405,                                               // Types 100...109.
+    550, 24,  33,  42,  51,  60,  69,  78,  30,  55,                                                // Types 110...119.
+    91,  140, 204, 285, 385, 21,  29,  37,  45,  53,                                                // Types 120...129.
+    61,  69,  1,   0,   0,   0,   0,   16,  4,   5,                                                 // Types 130...139.
+    4                                                                                               // Type  140.
+  };
+
+  if((loc_element_type < 0) || (loc_element_type > MSH_MAX_NUM))
+  {
+    return 0;                                                                                       // Returning unknown size...
+  }
+
+  return loc_size[loc_element_type];                                                                // Returning element size...
+}
+
+void nu::mesh::msh_skip (
+                         std::istream& loc_stream                                                   // MSH file stream.
+                        )
+{
+  std::string loc_line;                                                                             // MSH file line.
+
+  // Reading lines up to the end of the current section:
+  while(std::getline (loc_stream, loc_line))
+  {
+    if(loc_line.compare (0, 4, "$End") == 0)
+    {
+      break;                                                                                        // Exiting at end of section...
+    }
+  }
+}
+
+void nu::mesh::msh_read (
+                         std::string loc_file_name                                                  // MSH file name.
+                        )
+{
+  std::ifstream loc_file;                                                                           // MSH file stream.
+  std::string   loc_line;                                                                           // MSH file line.
+  std::string   loc_version;                                                                        // MSH file version.
+  int           loc_file_type;                                                                      // MSH file type (0 = ASCII, 1 = binary).
+  int           loc_data_size;                                                                      // MSH data size [bytes].
+  int           loc_one;                                                                            // MSH endianness check value.
+  std::thread   loc_node_thread;                                                                    // Node reader thread.
+  bool          loc_entities;                                                                       // $Entities section found flag.
+
+  msh_binary = false;                                                                               // Resetting binary flag...
+  msh_physical.clear ();                                                                            // Clearing entity physical tags...
+  msh_block_list.clear ();                                                                          // Clearing element block list...
+  msh_element_node.clear ();                                                                        // Clearing element node vectors...
+  msh_element_node.resize (MSH_MAX_NUM + 1);                                                        // Allocating one element node vector per element type...
+  node_coordinates.clear ();                                                                        // Clearing node coordinates...
+  msh_node_tag.clear ();                                                                            // Clearing node tags...
+  msh_node_error.clear ();                                                                          // Clearing node reader error...
+  loc_entities = false;                                                                             // Resetting $Entities section found flag...
+
+  loc_file.open (loc_file_name, std::ios::in | std::ios::binary);                                   // Opening MSH file...
+
+  if(!loc_file.is_open ())
+  {
+    neutrino::error ("unable to open MSH file!");                                                   // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Reading MSH sections:
+  while(std::getline (loc_file, loc_line))
+  {
+    if(!loc_line.empty () && (loc_line.back () == '\r'))
+    {
+      loc_line.pop_back ();                                                                         // Removing DOS carriage return...
+    }
+
+    if(loc_line == "$MeshFormat")
+    {
+      loc_file >> loc_version >> loc_file_type >> loc_data_size;                                    // Reading MSH format...
+
+      if(loc_version != NU_MSH_VERSION)
+      {
+        neutrino::error ("native reader supports MSH " NU_MSH_VERSION " files only!");              // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      msh_binary = (loc_file_type == 1);                                                            // Setting binary flag...
+
+      if(msh_binary)
+      {
+        if(loc_data_size != sizeof (size_t))
+        {
+          neutrino::error ("unsupported MSH data size!");                                           // Printing message...
+          exit (EXIT_FAILURE);                                                                      // Exiting...
+        }
+
+        loc_file.get ();                                                                            // Skipping end of line...
+        loc_file.read ((char*)&loc_one, sizeof (int));                                              // Reading endianness check value...
+
+        if(loc_one != 1)
+        {
+          neutrino::error ("unsupported MSH endianness!");                                          // Printing message...
+          exit (EXIT_FAILURE);                                                                      // Exiting...
+        }
+      }
+
+      msh_skip (loc_file);                                                                          // Skipping to end of section...
+    }
+    else if(loc_line == "$Entities")
+    {
+      msh_entities (loc_file);                                                                      // Reading entities...
+      msh_skip (loc_file);                                                                          // Skipping to end of section...
+      loc_entities = true;                                                                          // Setting $Entities section found flag...
+    }
+    else if(loc_line == "$Nodes")
+    {
+      // Reading nodes in a separate thread, while going on with the elements:
+      loc_node_thread = std::thread (&nu::mesh::msh_nodes, this, loc_file_name, loc_file.tellg ());
+      msh_skip_nodes (loc_file);                                                                    // Skipping nodes...
+      msh_skip (loc_file);                                                                          // Skipping to end of section...
+    }
+    else if(loc_line == "$Elements")
+    {
+      msh_elements (loc_file);                                                                      // Reading elements...
+      msh_skip (loc_file);                                                                          // Skipping to end of section...
+    }
+    else if(loc_line.compare (0, 1, "$") == 0)
+    {
+      msh_skip (loc_file);                                                                          // Skipping unused section...
+    }
+  }
+
+  loc_file.close ();                                                                                // Closing MSH file...
+
+  if(!loc_node_thread.joinable ())
+  {
+    neutrino::error ("MSH file has no $Nodes section!");                                            // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_node_thread.join ();                                                                          // Waiting for node reader thread...
+
+  // Reporting node reader errors (on the calling thread):
+  if(!msh_node_error.empty ())
+  {
+    neutrino::error (msh_node_error);                                                               // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(!loc_entities)
+  {
+    neutrino::error ("MSH file has no $Entities section (no physical groups)!");                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  msh_renumber ();                                                                                  // Converting element node tags into compact node indices...
+}
+
+void nu::mesh::msh_entities (
+                             std::istream& loc_stream                                               // MSH file stream.
+                            )
+{
+  size_t           loc_count[4];                                                                    // Number of entities per dimension.
+  size_t           loc_physicals;                                                                   // Number of physical tags of the entity.
+  size_t           loc_boundings;                                                                   // Number of bounding entities of the entity.
+  int              loc_tag;                                                                         // Entity tag.
+  std::vector<int> loc_physical;                                                                    // Physical tags of the entity.
+  int              d;                                                                               // Dimension index.
+  size_t           e;                                                                               // Entity index.
+  size_t           p;                                                                               // Physical tag index.
+
+  // Reading number of points, curves, surfaces and volumes:
+  for(d = 0; d < 4; d++)
+  {
+    loc_count[d] = msh_value<size_t> (loc_stream);                                                  // Reading number of entities...
+  }
+
+  // For each "d" dimension:
+  for(d = 0; d < 4; d++)
+  {
+    // For each "e" entity:
+    for(e = 0; e < loc_count[d]; e++)
+    {
+      loc_tag = msh_value<int> (loc_stream);                                                        // Reading entity tag...
+
+      // Skipping point coordinates (d = 0) or bounding box (d > 0):
+      for(p = 0; p < ((d == 0) ? 3 : 6); p++)
+      {
+        msh_value<double> (loc_stream);                                                             // Skipping coordinate...
+      }
+
+      loc_physicals = msh_value<size_t> (loc_stream);                                               // Reading number of physical tags...
+      loc_physical.clear ();                                                                        // Clearing physical tags...
+
+      for(p = 0; p < loc_physicals; p++)
+      {
+        loc_physical.push_back (msh_value<int> (loc_stream));                                       // Reading physical tag...
+      }
+
+      if(d > 0)
+      {
+        loc_boundings = msh_value<size_t> (loc_stream);                                             // Reading number of bounding entities...
+
+        for(p = 0; p < loc_boundings; p++)
+        {
+          msh_value<int> (loc_stream);                                                              // Skipping bounding entity tag...
+        }
+      }
+
+      msh_physical[std::make_pair (d, loc_tag)] = loc_physical;                                     // Storing entity physical tags...
+    }
+  }
+}
+
+void nu::mesh::msh_nodes (
+                          std::string    loc_file_name,                                             // MSH file name.
+                          std::streampos loc_position                                               // $Nodes section data position.
+                         )
+{
+  std::ifstream       loc_file;                                                                     // MSH file stream.
+  size_t              loc_blocks;                                                                   // Number of entity blocks.
+  size_t              loc_nodes;                                                                    // Number of nodes.
+  size_t              loc_min_tag;                                                                  // Minimum node tag.
+  size_t              loc_max_tag;                                                                  // Maximum node tag.
+  int                 loc_dimension;                                                                // Entity dimension.
+  int                 loc_parametric;                                                               // Parametric coordinates flag.
+  size_t              loc_block_nodes;                                                              // Number of nodes in the block.
+  size_t              loc_stride;                                                                   // Number of coordinates per node.
+  size_t              loc_chunk;                                                                    // Number of nodes in the chunk.
+  std::vector<size_t> loc_tag;                                                                      // Node tags of the block.
+  std::vector<double> loc_coordinates;                                                              // Node coordinates of the chunk.
+  size_t              b;                                                                            // Block index.
+  size_t              i;                                                                            // Chunk index.
+  size_t              k;                                                                            // Node index.
+
+  loc_file.open (loc_file_name, std::ios::in | std::ios::binary);                                   // Opening MSH file...
+
+  if(!loc_file.is_open ())
+  {
+    msh_node_error = "unable to open MSH file!";                                                    // Setting error message...
+    return;
+  }
+
+  loc_file.seekg (loc_position);                                                                    // Moving to $Nodes section data...
+
+  loc_blocks    = msh_value<size_t> (loc_file);                                                     // Reading number of entity blocks...
+  loc_nodes     = msh_value<size_t> (loc_file);                                                     // Reading number of nodes...
+  loc_min_tag   = msh_value<size_t> (loc_file);                                                     // Reading minimum node tag...
+  loc_max_tag   = msh_value<size_t> (loc_file);                                                     // Reading maximum node tag...
+
+  node_coordinates.reserve (loc_nodes);                                                             // Reserving node coordinates (compact, in file order)...
+  msh_node_tag.reserve (loc_nodes);                                                                 // Reserving node tags...
+  loc_coordinates.resize (6*NU_MSH_CHUNK);                                                          // Allocating chunk (up to 6 coordinates per node)...
+
+  // For each "b" entity block:
+  for(b = 0; b < loc_blocks; b++)
+  {
+    loc_dimension   = msh_value<int> (loc_file);                                                    // Reading entity dimension...
+    msh_value<int> (loc_file);                                                                      // Skipping entity tag...
+    loc_parametric  = msh_value<int> (loc_file);                                                    // Reading parametric flag...
+    loc_block_nodes = msh_value<size_t> (loc_file);                                                 // Reading number of nodes in block...
+    loc_stride      = 3 + (loc_parametric ? loc_dimension : 0);                                     // Computing number of coordinates per node...
+    loc_tag.resize (loc_block_nodes);                                                               // Allocating block node tags...
+
+    // Reading block node tags:
+    if(msh_binary)
+    {
+      loc_file.read ((char*)loc_tag.data (), loc_block_nodes*sizeof (size_t));                      // Reading binary node tags...
+    }
+    else
+    {
+      for(k = 0; k < loc_block_nodes; k++)
+      {
+        loc_tag[k] = msh_value<size_t> (loc_file);                                                  // Reading ASCII node tag...
+      }
+    }
+
+    // For each "i" chunk of node coordinates:
+    for(i = 0; i < loc_block_nodes; i += NU_MSH_CHUNK)
+    {
+      loc_chunk = std::min ((size_t)NU_MSH_CHUNK, loc_block_nodes - i);                             // Computing chunk size...
+
+      // Reading chunk coordinates:
+      if(msh_binary)
+      {
+        loc_file.read ((char*)loc_coordinates.data (), loc_chunk*loc_stride*sizeof (double));       // Reading binary coordinates...
+      }
+      else
+      {
+        for(k = 0; k < loc_chunk*loc_stride; k++)
+        {
+          loc_coordinates[k] = msh_value<double> (loc_file);                                        // Reading ASCII coordinate...
+        }
+      }
+
+      // Storing chunk coordinates:
+      for(k = 0; k < loc_chunk; k++)
+      {
+        if((loc_tag[i + k] < loc_min_tag) || (loc_tag[i + k] > loc_max_tag))
+        {
+          msh_node_error = "MSH node tag out of range!";                                            // Setting error message...
+          return;
+        }
+
+        msh_node_tag.push_back (loc_tag[i + k]);                                                    // Adding node tag...
+        node_coordinates.push_back (
+        {
+          (float)loc_coordinates[k*loc_stride + 0],                                                 // Setting node "x" coordinate...
+          (float)loc_coordinates[k*loc_stride + 1],                                                 // Setting node "y" coordinate...
+          (float)loc_coordinates[k*loc_stride + 2],                                                 // Setting node "z" coordinate...
+          1.0f                                                                                      // Setting node "w" coordinate...
+        });
+      }
+    }
+  }
+
+  if(!loc_file.good () || (node_coordinates.size () != loc_nodes) || (loc_min_tag < 1))
+  {
+    msh_node_error = "unable to read MSH $Nodes section!";                                          // Setting error message...
+    return;
+  }
+
+  loc_file.close ();                                                                                // Closing MSH file...
+}
+
+void nu::mesh::msh_renumber ()
+{
+  std::vector<std::pair<size_t, GLint> >           loc_index;                                       // (node tag, node index) pairs, sorted by tag.
+  std::vector<std::pair<size_t, GLint> >::iterator loc_found;                                       // Found pair.
+  bool                                             loc_continuous;                                  // Continuous node tags flag.
+  size_t                                           i;                                               // Node index.
+  size_t                                           t;                                               // Element type index.
+  size_t                                           m;                                               // Element node index.
+
+  loc_continuous = true;                                                                            // Setting continuous node tags flag...
+
+  for(i = 0; i < msh_node_tag.size (); i++)
+  {
+    loc_continuous = loc_continuous && (msh_node_tag[i] == i + 1);                                  // Checking node tag...
+  }
+
+  if(loc_continuous)
+  {
+    return;                                                                                         // Node index = tag - 1: nothing to renumber...
+  }
+
+  // Building sorted (node tag, node index) table (memory proportional to the number of nodes):
+  loc_index.resize (msh_node_tag.size ());
+
+  for(i = 0; i < msh_node_tag.size (); i++)
+  {
+    loc_index[i] = std::make_pair (msh_node_tag[i], (GLint)i);                                      // Setting node tag and index...
+  }
+
+  std::sort (loc_index.begin (), loc_index.end ());
+
+  for(i = 1; i < loc_index.size (); i++)
+  {
+    if(loc_index[i].first == loc_index[i - 1].first)
+    {
+      neutrino::error ("MSH file has repeated node tags!");                                         // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  // Renumbering element nodes (stored as tag - 1):
+  for(t = 0; t < msh_element_node.size (); t++)
+  {
+    for(m = 0; m < msh_element_node[t].size (); m++)
+    {
+      loc_found = std::lower_bound (
+                                    loc_index.begin (),
+                                    loc_index.end (),
+                                    std::make_pair ((size_t)msh_element_node[t][m] + 1, (GLint)0)
+                                   );
+
+      if((loc_found == loc_index.end ()) || (loc_found->first != (size_t)msh_element_node[t][m] + 1))
+      {
+        neutrino::error ("MSH element node tag not found in $Nodes section!");                      // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      msh_element_node[t][m] = loc_found->second;                                                   // Setting compact node index...
+    }
+  }
+}
+
+void nu::mesh::msh_skip_nodes (
+                               std::istream& loc_stream                                             // MSH file stream.
+                              )
+{
+  size_t loc_blocks;                                                                                // Number of entity blocks.
+  int    loc_dimension;                                                                             // Entity dimension.
+  int    loc_parametric;                                                                            // Parametric coordinates flag.
+  size_t loc_block_nodes;                                                                           // Number of nodes in the block.
+  size_t loc_stride;                                                                                // Number of coordinates per node.
+  size_t b;                                                                                         // Block index.
+
+  // ASCII nodes are skipped line by line, up to the end of section:
+  if(!msh_binary)
+  {
+    return;
+  }
+
+  loc_blocks = msh_value<size_t> (loc_stream);                                                      // Reading number of entity blocks...
+  msh_value<size_t> (loc_stream);                                                                   // Skipping number of nodes...
+  msh_value<size_t> (loc_stream);                                                                   // Skipping minimum node tag...
+  msh_value<size_t> (loc_stream);                                                                   // Skipping maximum node tag...
+
+  // For each "b" entity block:
+  for(b = 0; b < loc_blocks; b++)
+  {
+    loc_dimension   = msh_value<int> (loc_stream);                                                  // Reading entity dimension...
+    msh_value<int> (loc_stream);                                                                    // Skipping entity tag...
+    loc_parametric  = msh_value<int> (loc_stream);                                                  // Reading parametric flag...
+    loc_block_nodes = msh_value<size_t> (loc_stream);                                               // Reading number of nodes in block...
+    loc_stride      = 3 + (loc_parametric ? loc_dimension : 0);                                     // Computing number of coordinates per node...
+
+    // Skipping block node tags and coordinates:
+    loc_stream.seekg (
+                      loc_block_nodes*(sizeof (size_t) + loc_stride*sizeof (double)),
+                      std::ios::cur
+                     );
+  }
+}
+
+void nu::mesh::msh_elements (
+                             std::istream& loc_stream                                               // MSH file stream.
+                            )
+{
+  size_t              loc_blocks;                                                                   // Number of entity blocks.
+  size_t              loc_block_elements;                                                           // Number of elements in the block.
+  size_t              loc_type_size;                                                                // Number of nodes in element type.
+  size_t              loc_chunk;                                                                    // Number of elements in the chunk.
+  std::vector<size_t> loc_data;                                                                     // Element data of the chunk (tag + node tags).
+  msh_block           loc_block;                                                                    // Element block.
+  size_t              b;                                                                            // Block index.
+  size_t              i;                                                                            // Chunk index.
+  size_t              k;                                                                            // Element index.
+  size_t              n;                                                                            // Element node index.
+
+  loc_blocks = msh_value<size_t> (loc_stream);                                                      // Reading number of entity blocks...
+  msh_value<size_t> (loc_stream);                                                                   // Skipping number of elements...
+  msh_value<size_t> (loc_stream);                                                                   // Skipping minimum element tag...
+  msh_value<size_t> (loc_stream);                                                                   // Skipping maximum element tag...
+
+  // For each "b" entity block:
+  for(b = 0; b < loc_blocks; b++)
+  {
+    loc_block.dimension = msh_value<int> (loc_stream);                                              // Reading entity dimension...
+    loc_block.tag       = msh_value<int> (loc_stream);                                              // Reading entity tag...
+    loc_block.type      = msh_value<int> (loc_stream);                                              // Reading element type...
+    loc_block_elements  = msh_value<size_t> (loc_stream);                                           // Reading number of elements in block...
+    loc_type_size       = msh_element_size (loc_block.type);                                        // Getting number of nodes in element type...
+
+    if(loc_type_size == 0)
+    {
+      neutrino::error ("unsupported MSH element type!");                                            // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    loc_block.offset = msh_element_node[loc_block.type].size ();                                    // Setting block offset...
+    loc_block.size   = loc_block_elements*loc_type_size;                                            // Setting block size...
+    msh_element_node[loc_block.type].reserve (loc_block.offset + loc_block.size);                   // Reserving element nodes...
+    loc_data.resize (NU_MSH_CHUNK*(1 + loc_type_size));                                             // Allocating chunk...
+
+    // For each "i" chunk of elements:
+    for(i = 0; i < loc_block_elements; i += NU_MSH_CHUNK)
+    {
+      loc_chunk = std::min ((size_t)NU_MSH_CHUNK, loc_block_elements - i);                          // Computing chunk size...
+
+      // Reading chunk element data:
+      if(msh_binary)
+      {
+        loc_stream.read ((char*)loc_data.data (), loc_chunk*(1 + loc_type_size)*sizeof (size_t));   // Reading binary element data...
+      }
+      else
+      {
+        for(k = 0; k < loc_chunk*(1 + loc_type_size); k++)
+        {
+          loc_data[k] = msh_value<size_t> (loc_stream);                                             // Reading ASCII element data...
+        }
+      }
+
+      // Storing element node indices (skipping element tags):
+      for(k = 0; k < loc_chunk; k++)
+      {
+        for(n = 0; n < loc_type_size; n++)
+        {
+          msh_element_node[loc_block.type].push_back ((GLint)(loc_data[k*(1 + loc_type_size) + 1 + n] - 1));
+        }
+      }
+    }
+
+    msh_block_list.push_back (loc_block);                                                           // Adding element block...
+  }
+
+  if(!loc_stream.good ())
+  {
+    neutrino::error ("unable to read MSH $Elements section!");                                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+void nu::mesh::msh_physical_nodes (
+                                   int                  loc_physical_group_tag,                     // Physical group tag.
+                                   int                  loc_physical_group_dimension,               // Physical group dimension.
+                                   std::vector<size_t>& loc_node_tag                                // Node tags.
+                                  )
+{
+  size_t b;                                                                                         // Block index.
+  size_t m;                                                                                         // Element node index.
+
+  std::map<std::pair<int, int>, std::vector<int> >::iterator loc_entity;                            // Entity iterator.
+
+  loc_node_tag.clear ();                                                                            // Clearing node tags...
+
+  // For each "b" element block:
+  for(b = 0; b < msh_block_list.size (); b++)
+  {
+    if(msh_block_list[b].dimension != loc_physical_group_dimension)
+    {
+      continue;                                                                                     // Skipping blocks of other dimensions...
+    }
+
+    loc_entity = msh_physical.find (std::make_pair (msh_block_list[b].dimension, msh_block_list[b].tag));
+
+    // Checking whether the block entity belongs to the physical group:
+    if((loc_entity != msh_physical.end ()) &&
+       (std::find (
+                   loc_entity->second.begin (),
+                   loc_entity->second.end (),
+                   loc_physical_group_tag
+                  ) != loc_entity->second.end ()))
+    {
+      // For each "m" node in the block:
+      for(m = msh_block_list[b].offset; m < msh_block_list[b].offset + msh_block_list[b].size; m++)
+      {
+        loc_node_tag.push_back ((size_t)msh_element_node[msh_block_list[b].type][m] + 1);           // Adding node tag...
+      }
+    }
+  }
+
+  // Eliminating repeated tags:
+  std::sort (loc_node_tag.begin (), loc_node_tag.end ());
+  loc_node_tag.erase (std::unique (loc_node_tag.begin (), loc_node_tag.end ()), loc_node_tag.end ());
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::mesh::~mesh()
+{
+  #ifndef NU_NO_GMSH
+  if(reader == GMSH)
+  {
+    gmsh::finalize ();                                                                              // Finalizing GMSH...
+  }
+  #endif
 }
@@ -19,6 +19,28 @@ cl_command_queue       neutrino::queue_id;
 std::vector<cl_kernel> neutrino::kernel_id;                                                         // OpenCL kernel ID array (static variable storage).
 GLFWwindow*            neutrino::glfw_window;                                                       // Window handle.
 bool                   neutrino::init_done = false;                                                 // init_done flag.
+bool                   neutrino::gl_event;                                                          // Use OpenCL events from OpenGL fences (static variable storage).
+GLsync                 neutrino::gl_fence;                                                          // OpenGL fence (static variable storage).
+cl_event               neutrino::cl_fence;                                                          // OpenCL event linked to the OpenGL fence (static variable storage).
+bool                   neutrino::gpu_timing = false;                                                // OpenGL timer queries allocated flag (static variable storage).
+GLuint                 neutrino::gpu_query[2][NU_GPU_QUERIES];                                      // OpenGL timer queries (static variable storage).
+nu::gpu_pass           neutrino::gpu_query_pass[2][NU_GPU_QUERIES];                                 // OpenGL timer query pass types (static variable storage).
+size_t                 neutrino::gpu_query_count[2];                                                // OpenGL timer queries issued in the frame (static variable storage).
+size_t                 neutrino::gpu_slot;                                                          // OpenGL timer queries current frame slot (static variable storage).
+bool                   neutrino::gpu_open;                                                          // OpenGL timer query open flag (static variable storage).
+double                 neutrino::gpu_time[NU_GPU_PASSES];                                           // OpenGL GPU time per pass type [s] (static variable storage).
+bool                   neutrino::render_dynamic = false;                                            // Dynamic resolution flag (static variable storage).
+float                  neutrino::render_scale   = 1.0f;                                             // Dynamic resolution render scale (static variable storage).
+nu::histogram          neutrino::loop_histogram ("loop time");                                      // Loop time histogram (static variable storage).
+nu::histogram          neutrino::kernel_histogram ("kernel time");                                  // Kernel time histogram (static variable storage).
+nu::histogram          neutrino::transfer_histogram ("transfer time");                              // Transfer time histogram (static variable storage).
+std::string            neutrino::statistics_file;                                                   // Time statistics file name (static variable storage).
+
+// Time statistics writer (at exit):
+static void nu_statistics_exit ()
+{
+  neutrino::write_statistics (neutrino::statistics_file);                                           // Writing time statistics...
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////// "neutrino" class /////////////////////////////////////////
@@ -53,6 +75,10 @@ void neutrino::init ()
   neutrino::context_id    = NULL;                                                                   // OpenCL context ID.
   neutrino::platform_id   = NULL;                                                                   // OpenCL platform ID.
   neutrino::device_id     = NULL;                                                                   // OpenCL device ID.
+  neutrino::queue_id      = NULL;                                                                   // OpenCL queue ID.
+  neutrino::gl_event      = false;                                                                  // Use OpenCL events from OpenGL fences.
+  neutrino::gl_fence      = NULL;                                                                   // OpenGL fence.
+  neutrino::cl_fence      = NULL;                                                                   // OpenCL event linked to the OpenGL fence.
   neutrino::init_done     = true;                                                                   // Setting init_done flag...
 
   done ();                                                                                          // Printing message...
@@ -65,12 +91,13 @@ void neutrino::get_tic ()
 
 void neutrino::get_toc ()
 {
-  std::string loc_text;                                                                             // Text buffer.
-  std::string loc_pad;                                                                              // Text pad.
+  char loc_text[NU_MAX_MESSAGE_SIZE*4];                                                             // Text buffer.
+  int  loc_size;                                                                                    // Text size.
 
   neutrino::toc            = glfwGetTime ();                                                        // Getting "toc"...
   neutrino::loop_time      = neutrino::toc - neutrino::tic;                                         // Loop execution time [s].
   neutrino::terminal_time += size_t (round (neutrino::loop_time*1000000.0f));                       // Terminal time [us].
+  neutrino::loop_histogram.record (neutrino::loop_time);                                            // Recording loop time...
 
   if(neutrino::terminal_time > NU_TERMINAL_REFRESH)                                                 // Checking terminal time...
   {
@@ -78,15 +105,71 @@ void neutrino::get_toc ()
     erase ();                                                                                       // Erasing terminal line...
 
     // Compiling message string:
-    loc_text                = std::string (NU_COLOR_CYAN) +
-                              std::string ("Action: ") +
-                              std::string (NU_COLOR_NORMAL) +
-                              std::string ("running host loop time = ") +
-                              std::to_string (long (round (1000000.0*neutrino::loop_time))) +
-                              std::string (" us");
+    loc_size = snprintf (
+                         loc_text,
+                         sizeof (loc_text),
+                         "%sAction: %srunning host loop time = %ld us (p50/p99/max = %ld/%ld/%ld us)",
+                         NU_COLOR_CYAN,
+                         NU_COLOR_NORMAL,
+                         long (round (1000000.0*neutrino::loop_time)),
+                         long (round (1000000.0*neutrino::loop_histogram.percentile (50.0))),
+                         long (round (1000000.0*neutrino::loop_histogram.percentile (99.0))),
+                         long (round (1000000.0*neutrino::loop_histogram.max ()))
+                        );
+
+    if(neutrino::gpu_timing && (loc_size > 0) && (loc_size < (int)sizeof (loc_text)))
+    {
+      // Compiling GPU times string:
+      snprintf (
+                loc_text + loc_size,
+                sizeof (loc_text) - loc_size,
+                ", GPU clear/plot/GUI = %ld/%ld/%ld us",
+                long (round (1000000.0*neutrino::gpu_time[nu::GPU_CLEAR])),
+                long (round (1000000.0*neutrino::gpu_time[nu::GPU_PLOT])),
+                long (round (1000000.0*neutrino::gpu_time[nu::GPU_GUI]))
+               );
+    }
 
-    std::cout << loc_text + loc_pad << std::flush;                                                  // Printing buffer...
+    std::cout << loc_text << std::flush;                                                            // Printing buffer...
+  }
+}
+
+void neutrino::set_statistics (
+                               std::string loc_file_name                                            // Time statistics file name.
+                              )
+{
+  if(neutrino::statistics_file.empty ())
+  {
+    std::atexit (nu_statistics_exit);                                                               // Registering time statistics writer...
+  }
+
+  neutrino::statistics_file = loc_file_name;                                                        // Setting time statistics file name...
+}
+
+void neutrino::write_statistics (
+                                 std::string loc_file_name                                          // Time statistics file name.
+                                )
+{
+  std::ofstream loc_file;                                                                           // Time statistics file.
+
+  if(loc_file_name.empty ())
+  {
+    return;                                                                                         // No file...
   }
+
+  loc_file.open (loc_file_name, std::ios::out | std::ios::trunc);                                   // Opening time statistics file...
+
+  if(!loc_file.is_open ())
+  {
+    // Printing message (static: no "error" member, possibly at exit):
+    std::cout << NU_COLOR_RED << "Error:  " << NU_COLOR_NORMAL <<
+              "unable to open time statistics file " + loc_file_name + "!" << std::endl;
+    return;
+  }
+
+  neutrino::loop_histogram.dump (loc_file);                                                         // Writing loop time histogram...
+  neutrino::kernel_histogram.dump (loc_file);                                                       // Writing kernel time histogram...
+  neutrino::transfer_histogram.dump (loc_file);                                                     // Writing transfer time histogram...
 }
 
 std::string neutrino::get_timestamp ()
@@ -491,6 +574,173 @@ float neutrino::constrain_float
   return loc_output;                                                                                // Returning output...
 }
 
+void neutrino::fence_gl ()
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  // Deleting previous fence:
+  if(cl_fence != NULL)
+  {
+    clReleaseEvent (cl_fence);                                                                      // Releasing OpenCL event...
+    cl_fence = NULL;                                                                                // Resetting OpenCL event...
+  }
+
+  if(gl_fence != NULL)
+  {
+    glDeleteSync (gl_fence);                                                                        // Deleting OpenGL fence...
+  }
+
+  gl_fence = glFenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);                                        // Inserting OpenGL fence...
+  glFlush ();                                                                                       // Flushing OpenGL commands...
+
+  #ifndef __APPLE__                                                                                 // Checking for cl_khr_gl_event availability...
+  if(gl_event)
+  {
+    cl_fence = clCreateEventFromGLsyncKHR (context_id, (cl_GLsync)gl_fence, &loc_error);            // Linking OpenCL event to OpenGL fence...
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+  #endif
+}
+
+cl_uint neutrino::wait_gl (
+                           cl_event* loc_event                                                      // OpenCL event linked to the OpenGL fence.
+                          )
+{
+  GLenum loc_status;                                                                                // Fence status.
+
+  if(cl_fence != NULL)
+  {
+    *loc_event = cl_fence;                                                                          // Setting OpenCL event...
+    return 1;                                                                                       // Waiting on client GPU...
+  }
+
+  if(gl_fence != NULL)
+  {
+    // Waiting for OpenGL fence on host PC:
+    do
+    {
+      loc_status = glClientWaitSync (gl_fence, GL_SYNC_FLUSH_COMMANDS_BIT, NU_SYNC_TIMEOUT);
+    }
+    while(loc_status == GL_TIMEOUT_EXPIRED);
+
+    glDeleteSync (gl_fence);                                                                        // Deleting OpenGL fence...
+    gl_fence = NULL;                                                                                // Resetting OpenGL fence...
+  }
+
+  return 0;                                                                                         // Empty wait list...
+}
+
+void neutrino::gpu_begin (
+                          nu::gpu_pass loc_pass                                                     // Pass type.
+                         )
+{
+  size_t i;                                                                                         // Pass type index.
+
+  if(!gpu_timing)
+  {
+    glGenQueries (2*NU_GPU_QUERIES, &gpu_query[0][0]);                                              // Generating OpenGL timer queries...
+
+    for(i = 0; i < NU_GPU_PASSES; i++)
+    {
+      gpu_time[i] = 0.0;                                                                            // Resetting GPU time...
+    }
+
+    gpu_query_count[0] = 0;                                                                         // Resetting query count...
+    gpu_query_count[1] = 0;                                                                         // Resetting query count...
+    gpu_slot           = 0;                                                                         // Resetting frame slot...
+    gpu_open           = false;                                                                     // Resetting open flag...
+    gpu_timing         = true;                                                                      // Setting timer queries allocated flag...
+  }
+
+  if(gpu_open || (gpu_query_count[gpu_slot] == NU_GPU_QUERIES))
+  {
+    return;                                                                                         // Nested pass or query buffer full: not timed...
+  }
+
+  gpu_query_pass[gpu_slot][gpu_query_count[gpu_slot]] = loc_pass;                                   // Setting query pass type...
+  glBeginQuery (GL_TIME_ELAPSED, gpu_query[gpu_slot][gpu_query_count[gpu_slot]]);                   // Beginning OpenGL timer query...
+  gpu_open                                            = true;                                       // Setting open flag...
+}
+
+void neutrino::gpu_end ()
+{
+  if(!gpu_open)
+  {
+    return;                                                                                         // No open query...
+  }
+
+  glEndQuery (GL_TIME_ELAPSED);                                                                     // Ending OpenGL timer query...
+  gpu_query_count[gpu_slot]++;                                                                      // Incrementing query count...
+  gpu_open = false;                                                                                 // Resetting open flag...
+}
+
+bool neutrino::gpu_frame ()
+{
+  GLint    loc_available;                                                                           // Query result availability.
+  GLuint64 loc_elapsed;                                                                             // Query result [ns].
+  double   loc_time[NU_GPU_PASSES];                                                                 // GPU time per pass type [s].
+  size_t   i;                                                                                       // Query index.
+
+  if(!gpu_timing || gpu_open)
+  {
+    return false;                                                                                   // Nothing to read back...
+  }
+
+  gpu_slot = 1 - gpu_slot;                                                                          // Swapping frame slot (queries of previous frame)...
+
+  for(i = 0; i < NU_GPU_PASSES; i++)
+  {
+    loc_time[i] = 0.0;                                                                              // Resetting GPU time...
+  }
+
+  loc_available = GL_TRUE;                                                                          // Setting availability...
+
+  // Reading back the queries of the previous frame, without stalling:
+  for(i = 0; (i < gpu_query_count[gpu_slot]) && loc_available; i++)
+  {
+    glGetQueryObjectiv (gpu_query[gpu_slot][i], GL_QUERY_RESULT_AVAILABLE, &loc_available);         // Checking query availability...
+
+    if(loc_available)
+    {
+      glGetQueryObjectui64v (gpu_query[gpu_slot][i], GL_QUERY_RESULT, &loc_elapsed);                // Getting query result...
+      loc_time[gpu_query_pass[gpu_slot][i]] += 1.0E-9*(double)loc_elapsed;                          // Summing GPU time [s]...
+    }
+  }
+
+  loc_available = loc_available && (gpu_query_count[gpu_slot] > 0);                                 // Checking whether GPU times are new...
+
+  if(loc_available)
+  {
+    for(i = 0; i < NU_GPU_PASSES; i++)
+    {
+      gpu_time[i] = loc_time[i];                                                                    // Setting GPU time...
+    }
+  }
+
+  gpu_query_count[gpu_slot] = 0;                                                                    // Resetting query count (slot reused)...
+
+  return loc_available;                                                                             // Returning update flag...
+}
+
+double neutrino::get_gpu_time (
+                               nu::gpu_pass loc_pass                                                // Pass type.
+                              )
+{
+  return gpu_time[loc_pass];                                                                        // Returning GPU time [s]...
+}
+
+void neutrino::fence_cl ()
+{
+  if(gl_event)
+  {
+    clFlush (queue_id);                                                                             // Flushing OpenCL queue (implicit sync)...
+  }
+  else
+  {
+    clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
+  }
+}
+
 std::string neutrino::get_error
 (
  cl_int loc_error                                                                                   // Local error code.
@@ -401,7 +401,7 @@ void nu::opencl::init
 
     /*
        std::cout << "        --> max work time sizes: ";
-       std::cout << opencl_device[i]->max_work_item_sizes << std::endl;                // Printing message...
+       std::cout << opencl_device[i]->max_work_item_sizes << std::endl;                             // Printing message...
      */
 
     std::cout << "        --> mem base addr align: ";
@@ -469,6 +469,16 @@ void nu::opencl::init
     neutrino::interop = false;                                                                      // Resetting interoperability flag...
   }
 
+  // Checking for OpenCL event from OpenGL fence support:
+  if(neutrino::interop && neutrino::property (opencl_device[selected_device]->extensions, NU_GL_EVENT))
+  {
+    neutrino::gl_event = true;                                                                      // Setting OpenCL event from OpenGL fence flag...
+  }
+  else
+  {
+    neutrino::gl_event = false;                                                                     // Resetting OpenCL event from OpenGL fence flag...
+  }
+
   // EZOR 02NOV2019: non-interop test.
   // It looks it works also when interop = false.
   // neutrino::interop   = false;
@@ -615,8 +625,12 @@ void nu::opencl::init
 
 void nu::opencl::read ()
 {
+  double loc_start;                                                                                 // Transfer start time [s].
   GLuint i;                                                                                         // Index.
 
+  nu::zone loc_zone ("read");                                                                       // Profiling zone...
+  loc_start = nu::histogram::clock ();                                                              // Getting transfer start time [s]...
+
   // Setting kernel arguments:
   for(i = 0; i < neutrino::container.size (); i++)
   {
@@ -668,12 +682,19 @@ void nu::opencl::read ()
         break;
     }
   }
+
+  neutrino::transfer_histogram.record (nu::histogram::clock () - loc_start);                        // Recording transfer time...
 }
 
 void nu::opencl::read (
                        GLuint loc_i
                       )
 {
+  double loc_start;                                                                                 // Transfer start time [s].
+
+  nu::zone loc_zone ("read");                                                                       // Profiling zone...
+  loc_start = nu::histogram::clock ();                                                              // Getting transfer start time [s]...
+
   // Setting kernel argument:
   switch(container[loc_i]->type)
   {
@@ -731,12 +752,18 @@ void nu::opencl::read (
       opencl_queue->read ((nu::float16*)neutrino::container[loc_i], loc_i);
       break;
   }
+
+  neutrino::transfer_histogram.record (nu::histogram::clock () - loc_start);                        // Recording transfer time...
 }
 
 void nu::opencl::write ()
 {
+  double loc_start;                                                                                 // Transfer start time [s].
   GLuint i;                                                                                         // Index.
 
+  nu::zone loc_zone ("write");                                                                      // Profiling zone...
+  loc_start = nu::histogram::clock ();                                                              // Getting transfer start time [s]...
+
   // Setting kernel arguments:
   for(i = 0; i < neutrino::container.size (); i++)
   {
@@ -788,12 +815,19 @@ void nu::opencl::write ()
         break;
     }
   }
+
+  neutrino::transfer_histogram.record (nu::histogram::clock () - loc_start);                        // Recording transfer time...
 }
 
 void nu::opencl::write (
                         GLuint loc_i
                        )
 {
+  double loc_start;                                                                                 // Transfer start time [s].
+
+  nu::zone loc_zone ("write");                                                                      // Profiling zone...
+  loc_start = nu::histogram::clock ();                                                              // Getting transfer start time [s]...
+
   // Setting kernel argument:
   switch(container[loc_i]->type)
   {
@@ -851,12 +885,16 @@ void nu::opencl::write (
       opencl_queue->write ((nu::float16*)neutrino::container[loc_i], loc_i);
       break;
   }
+
+  neutrino::transfer_histogram.record (nu::histogram::clock () - loc_start);                        // Recording transfer time...
 }
 
 void nu::opencl::acquire ()
 {
   GLuint i;                                                                                         // Index.
 
+  nu::zone loc_zone ("acquire");                                                                    // Profiling zone...
+
   for(i = 0; i < container.size (); i++)
   {
     switch(container[i]->type)
@@ -904,6 +942,8 @@ void nu::opencl::release ()
 {
   GLuint i;                                                                                         // Index.
 
+  nu::zone loc_zone ("release");                                                                    // Profiling zone...
+
   for(i = 0; i < container.size (); i++)
   {
     switch(container[i]->type)
@@ -953,13 +993,14 @@ void nu::opencl::execute
  nu::kernel_mode loc_kernel_mode                                                                    // Kernel mode.
 )
 {
+  double  loc_start;                                                                                // Kernel start time [s].
   cl_int  loc_error;                                                                                // Error code.
   cl_uint kernel_dimension;                                                                         // Kernel dimension.
   size_t* kernel_size;                                                                              // Kernel size array.
   bool    kernel_valid = false;                                                                     // Validity flag.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (opencl_queue->queue_id);                                                                // Waiting for OpenCL to finish...
+  nu::zone loc_zone ("execute");                                                                    // Profiling zone...
+  loc_start = nu::histogram::clock ();                                                              // Getting kernel start time [s]...
 
   // Selecting kernel size:
   if(
@@ -1007,6 +1048,12 @@ void nu::opencl::execute
     exit (EXIT_FAILURE);
   }
 
+  // Enabling queue profiling (profiler started after the queue creation):
+  if(nu::profiler::enabled && !opencl_queue->profiling)
+  {
+    opencl_queue->profile ();                                                                       // Recreating queue with profiling...
+  }
+
   // Enqueueing OpenCL kernel (as a single task):
   loc_error = clEnqueueNDRangeKernel
               (
@@ -1022,8 +1069,9 @@ void nu::opencl::execute
               );
 
   neutrino::check_error (loc_error);                                                                // Checking error...
+  nu::profiler::cl ("kernel", loc_kernel->event);                                                   // Attaching kernel to OpenCL timeline...
 
-  clFinish (opencl_queue->queue_id);                                                                // Waiting for OpenCL to finish...
+  clFlush (opencl_queue->queue_id);                                                                 // Submitting kernel to the client GPU...
 
   // Selecting kernel mode:
   switch(loc_kernel_mode)
@@ -1042,6 +1090,11 @@ void nu::opencl::execute
       neutrino::check_error (loc_error);                                                            // Checking error...
       break;
   }
+
+  if(loc_kernel_mode != DONT_WAIT)
+  {
+    neutrino::kernel_histogram.record (nu::histogram::clock () - loc_start);                        // Recording kernel time (enqueue to completion)...
+  }
 }
 
 nu::opencl::~opencl ()
@@ -7,6 +7,66 @@
 
 bool nu::opengl::init_done = false;                                                                 // init_done flag.
 
+// GLSL source of the culling compute program (frustum culling, LOD decimation, compaction):
+static const std::string nu_cull_source =
+  "#version 430 core\n"
+  "\n"
+  "layout (local_size_x = " + std::to_string (NU_CULL_GROUP_SIZE) + ") in;\n"
+  "\n"
+  "layout (std430, binding = " + std::to_string (NU_CULL_BINDING) + ") readonly buffer nu_cull_position\n"
+  "{\n"
+  "  vec4 position[];\n"
+  "};\n"
+  "\n"
+  "layout (std430, binding = " + std::to_string (NU_CULL_BINDING + 1) + ") writeonly buffer nu_cull_index\n"
+  "{\n"
+  "  uint index[];\n"
+  "};\n"
+  "\n"
+  "layout (std430, binding = " + std::to_string (NU_CULL_BINDING + 2) + ") buffer nu_cull_command\n"
+  "{\n"
+  "  uint count;\n"
+  "  uint instances;\n"
+  "  uint first;\n"
+  "  uint base_vertex;\n"
+  "  uint base_instance;\n"
+  "};\n"
+  "\n"
+  "uniform mat4  V_mat;\n"
+  "uniform mat4  P_mat;\n"
+  "uniform uint  size;\n"
+  "uniform float lod;\n"
+  "\n"
+  "void main ()\n"
+  "{\n"
+  "  uint  i = gl_GlobalInvocationID.x;\n"
+  "  vec4  v;\n"
+  "  vec4  c;\n"
+  "  uint  h;\n"
+  "  float d;\n"
+  "\n"
+  "  if(i >= size) return;\n"
+  "\n"
+  "  v = V_mat*vec4 (position[i].xyz, 1.0);\n"
+  "  c = P_mat*v;\n"
+  "\n"
+  "  if(c.w <= 0.0) return;\n"
+  "  if(any (greaterThan (abs (c.xyz), vec3 (" + std::to_string (NU_CULL_MARGIN) + "*c.w)))) return;\n"
+  "\n"
+  "  if(lod > 0.0)\n"
+  "  {\n"
+  "    h  = i*2654435761u;\n"
+  "    h ^= h >> 16;\n"
+  "    h *= 2246822519u;\n"
+  "    h ^= h >> 13;\n"
+  "    d  = length (v.xyz);\n"
+  "\n"
+  "    if(float (h)*(1.0/4294967296.0)*d*d >= lod*lod) return;\n"
+  "  }\n"
+  "\n"
+  "  index[atomicAdd (count, 1u)] = i;\n"
+  "}\n";
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////// "nu::opengl" class /////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,12 +101,45 @@ nu::opengl::opengl (
   }
 }
 
+nu::opengl::opengl (
+                    std::string       loc_title,                                                    // Window title.
+                    int               loc_window_size_x,                                            // Window x-size [px].
+                    int               loc_window_size_y,                                            // Window y-size [px].
+                    float             loc_orbit_x_initial,                                          // Initial "near clipping-plane" x-coordinate.
+                    float             loc_orbit_y_initial,                                          // Initial "near clipping-plane" y-coordinate.
+                    float             loc_pan_x_initial,                                            // Initial pan-x coordinate.
+                    float             loc_pan_y_initial,                                            // Initial pan-y coordinate.
+                    float             loc_pan_z_initial,                                            // Initial pan-z coordinate.
+                    nu::render_target loc_target                                                    // Render target.
+                   )
+{
+  if(neutrino::init_done != true)
+  {
+    neutrino::init ();                                                                              // Initializing Neutrino...
+  }
+
+  if(nu::opengl::init_done != true)
+  {
+    nu::opengl::init (
+                      loc_title,                                                                    // Window title.
+                      loc_window_size_x,                                                            // Window x-size [px].
+                      loc_window_size_y,                                                            // Window y-size [px].
+                      loc_orbit_x_initial,                                                          // Initial "near clipping-plane" x-coordinate.
+                      loc_orbit_y_initial,                                                          // Initial "near clipping-plane" y-coordinate.
+                      loc_pan_x_initial,                                                            // Initial pan-x coordinate.
+                      loc_pan_y_initial,                                                            // Initial pan-y coordinate.
+                      loc_pan_z_initial,                                                            // Initial pan-z coordinate.
+                      loc_target                                                                    // Render target.
+                     );
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////// PRIVATE METHODS ///////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-void nu::opengl::set_shader
+void nu::opengl::set_camera
 (
- nu::shader* loc_shader,                                                                            // Shader.
+ GLuint      loc_eye,                                                                               // Eye index.
  float       view_matrix[16],                                                                       // View matrix.
  float       projection_matrix[16],                                                                 // Projection matrix.
  float       framebuffer_size_x,                                                                    // Framebuffer x-size [px_float].
@@ -54,69 +147,239 @@ void nu::opengl::set_shader
  float       framebuffer_AR                                                                         // Framebuffer aspect ratio.
 )
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  nu_camera_structure loc_camera;                                                                   // Camera uniform block.
 
-  glUseProgram (loc_shader->program);                                                               // Using shader...
+  std::copy (view_matrix, view_matrix + 16, loc_camera.V_mat);                                      // Setting view matrix...
+  std::copy (projection_matrix, projection_matrix + 16, loc_camera.P_mat);                          // Setting projection matrix...
+  loc_camera.size_x  = framebuffer_size_x;                                                          // Setting framebuffer x-size...
+  loc_camera.size_y  = framebuffer_size_y;                                                          // Setting framebuffer y-size...
+  loc_camera.AR      = framebuffer_AR;                                                              // Setting framebuffer aspect ratio...
+  loc_camera.padding = 0.0f;                                                                        // Setting padding...
 
-  // Setting View_matrix matrix on shader:
-  glUniformMatrix4fv
-  (
-   // Getting variable's uniform location:
-   glGetUniformLocation
-   (
-    loc_shader->program,                                                                            // Program.
-    "V_mat"                                                                                         // Variable.
-   ),
-   1,                                                                                               // Number of matrices to be modified.
-   GL_FALSE,                                                                                        // FALSE = column major.
-   &view_matrix[0]                                                                                  // View matrix.
-  );
+  // Uploading camera uniform buffer (only if changed):
+  if(memcmp (&loc_camera, &camera[loc_eye], sizeof (nu_camera_structure)) != 0)
+  {
+    camera[loc_eye] = loc_camera;                                                                   // Storing camera uniform block...
+    glBindBuffer (GL_UNIFORM_BUFFER, camera_ubo[loc_eye]);                                          // Binding camera uniform buffer...
+    glBufferSubData (GL_UNIFORM_BUFFER, 0, sizeof (nu_camera_structure), &camera[loc_eye]);         // Uploading camera uniform buffer...
+    glBindBuffer (GL_UNIFORM_BUFFER, 0);                                                            // Unbinding camera uniform buffer...
+  }
 
-  // Setting Projection_matrix matrix on shader:
-  glUniformMatrix4fv
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "P_mat"                                                                                         // Variable.
-   ),
-   1,                                                                                               // Number of matrices to be modified.
-   GL_FALSE,                                                                                        // FALSE = column major.
-   &projection_matrix[0]                                                                            // Projection matrix.
-  );
+  glBindBufferBase (GL_UNIFORM_BUFFER, NU_CAMERA_BINDING, camera_ubo[loc_eye]);                     // Binding camera uniform buffer to binding point...
+}
 
-  // Setting framebuffer size_x on shader:
-  glUniform1f
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "size_x"                                                                                        // Variable.
-   ),
-   framebuffer_size_x                                                                               // Window x-size [px_float].
-  );
+void nu::opengl::set_stereo
+(
+ float       left_view_matrix[16],                                                                  // Left eye view matrix.
+ float       left_projection_matrix[16],                                                            // Left eye projection matrix.
+ float       right_view_matrix[16],                                                                 // Right eye view matrix.
+ float       right_projection_matrix[16],                                                           // Right eye projection matrix.
+ float       framebuffer_size_x,                                                                    // Framebuffer x-size (one eye) [px_float].
+ float       framebuffer_size_y,                                                                    // Framebuffer y-size [px_float].
+ float       framebuffer_AR                                                                         // Framebuffer aspect ratio (one eye).
+)
+{
+  nu_stereo_structure loc_stereo;                                                                   // Stereo uniform block.
+
+  std::copy (left_view_matrix, left_view_matrix + 16, loc_stereo.V_mat[0]);                         // Setting left eye view matrix...
+  std::copy (left_projection_matrix, left_projection_matrix + 16, loc_stereo.P_mat[0]);             // Setting left eye projection matrix...
+  std::copy (right_view_matrix, right_view_matrix + 16, loc_stereo.V_mat[1]);                       // Setting right eye view matrix...
+  std::copy (right_projection_matrix, right_projection_matrix + 16, loc_stereo.P_mat[1]);           // Setting right eye projection matrix...
+  loc_stereo.size_x  = framebuffer_size_x;                                                          // Setting framebuffer x-size...
+  loc_stereo.size_y  = framebuffer_size_y;                                                          // Setting framebuffer y-size...
+  loc_stereo.AR      = framebuffer_AR;                                                              // Setting framebuffer aspect ratio...
+  loc_stereo.padding = 0.0f;                                                                        // Setting padding...
+
+  // Uploading stereo uniform buffer (only if changed):
+  if(memcmp (&loc_stereo, &stereo, sizeof (nu_stereo_structure)) != 0)
+  {
+    stereo = loc_stereo;                                                                            // Storing stereo uniform block...
+    glBindBuffer (GL_UNIFORM_BUFFER, stereo_ubo);                                                   // Binding stereo uniform buffer...
+    glBufferSubData (GL_UNIFORM_BUFFER, 0, sizeof (nu_stereo_structure), &stereo);                  // Uploading stereo uniform buffer...
+    glBindBuffer (GL_UNIFORM_BUFFER, 0);                                                            // Unbinding stereo uniform buffer...
+  }
 
-  // Setting framebuffer size_y on shader:
-  glUniform1f
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "size_y"                                                                                        // Variable.
-   ),
-   framebuffer_size_y                                                                               // Window y-size [px_float].
-  );
+  glBindBufferBase (GL_UNIFORM_BUFFER, NU_STEREO_BINDING, stereo_ubo);                              // Binding stereo uniform buffer to binding point...
+}
 
-  // Setting framebuffer aspect ratio on shader:
-  glUniform1f
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "AR"                                                                                            // Variable.
-   ),
-   framebuffer_AR                                                                                   // Framebuffer aspect ratio [].
-  );
+void nu::opengl::cull_init ()
+{
+  GLuint      loc_shader;                                                                           // Compute shader.
+  const char* loc_source;                                                                           // Compute shader source.
+  GLint       loc_success;                                                                          // "GL_COMPILE_STATUS"/"GL_LINK_STATUS" flag.
+  GLchar*     loc_log;                                                                              // Buffer for OpenGL error log.
+  GLsizei     loc_log_size;                                                                         // Size of OpenGL error log.
+
+  neutrino::action ("building OpenGL culling program...");                                          // Printing message...
+
+  loc_source   = nu_cull_source.c_str ();                                                           // Getting compute shader source...
+  loc_shader   = glCreateShader (GL_COMPUTE_SHADER);                                                // Creating compute shader...
+  glShaderSource (loc_shader, 1, &loc_source, NULL);                                                // Attaching source code to shader...
+  glCompileShader (loc_shader);                                                                     // Compiling shader...
+  glGetShaderiv (loc_shader, GL_COMPILE_STATUS, &loc_success);                                      // Reading "GL_COMPILE_STATUS" flag...
+
+  // Checking compiled shader code:
+  if(!loc_success)
+  {
+    glGetShaderiv (loc_shader, GL_INFO_LOG_LENGTH, &loc_log_size);                                  // Getting log length...
+    loc_log = (char*) calloc (loc_log_size + 1, sizeof(GLchar));                                    // Allocating temporary buffer for log...
+    glGetShaderInfoLog (loc_shader, loc_log_size + 1, NULL, loc_log);                               // Getting log...
+    std::cout << loc_log << std::endl;                                                              // Printing log...
+    free (loc_log);                                                                                 // Freeing log...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  cull_program = glCreateProgram ();                                                                // Creating program...
+  glAttachShader (cull_program, loc_shader);                                                        // Attaching shader to program...
+  glLinkProgram (cull_program);                                                                     // Linking program...
+  glGetProgramiv (cull_program, GL_LINK_STATUS, &loc_success);                                      // Reading "GL_LINK_STATUS" flag...
+  glDeleteShader (loc_shader);                                                                      // Deleting shader (owned by program)...
+
+  // Checking linked program:
+  if(!loc_success)
+  {
+    glGetProgramiv (cull_program, GL_INFO_LOG_LENGTH, &loc_log_size);                               // Getting log length...
+    loc_log = (char*) calloc (loc_log_size + 1, sizeof(GLchar));                                    // Allocating temporary buffer for log...
+    glGetProgramInfoLog (cull_program, loc_log_size + 1, NULL, loc_log);                            // Getting log...
+    std::cout << loc_log << std::endl;                                                              // Printing log...
+    free (loc_log);                                                                                 // Freeing log...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  cull_V_location    = glGetUniformLocation (cull_program, "V_mat");                                // Getting view matrix uniform location...
+  cull_P_location    = glGetUniformLocation (cull_program, "P_mat");                                // Getting projection matrix uniform location...
+  cull_size_location = glGetUniformLocation (cull_program, "size");                                 // Getting number of nodes uniform location...
+  cull_lod_location  = glGetUniformLocation (cull_program, "lod");                                  // Getting LOD distance uniform location...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::opengl::cull
+(
+ nu::shader* loc_shader,                                                                            // Shader.
+ float       view_matrix[16],                                                                       // View matrix.
+ float       projection_matrix[16],                                                                 // Projection matrix.
+ GLuint      loc_instances                                                                          // Number of instances.
+)
+{
+  GLuint loc_command[5] = {0, loc_instances, 0, 0, 0};                                              // Indirect draw command (count reset).
+
+  if(cull_program == 0)
+  {
+    cull_init ();                                                                                   // Building culling program...
+  }
+
+  // Resetting indirect draw command:
+  glBindBuffer (GL_DRAW_INDIRECT_BUFFER, loc_shader->cull_command);                                 // Binding culling command buffer...
+  glBufferSubData (GL_DRAW_INDIRECT_BUFFER, 0, sizeof(loc_command), loc_command);                   // Resetting culling command...
+
+  // Running culling pass:
+  glUseProgram (cull_program);                                                                      // Using culling program...
+  glUniformMatrix4fv (cull_V_location, 1, GL_FALSE, &view_matrix[0]);                               // Setting view matrix (FALSE = column major)...
+  glUniformMatrix4fv (cull_P_location, 1, GL_FALSE, &projection_matrix[0]);                         // Setting projection matrix (FALSE = column major)...
+  glUniform1ui (cull_size_location, (GLuint)loc_shader->size);                                      // Setting number of nodes...
+  glUniform1f (cull_lod_location, loc_shader->cull_lod);                                            // Setting LOD distance...
+  glBindBufferBase (GL_SHADER_STORAGE_BUFFER, NU_CULL_BINDING, loc_shader->cull_data->ssbo);        // Binding node positions...
+  glBindBufferBase (GL_SHADER_STORAGE_BUFFER, NU_CULL_BINDING + 1, loc_shader->cull_ebo);           // Binding compacted index buffer...
+  glBindBufferBase (GL_SHADER_STORAGE_BUFFER, NU_CULL_BINDING + 2, loc_shader->cull_command);       // Binding indirect draw command...
+  glDispatchCompute (
+                     ((GLuint)loc_shader->size + NU_CULL_GROUP_SIZE - 1)/NU_CULL_GROUP_SIZE,
+                     1,
+                     1
+                    );                                                                              // Culling nodes...
+  glMemoryBarrier (GL_COMMAND_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT);                          // Waiting for index and command writes...
+}
+
+void nu::opengl::draw
+(
+ nu::shader*        loc_shader,                                                                     // Shader.
+ nu::primitive_mode loc_primitive,                                                                  // Primitive mode.
+ GLsizei            loc_instances                                                                   // Number of instances.
+)
+{
+  switch(loc_primitive)
+  {
+    case POINTS:
+      if(loc_shader->cull_data != NULL)
+      {
+        glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, loc_shader->cull_ebo);                               // Binding culling index buffer...
+        glBindBuffer (GL_DRAW_INDIRECT_BUFFER, loc_shader->cull_command);                           // Binding culling command buffer...
+        glDrawElementsIndirect (
+                                GL_POINTS,
+                                GL_UNSIGNED_INT,
+                                0
+                               );                                                                   // Drawing culled "points"...
+        break;
+      }
+
+      glDrawArraysInstanced (
+                             GL_POINTS,
+                             0,
+                             loc_shader->size,
+                             loc_instances
+                            );                                                                      // Drawing "points"...
+      break;
+
+    case LINES:
+      if(loc_shader->line_ebo == 0)
+      {
+        neutrino::error ("shader element buffers not set!");                                        // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, loc_shader->line_ebo);                                 // Binding line element buffer...
+      glDrawElementsInstanced (
+                               GL_LINES,
+                               loc_shader->line_size,
+                               GL_UNSIGNED_INT,
+                               0,
+                               loc_instances
+                              );                                                                    // Drawing "lines"...
+      break;
+
+    case TRIANGLES:
+      if(loc_shader->triangle_ebo == 0)
+      {
+        neutrino::error ("shader element buffers not set!");                                        // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, loc_shader->triangle_ebo);                             // Binding triangle element buffer...
+      glDrawElementsInstanced (
+                               GL_TRIANGLES,
+                               loc_shader->triangle_size,
+                               GL_UNSIGNED_INT,
+                               0,
+                               loc_instances
+                              );                                                                    // Drawing "triangles"...
+      break;
+  }
+}
+
+void nu::opengl::set_shader
+(
+ nu::shader* loc_shader,                                                                            // Shader.
+ float       view_matrix[16],                                                                       // View matrix.
+ float       projection_matrix[16],                                                                 // Projection matrix.
+ float       framebuffer_size_x,                                                                    // Framebuffer x-size [px_float].
+ float       framebuffer_size_y,                                                                    // Framebuffer y-size [px_float].
+ float       framebuffer_AR                                                                         // Framebuffer aspect ratio.
+)
+{
+  glUseProgram (loc_shader->program);                                                               // Using shader...
+
+  // Camera uniforms already set by the camera uniform buffer:
+  if(loc_shader->camera_block != GL_INVALID_INDEX)
+  {
+    return;
+  }
+
+  // Setting camera uniforms at their cached locations:
+  glUniformMatrix4fv (loc_shader->V_mat_location, 1, GL_FALSE, &view_matrix[0]);                    // Setting view matrix (FALSE = column major)...
+  glUniformMatrix4fv (loc_shader->P_mat_location, 1, GL_FALSE, &projection_matrix[0]);              // Setting projection matrix (FALSE = column major)...
+  glUniform1f (loc_shader->size_x_location, framebuffer_size_x);                                    // Setting framebuffer x-size [px_float]...
+  glUniform1f (loc_shader->size_y_location, framebuffer_size_y);                                    // Setting framebuffer y-size [px_float]...
+  glUniform1f (loc_shader->AR_location, framebuffer_AR);                                            // Setting framebuffer aspect ratio []...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3393,11 +3656,42 @@ void nu::opengl::init
  float       loc_pan_y_initial,                                                                     // Initial pan-y coordinate.
  float       loc_pan_z_initial                                                                      // Initial pan-z coordinate.
 )
+{
+  init (
+        loc_title,                                                                                  // Window title.
+        loc_window_size_x,                                                                          // Window x-size [px].
+        loc_window_size_y,                                                                          // Window y-size [px].
+        loc_orbit_x_initial,                                                                        // Initial "near clipping-plane" x-coordinate.
+        loc_orbit_y_initial,                                                                        // Initial "near clipping-plane" y-coordinate.
+        loc_pan_x_initial,                                                                          // Initial pan-x coordinate.
+        loc_pan_y_initial,                                                                          // Initial pan-y coordinate.
+        loc_pan_z_initial,                                                                          // Initial pan-z coordinate.
+        WINDOW                                                                                      // Render target.
+       );
+}
+
+void nu::opengl::init
+(
+ std::string       loc_title,                                                                       // Window title.
+ int               loc_window_size_x,                                                               // Window x-size [px].
+ int               loc_window_size_y,                                                               // Window y-size [px].
+ float             loc_orbit_x_initial,                                                             // Initial "near clipping-plane" x-coordinate.
+ float             loc_orbit_y_initial,                                                             // Initial "near clipping-plane" y-coordinate.
+ float             loc_pan_x_initial,                                                               // Initial pan-x coordinate.
+ float             loc_pan_y_initial,                                                               // Initial pan-y coordinate.
+ float             loc_pan_z_initial,                                                               // Initial pan-z coordinate.
+ nu::render_target loc_target                                                                       // Render target.
+)
 {
   char*  loc_title_buffer;
   size_t loc_title_size;
+  size_t i;                                                                                         // Eye index.
 
   title                     = loc_title;                                                            // Initializing window title...
+  target                    = loc_target;                                                           // Initializing render target...
+  offscreen_fbo             = 0;                                                                    // Initializing offscreen framebuffer...
+  offscreen_color           = 0;                                                                    // Initializing offscreen color renderbuffer...
+  offscreen_depth           = 0;                                                                    // Initializing offscreen depth-stencil renderbuffer...
   window_size_x             = loc_window_size_x;                                                    // Initializing window x-size [px]...
   window_size_y             = loc_window_size_y;                                                    // Initializing window y-size [px]...
   aspect_ratio              = (float)window_size_x/(float)window_size_y;                            // Initializing window aspect ration []...
@@ -3587,6 +3881,7 @@ void nu::opengl::init
   int         glfw_ver_minor;
   int         glfw_rev;
   std::string glfw_ver_string;
+  bool        loc_headless;                                                                         // Headless ("null" platform and EGL) flag.
 
   int         opengl_ver_major;                                                                     // OpenGL version major number.
   int         opengl_ver_minor;                                                                     // OpenGL version minor number.
@@ -3600,6 +3895,11 @@ void nu::opengl::init
   opengl_ver_minor                 = 6;                                                             // EZOR 04NOV2018: to be generalized by iterative search.
   opengl_msaa                      = 4;                                                             // 3 or 4 is good due to the oversampling-decimation method.
 
+  if(target == OFFSCREEN)
+  {
+    opengl_ver_minor = 5;                                                                           // Mesa llvmpipe exposes OpenGL 4.5 core at most.
+  }
+
   loc_title_size                   = loc_title.size ();                                             // Getting source size...
   loc_title_buffer                 = new char[loc_title_size + 1]();
   loc_title.copy (loc_title_buffer, loc_title.size ());                                             // Copying title into char buffer...
@@ -3615,6 +3915,17 @@ void nu::opengl::init
 
   neutrino::action (glfw_ver_string);                                                               // Printing message...
 
+  // Selecting headless platform (no display server needed, GLFW >= 3.4 at build and run time):
+  loc_headless                     = false;                                                         // Resetting headless flag...
+
+#ifdef NU_GLFW_NULL
+  if((target == OFFSCREEN) && ((glfw_ver_major > 3) || ((glfw_ver_major == 3) && (glfw_ver_minor >= 4))))
+  {
+    glfwInitHint (GLFW_PLATFORM, GLFW_PLATFORM_NULL);                                               // Setting GLFW "null" platform...
+    loc_headless = true;                                                                            // Setting headless flag...
+  }
+#endif
+
   // Initializing GLFW context:
   if(glfwInit () == GLFW_TRUE)                                                                      // Inititalizing GLFW context...
   {
@@ -3623,6 +3934,17 @@ void nu::opengl::init
     glfwWindowHint (GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);                                           // Initializing GLFW hints...
     glfwWindowHint (GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);                                 // Initializing GLFW hints...
     glfwWindowHint (GLFW_SAMPLES, opengl_msaa);                                                     // Initializing GLFW hints... EZOR 05OCT2018: (was 4)
+
+    if(target == OFFSCREEN)
+    {
+      glfwWindowHint (GLFW_VISIBLE, GLFW_FALSE);                                                    // Hiding window...
+      glfwWindowHint (GLFW_SAMPLES, 0);                                                             // Rendering into a single-sampled framebuffer object...
+    }
+
+    if(loc_headless)
+    {
+      glfwWindowHint (GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);                             // Using EGL context (surfaceless on "null" platform)...
+    }
   }
 
   else
@@ -3641,6 +3963,20 @@ void nu::opengl::init
                  NULL                                                                               // Share.
                 );
 
+  // Falling back on OSMesa context (software rendering):
+  if(!glfw_window && (target == OFFSCREEN))
+  {
+    glfwWindowHint (GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);                            // Using OSMesa context...
+    glfw_window = glfwCreateWindow
+                  (
+                   window_size_x,                                                                   // Window x-size [px].
+                   window_size_y,                                                                   // Window y-size [px].
+                   loc_title_buffer,                                                                // Window title.
+                   NULL,                                                                            // Monitor.
+                   NULL                                                                             // Share.
+                  );
+  }
+
   delete loc_title_buffer;
 
   if(!glfw_window)
@@ -3681,8 +4017,75 @@ void nu::opengl::init
   );                                                                                                // Getting window size...
   aspect_ratio = (float)framebuffer_size_x/(float)framebuffer_size_y;                               // Setting window aspect ration []...
 
+  // Creating offscreen framebuffer:
+  if(target == OFFSCREEN)
+  {
+    window_size_x      = loc_window_size_x;                                                         // Setting window x-size [px]...
+    window_size_y      = loc_window_size_y;                                                         // Setting window y-size [px]...
+    framebuffer_size_x = loc_window_size_x;                                                         // Setting framebuffer x-size [px]...
+    framebuffer_size_y = loc_window_size_y;                                                         // Setting framebuffer y-size [px]...
+    aspect_ratio       = (float)framebuffer_size_x/(float)framebuffer_size_y;                       // Setting framebuffer aspect ratio []...
+
+    glGenRenderbuffers (1, &offscreen_color);                                                       // Generating color renderbuffer...
+    glBindRenderbuffer (GL_RENDERBUFFER, offscreen_color);                                          // Binding color renderbuffer...
+    glRenderbufferStorage (GL_RENDERBUFFER, GL_RGBA8, framebuffer_size_x, framebuffer_size_y);      // Allocating color renderbuffer...
+    glGenRenderbuffers (1, &offscreen_depth);                                                       // Generating depth-stencil renderbuffer...
+    glBindRenderbuffer (GL_RENDERBUFFER, offscreen_depth);                                          // Binding depth-stencil renderbuffer...
+    glRenderbufferStorage (
+                           GL_RENDERBUFFER,
+                           GL_DEPTH24_STENCIL8,
+                           framebuffer_size_x,
+                           framebuffer_size_y
+                          );                                                                        // Allocating depth-stencil renderbuffer...
+    glBindRenderbuffer (GL_RENDERBUFFER, 0);                                                        // Unbinding renderbuffer...
+    glGenFramebuffers (1, &offscreen_fbo);                                                          // Generating framebuffer...
+    glBindFramebuffer (GL_FRAMEBUFFER, offscreen_fbo);                                              // Binding framebuffer (draw and read)...
+    glFramebufferRenderbuffer (
+                               GL_FRAMEBUFFER,
+                               GL_COLOR_ATTACHMENT0,
+                               GL_RENDERBUFFER,
+                               offscreen_color
+                              );                                                                    // Attaching color renderbuffer...
+    glFramebufferRenderbuffer (
+                               GL_FRAMEBUFFER,
+                               GL_DEPTH_STENCIL_ATTACHMENT,
+                               GL_RENDERBUFFER,
+                               offscreen_depth
+                              );                                                                    // Attaching depth-stencil renderbuffer...
+
+    if(glCheckFramebufferStatus (GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+      neutrino::error ("unable to create offscreen framebuffer!\n");                                // Printing message...
+      glfwTerminate ();                                                                             // Terminating GLFW context...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    glViewport (0, 0, framebuffer_size_x, framebuffer_size_y);                                      // Setting viewport...
+  }
+
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
   glClearColor (0.0f, 0.0f, 0.0f, 1.0f);                                                            // Setting color for clearing window...
+
+  // Creating camera uniform buffers:
+  glGenBuffers (2, camera_ubo);                                                                     // Generating camera uniform buffers...
+
+  for(i = 0; i < 2; i++)
+  {
+    memset (&camera[i], 0, sizeof (nu_camera_structure));                                           // Resetting camera uniform block...
+    glBindBuffer (GL_UNIFORM_BUFFER, camera_ubo[i]);                                                // Binding camera uniform buffer...
+    glBufferData (GL_UNIFORM_BUFFER, sizeof (nu_camera_structure), &camera[i], GL_DYNAMIC_DRAW);    // Allocating camera uniform buffer...
+  }
+
+  glBindBuffer (GL_UNIFORM_BUFFER, 0);                                                              // Unbinding camera uniform buffer...
+
+  // Creating stereo uniform buffer:
+  memset (&stereo, 0, sizeof (nu_stereo_structure));                                                // Resetting stereo uniform block...
+  glGenBuffers (1, &stereo_ubo);                                                                    // Generating stereo uniform buffer...
+  glBindBuffer (GL_UNIFORM_BUFFER, stereo_ubo);                                                     // Binding stereo uniform buffer...
+  glBufferData (GL_UNIFORM_BUFFER, sizeof (nu_stereo_structure), &stereo, GL_DYNAMIC_DRAW);         // Allocating stereo uniform buffer...
+  glBindBuffer (GL_UNIFORM_BUFFER, 0);                                                              // Unbinding stereo uniform buffer...
+  cull_program = 0;                                                                                 // Resetting culling program...
+  dynamic_fbo  = 0;                                                                                 // Resetting dynamic resolution framebuffer...
   glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);                                              // Clearing window...
 
   // SETTINGS FOR TRANSPARENCY:
@@ -3725,6 +4128,15 @@ void nu::opengl::init
   backup (T_mat_old, T_mat);                                                                        // Backing up translation matrix...
 
   glfwSwapInterval (1);                                                                             // Enabling screen vertical retrace synch (vsync)...
+  vsync           = true;                                                                           // Setting vsync flag...
+  pacing          = EVERY_STEP;                                                                     // Setting frame pacing mode...
+  pacing_steps    = 1;                                                                              // Setting simulation steps per rendered frame...
+  pacing_count    = 0;                                                                              // Resetting simulation steps since last rendered frame...
+  pacing_interval = NU_PACING_INTERVAL/1000.0;                                                      // Setting frame interval [s]...
+  pacing_last     = glfwGetTime ();                                                                 // Setting last rendered frame time [s]...
+  dynamic         = false;                                                                          // Resetting dynamic resolution flag...
+  dynamic_pending = false;                                                                          // Resetting dynamic resolution pending flag...
+  dynamic_target  = NU_DYNAMIC_TARGET/1000.0;                                                       // Setting dynamic resolution target [s]...
   glfwSwapBuffers (glfw_window);                                                                    // Swapping front and back buffers...
   glfwPollEvents ();                                                                                // Polling GLFW events...
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
@@ -3763,6 +4175,213 @@ void nu::opengl::init
   neutrino::done ();                                                                                // Printing message...
 }
 
+void nu::opengl::set_vsync
+(
+ bool loc_vsync                                                                                     // Vsync flag.
+)
+{
+  vsync = loc_vsync;                                                                                // Setting vsync flag...
+  glfwSwapInterval (vsync ? 1 : 0);                                                                 // Setting screen vertical retrace synch (vsync)...
+}
+
+void nu::opengl::set_pacing
+(
+ nu::pacing_mode loc_mode,                                                                          // Frame pacing mode.
+ size_t          loc_steps,                                                                         // Simulation steps per rendered frame (K).
+ float           loc_interval                                                                       // Frame interval (T) [ms].
+)
+{
+  pacing          = loc_mode;                                                                       // Setting frame pacing mode...
+  pacing_steps    = std::min (std::max (loc_steps, (size_t)1), (size_t)NU_PACING_MAX_STEPS);        // Setting simulation steps per rendered frame...
+  pacing_interval = std::max (loc_interval, 0.0f)/1000.0;                                           // Setting frame interval [s]...
+  pacing_count    = 0;                                                                              // Resetting simulation steps since last rendered frame...
+  pacing_last     = glfwGetTime ();                                                                 // Setting last rendered frame time [s]...
+}
+
+bool nu::opengl::render ()
+{
+  bool   loc_render = false;                                                                        // Render flag.
+  double loc_time;                                                                                  // Current time [s].
+  double loc_elapsed;                                                                               // Time since last rendered frame [s].
+  double loc_steps;                                                                                 // Adapted simulation steps per rendered frame.
+
+  pacing_count++;                                                                                   // Counting simulation steps...
+
+  switch(pacing)
+  {
+    case EVERY_STEP:
+      loc_render = true;                                                                            // Rendering at each step...
+      break;
+
+    case FIXED_STEPS:
+      loc_render = (pacing_count >= pacing_steps);                                                  // Rendering every K steps...
+      break;
+
+    case FIXED_INTERVAL:
+      loc_render = ((glfwGetTime () - pacing_last) >= pacing_interval);                             // Rendering every T seconds...
+      break;
+
+    case ADAPTIVE_STEPS:
+      loc_render = (pacing_count >= pacing_steps);                                                  // Rendering every K steps...
+
+      if(loc_render)
+      {
+        loc_time    = glfwGetTime ();                                                               // Getting current time [s]...
+        loc_elapsed = loc_time - pacing_last;                                                       // Computing time since last rendered frame [s]...
+
+        if(loc_elapsed > 0.0)
+        {
+          // Adapting K to the frame interval (at most doubling or halving it per frame):
+          loc_steps    = (double)pacing_steps*pacing_interval/loc_elapsed;                          // Computing adapted steps...
+          loc_steps    = std::min (std::max (loc_steps, 0.5*pacing_steps), 2.0*pacing_steps);       // Limiting adaptation rate...
+          pacing_steps = (size_t)std::min (std::max (loc_steps, 1.0), (double)NU_PACING_MAX_STEPS); // Setting simulation steps per rendered frame...
+        }
+      }
+      break;
+  }
+
+  if(loc_render)
+  {
+    pacing_count = 0;                                                                               // Resetting simulation steps since last rendered frame...
+    pacing_last  = glfwGetTime ();                                                                  // Setting last rendered frame time [s]...
+  }
+
+  return loc_render;                                                                                // Returning render flag...
+}
+
+size_t nu::opengl::steps ()
+{
+  return pacing_steps;                                                                              // Returning simulation steps per rendered frame...
+}
+
+void nu::opengl::set_dynamic
+(
+ bool  loc_dynamic,                                                                                 // Dynamic resolution flag.
+ float loc_target                                                                                   // GPU frame time target [ms].
+)
+{
+  resolve ();                                                                                       // Resolving pending frame...
+  dynamic                  = loc_dynamic;                                                           // Setting dynamic resolution flag...
+  dynamic_target           = std::max (loc_target, 1.0f)/1000.0;                                    // Setting GPU frame time target [s]...
+  neutrino::render_dynamic = dynamic;                                                               // Setting dynamic resolution flag (overlay)...
+  neutrino::render_scale   = 1.0f;                                                                  // Resetting render scale...
+}
+
+float nu::opengl::get_scale ()
+{
+  return neutrino::render_scale;                                                                    // Returning render scale...
+}
+
+void nu::opengl::dynamic_bind ()
+{
+  int loc_size_x;                                                                                   // Scaled framebuffer x-size [px].
+  int loc_size_y;                                                                                   // Scaled framebuffer y-size [px].
+
+  loc_size_x = std::max ((int)round (neutrino::render_scale*framebuffer_size_x), 1);                // Computing scaled x-size [px]...
+  loc_size_y = std::max ((int)round (neutrino::render_scale*framebuffer_size_y), 1);                // Computing scaled y-size [px]...
+
+  if(dynamic_fbo == 0)
+  {
+    glGenRenderbuffers (1, &dynamic_color);                                                         // Generating color renderbuffer...
+    glGenRenderbuffers (1, &dynamic_depth);                                                         // Generating depth-stencil renderbuffer...
+    glGenFramebuffers (1, &dynamic_fbo);                                                            // Generating framebuffer...
+    dynamic_size_x = 0;                                                                             // Resetting x-size (forcing allocation)...
+    dynamic_size_y = 0;                                                                             // Resetting y-size (forcing allocation)...
+  }
+
+  glBindFramebuffer (GL_FRAMEBUFFER, dynamic_fbo);                                                  // Binding framebuffer (draw and read)...
+
+  if((loc_size_x != dynamic_size_x) || (loc_size_y != dynamic_size_y))
+  {
+    dynamic_size_x = loc_size_x;                                                                    // Setting x-size [px]...
+    dynamic_size_y = loc_size_y;                                                                    // Setting y-size [px]...
+    glBindRenderbuffer (GL_RENDERBUFFER, dynamic_color);                                            // Binding color renderbuffer...
+    glRenderbufferStorage (GL_RENDERBUFFER, GL_RGBA8, dynamic_size_x, dynamic_size_y);              // Allocating color renderbuffer...
+    glBindRenderbuffer (GL_RENDERBUFFER, dynamic_depth);                                            // Binding depth-stencil renderbuffer...
+    glRenderbufferStorage (GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, dynamic_size_x, dynamic_size_y);   // Allocating depth-stencil renderbuffer...
+    glBindRenderbuffer (GL_RENDERBUFFER, 0);                                                        // Unbinding renderbuffer...
+    glFramebufferRenderbuffer (
+                               GL_FRAMEBUFFER,
+                               GL_COLOR_ATTACHMENT0,
+                               GL_RENDERBUFFER,
+                               dynamic_color
+                              );                                                                    // Attaching color renderbuffer...
+    glFramebufferRenderbuffer (
+                               GL_FRAMEBUFFER,
+                               GL_DEPTH_STENCIL_ATTACHMENT,
+                               GL_RENDERBUFFER,
+                               dynamic_depth
+                              );                                                                    // Attaching depth-stencil renderbuffer...
+
+    if(glCheckFramebufferStatus (GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+      neutrino::error ("unable to create dynamic resolution framebuffer!\n");                       // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  glViewport (0, 0, dynamic_size_x, dynamic_size_y);                                                // Setting viewport...
+}
+
+void nu::opengl::dynamic_resolve ()
+{
+  glBindFramebuffer (GL_READ_FRAMEBUFFER, dynamic_fbo);                                             // Binding dynamic resolution framebuffer (read)...
+  glBindFramebuffer (GL_DRAW_FRAMEBUFFER, offscreen_fbo);                                           // Binding window (or offscreen) framebuffer (draw)...
+  glBlitFramebuffer (
+                     0,
+                     0,
+                     dynamic_size_x,
+                     dynamic_size_y,
+                     0,
+                     0,
+                     framebuffer_size_x,
+                     framebuffer_size_y,
+                     GL_COLOR_BUFFER_BIT,
+                     GL_LINEAR
+                    );                                                                              // Upscaling...
+  glBindFramebuffer (GL_FRAMEBUFFER, offscreen_fbo);                                                // Binding window (or offscreen) framebuffer...
+  glViewport (0, 0, framebuffer_size_x, framebuffer_size_y);                                        // Setting viewport...
+}
+
+void nu::opengl::resolve ()
+{
+  if(dynamic_pending)
+  {
+    neutrino::gpu_begin (GPU_PLOT);                                                                 // Beginning GPU timer...
+    dynamic_resolve ();                                                                             // Upscaling to window...
+    neutrino::gpu_end ();                                                                           // Ending GPU timer...
+    dynamic_pending = false;                                                                        // Resetting dynamic resolution pending flag...
+  }
+}
+
+void nu::opengl::dynamic_update ()
+{
+  double loc_time;                                                                                  // GPU frame time [s].
+  double loc_ratio;                                                                                 // Target/measured frame time ratio.
+  double loc_scale;                                                                                 // Render scale.
+
+  loc_time = neutrino::get_gpu_time (GPU_CLEAR) +
+             neutrino::get_gpu_time (GPU_PLOT) +
+             neutrino::get_gpu_time (GPU_GUI);                                                      // Computing GPU frame time [s]...
+
+  if(loc_time <= 0.0)
+  {
+    return;                                                                                         // No measurement...
+  }
+
+  loc_ratio = dynamic_target/loc_time;                                                              // Computing frame time ratio...
+
+  if(fabs (loc_ratio - 1.0) < NU_DYNAMIC_DEADBAND)
+  {
+    return;                                                                                         // Within deadband...
+  }
+
+  loc_scale              = neutrino::render_scale*sqrt (loc_ratio);                                 // Correcting scale (pixels ~ scale^2)...
+  loc_scale              = 0.5*(loc_scale + neutrino::render_scale);                                // Damping correction...
+  loc_scale              = NU_DYNAMIC_STEP*round (loc_scale/NU_DYNAMIC_STEP);                       // Quantizing scale...
+  neutrino::render_scale = (float)std::min (std::max (loc_scale, (double)NU_DYNAMIC_MIN_SCALE), 1.0);// Setting render scale...
+}
+
 void nu::opengl::poll_events ()
 {
 
@@ -4141,9 +4760,17 @@ bool nu::opengl::closed ()
 
 void nu::opengl::clear ()
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  neutrino::gpu_begin (GPU_CLEAR);                                                                  // Beginning GPU timer...
   glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);                                              // Clearing window...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  if(dynamic)
+  {
+    dynamic_bind ();                                                                                // Binding dynamic resolution framebuffer...
+    glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);                                            // Clearing dynamic resolution framebuffer...
+    dynamic_pending = true;                                                                         // Leaving it bound until resolve...
+  }
+
+  neutrino::gpu_end ();                                                                             // Ending GPU timer...
 }
 
 void nu::opengl::plot
@@ -4153,14 +4780,53 @@ void nu::opengl::plot
  nu::view_mode       loc_vmode                                                                      // OpenGL view mode.
 )
 {
+  plot (loc_shader, POINTS, loc_pmode, loc_vmode);                                                  // Plotting "points"...
+}
+
+void nu::opengl::plot
+(
+ nu::shader*         loc_shader,                                                                    // OpenGL shader.
+ nu::primitive_mode  loc_primitive,                                                                 // OpenGL primitive mode.
+ nu::projection_mode loc_pmode,                                                                     // OpenGL projection mode.
+ nu::view_mode       loc_vmode                                                                      // OpenGL view mode.
+)
+{
+  float loc_size_x;                                                                                 // Render x-size [px_float].
+  float loc_size_y;                                                                                 // Render y-size [px_float].
+  int   loc_view_x;                                                                                 // Viewport x-size [px].
+  int   loc_view_y;                                                                                 // Viewport y-size [px].
+
+  nu::zone loc_zone ("plot", GL_TRACK);                                                             // Profiling zone...
+
+  neutrino::gpu_begin (GPU_PLOT);                                                                   // Beginning GPU timer...
+
+  if(dynamic)
+  {
+    if(!dynamic_pending)
+    {
+      dynamic_bind ();                                                                              // Binding dynamic resolution framebuffer (once per frame)...
+      dynamic_pending = true;                                                                       // Leaving it bound until resolve...
+    }
+
+    loc_size_x = (float)dynamic_size_x;                                                             // Setting render x-size [px_float]...
+    loc_size_y = (float)dynamic_size_y;                                                             // Setting render y-size [px_float]...
+    loc_view_x = dynamic_size_x;                                                                    // Setting viewport x-size [px]...
+    loc_view_y = dynamic_size_y;                                                                    // Setting viewport y-size [px]...
+  }
+  else
+  {
+    loc_size_x = (float)framebuffer_size_x;                                                         // Setting render x-size [px_float]...
+    loc_size_y = (float)framebuffer_size_y;                                                         // Setting render y-size [px_float]...
+    loc_view_x = window_size_x;                                                                     // Setting viewport x-size [px]...
+    loc_view_y = window_size_y;                                                                     // Setting viewport y-size [px]...
+  }
+
   PR_mode = loc_pmode;                                                                              // Setting OpenGL projection mode...
   VR_mode = loc_vmode;                                                                              // Setting OpenGL view mode...
 
   switch(PR_mode)
   {
     case MONOCULAR:
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
-
       // Computing view matrix:
       multiplicate (V_mat, T_mat, R_mat);                                                           // Setting view matrix...
 
@@ -4175,29 +4841,39 @@ void nu::opengl::plot
           break;
       }
 
+      // Culling:
+      if((loc_primitive == POINTS) && (loc_shader->cull_data != NULL))
+      {
+        cull (loc_shader, V_mat, P_mat, 1);                                                         // Culling nodes...
+      }
+
+      // Setting camera:
+      set_camera (
+                  0,                                                                                // Eye index.
+                  V_mat,                                                                            // View matrix.
+                  P_mat,                                                                            // Projection matrix.
+                  loc_size_x,                                                                       // Framebuffer size_x.
+                  loc_size_y,                                                                       // Framebuffer size_y.
+                  aspect_ratio                                                                      // Framebuffer aspect ratio.
+                 );
+
       // Setting plot style:
       set_shader (
                   loc_shader,                                                                       // Shader.
                   V_mat,                                                                            // View matrix.
                   P_mat,                                                                            // Projection matrix.
-                  (float)framebuffer_size_x,                                                        // Framebuffer size_x.
-                  (float)framebuffer_size_y,                                                        // Framebuffer size_y.
+                  loc_size_x,                                                                       // Framebuffer size_x.
+                  loc_size_y,                                                                       // Framebuffer size_y.
                   aspect_ratio                                                                      // Framebuffer aspect ratio.
                  );
 
       // Drawing:
-      glViewport (0, 0, window_size_x, window_size_y);
-      glDrawArrays (
-                    GL_POINTS,
-                    0,
-                    loc_shader->size
-                   );                                                                               // Drawing "points"...
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      glViewport (0, 0, loc_view_x, loc_view_y);
+      draw (loc_shader, loc_primitive, 1);                                                          // Drawing...
+      neutrino::fence_gl ();                                                                        // Fencing OpenGL commands...
       break;
 
     case BINOCULAR:
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
-
       multiplicate (V_mat, T_mat, R_mat);                                                           // Setting view matrix...
       multiplicate (VL_mat, TL_mat, V_mat);                                                         // Setting left eye stereoscopic view matrix...
       multiplicate (VR_mat, TR_mat, V_mat);                                                         // Setting right eye stereoscopic view matrix...
@@ -4215,56 +4891,136 @@ void nu::opengl::plot
           break;
       }
 
-      // Left eye:
+      // Culling (center view, both eyes within the frustum margin):
+      if((loc_primitive == POINTS) && (loc_shader->cull_data != NULL))
+      {
+        cull (
+              loc_shader,                                                                           // Shader.
+              V_mat,                                                                                // View matrix.
+              P_mat,                                                                                // Projection matrix.
+              loc_shader->stereo_single ? 2 : 1                                                     // Number of instances.
+             );                                                                                     // Culling nodes...
+      }
+
+      // Single-pass stereo (both eyes in one instanced draw, gl_ViewportIndex available):
+      if(loc_shader->stereo_single)
+      {
+        set_stereo (
+                    VL_mat,                                                                         // Left eye view matrix.
+                    PL_mat,                                                                         // Left eye projection matrix.
+                    VR_mat,                                                                         // Right eye view matrix.
+                    PR_mat,                                                                         // Right eye projection matrix.
+                    (float)floor (loc_size_x/2.0),                                                  // Framebuffer size_x.
+                    loc_size_y,                                                                     // Framebuffer size_y.
+                    aspect_ratio/2.0f                                                               // Framebuffer aspect ratio.
+                   );                                                                               // Setting stereo camera...
+
+        glUseProgram (loc_shader->program);                                                         // Using shader...
+        glViewportIndexedf (
+                            0,
+                            0.0f,
+                            0.0f,
+                            (float)(loc_view_x/2),
+                            (float)loc_view_y
+                           );                                                                       // Setting left eye viewport...
+        glViewportIndexedf (
+                            1,
+                            (float)(loc_view_x/2),
+                            0.0f,
+                            (float)(loc_view_x/2),
+                            (float)loc_view_y
+                           );                                                                       // Setting right eye viewport...
+        draw (loc_shader, loc_primitive, 2);                                                        // Drawing (one instance per eye)...
+        neutrino::fence_gl ();                                                                      // Fencing OpenGL commands...
+        break;
+      }
+
+      // Left eye (two-pass stereo: both stereo block slots hold the current eye):
+      if(loc_shader->stereo_block != GL_INVALID_INDEX)
+      {
+        set_stereo (
+                    VL_mat,                                                                         // Left eye view matrix.
+                    PL_mat,                                                                         // Left eye projection matrix.
+                    VL_mat,                                                                         // Left eye view matrix.
+                    PL_mat,                                                                         // Left eye projection matrix.
+                    (float)floor (loc_size_x/2.0),                                                  // Framebuffer size_x.
+                    loc_size_y,                                                                     // Framebuffer size_y.
+                    aspect_ratio/2.0f                                                               // Framebuffer aspect ratio.
+                   );                                                                               // Setting stereo camera...
+      }
+
+      set_camera (
+                  0,                                                                                // Eye index.
+                  VL_mat,                                                                           // View matrix.
+                  PL_mat,                                                                           // Projection matrix.
+                  (float)floor (loc_size_x/2.0),                                                    // Framebuffer size_x.
+                  loc_size_y,                                                                       // Framebuffer size_y.
+                  aspect_ratio/2.0f                                                                 // Framebuffer aspect ratio.
+                 );                                                                                 // Setting camera...
+
       set_shader (
                   loc_shader,                                                                       // Shader.
                   VL_mat,                                                                           // View matrix.
                   PL_mat,                                                                           // Projection matrix.
-                  (float)floor (framebuffer_size_x/2.0),                                            // Framebuffer size_x.
-                  (float)framebuffer_size_y,                                                        // Framebuffer size_y.
+                  (float)floor (loc_size_x/2.0),                                                    // Framebuffer size_x.
+                  loc_size_y,                                                                       // Framebuffer size_y.
                   aspect_ratio/2.0f                                                                 // Framebuffer aspect ratio.
                  );                                                                                 // Setting plot style...
 
       glViewport (
                   0,
                   0,
-                  window_size_x/2,
-                  window_size_y
+                  loc_view_x/2,
+                  loc_view_y
                  );                                                                                 // Setting viewport...
-      glDrawArrays (
-                    GL_POINTS,
-                    0,
-                    loc_shader->size
-                   );                                                                               // Drawing "points"...
-
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      draw (loc_shader, loc_primitive, 1);                                                          // Drawing...
 
       // Right eye:
+      if(loc_shader->stereo_block != GL_INVALID_INDEX)
+      {
+        set_stereo (
+                    VR_mat,                                                                         // Right eye view matrix.
+                    PR_mat,                                                                         // Right eye projection matrix.
+                    VR_mat,                                                                         // Right eye view matrix.
+                    PR_mat,                                                                         // Right eye projection matrix.
+                    (float)floor (loc_size_x/2.0),                                                  // Framebuffer size_x.
+                    loc_size_y,                                                                     // Framebuffer size_y.
+                    aspect_ratio/2.0f                                                               // Framebuffer aspect ratio.
+                   );                                                                               // Setting stereo camera...
+      }
+
+      set_camera (
+                  1,                                                                                // Eye index.
+                  VR_mat,                                                                           // View matrix.
+                  PR_mat,                                                                           // Projection matrix.
+                  (float)floor (loc_size_x/2.0),                                                    // Framebuffer size_x.
+                  loc_size_y,                                                                       // Framebuffer size_y.
+                  aspect_ratio/2.0f                                                                 // Framebuffer aspect ratio.
+                 );                                                                                 // Setting camera...
+
       set_shader (
                   loc_shader,                                                                       // Shader.
                   VR_mat,                                                                           // View matrix.
                   PR_mat,                                                                           // Projection matrix.
-                  (float)floor (framebuffer_size_x/2.0),                                            // Framebuffer size_x.
-                  (float)framebuffer_size_y,                                                        // Framebuffer size_y.
+                  (float)floor (loc_size_x/2.0),                                                    // Framebuffer size_x.
+                  loc_size_y,                                                                       // Framebuffer size_y.
                   aspect_ratio/2.0f                                                                 // Framebuffer aspect ratio.
                  );                                                                                 // Setting plot style...
 
       // Setting plot style:
       glViewport (
-                  window_size_x/2,
+                  loc_view_x/2,
                   0,
-                  window_size_x/2,
-                  window_size_y
+                  loc_view_x/2,
+                  loc_view_y
                  );                                                                                 // Setting viewport...
-      glDrawArrays (
-                    GL_POINTS,
-                    0,
-                    loc_shader->size
-                   );                                                                               // Drawing "points"...
+      draw (loc_shader, loc_primitive, 1);                                                          // Drawing...
 
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      neutrino::fence_gl ();                                                                        // Fencing OpenGL commands...
       break;
   }
+
+  neutrino::gpu_end ();                                                                             // Ending GPU timer...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4280,9 +5036,20 @@ void nu::opengl::begin ()
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::opengl::refresh ()
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  resolve ();                                                                                       // Resolving dynamic resolution framebuffer (if no GUI pass)...
+
+  if(neutrino::gpu_frame () && dynamic)                                                             // Reading back GPU timers of previous frame...
+  {
+    dynamic_update ();                                                                              // Adapting render scale...
+  }
+
+  if(target == OFFSCREEN)
+  {
+    glFlush ();                                                                                     // Flushing OpenGL commands (nothing to present)...
+    return;
+  }
+
   glfwSwapBuffers (glfw_window);                                                                    // Swapping front and back buffers...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 }
 
 void nu::opengl::window_resize
@@ -4342,5 +5109,33 @@ void nu::opengl::end ()
 
 nu::opengl::~opengl ()
 {
+  glDeleteBuffers (2, camera_ubo);                                                                  // Deleting camera uniform buffers...
+  glDeleteBuffers (1, &stereo_ubo);                                                                 // Deleting stereo uniform buffer...
+
+  if(neutrino::gpu_timing)
+  {
+    glDeleteQueries (2*NU_GPU_QUERIES, &neutrino::gpu_query[0][0]);                                 // Deleting OpenGL timer queries...
+    neutrino::gpu_timing = false;                                                                   // Resetting timer queries allocated flag...
+  }
+
+  if(cull_program != 0)
+  {
+    glDeleteProgram (cull_program);                                                                 // Deleting culling program...
+  }
+
+  if(dynamic_fbo != 0)
+  {
+    glDeleteFramebuffers (1, &dynamic_fbo);                                                         // Deleting dynamic resolution framebuffer...
+    glDeleteRenderbuffers (1, &dynamic_color);                                                      // Deleting dynamic resolution color renderbuffer...
+    glDeleteRenderbuffers (1, &dynamic_depth);                                                      // Deleting dynamic resolution depth-stencil renderbuffer...
+  }
+
+  if(offscreen_fbo != 0)
+  {
+    glDeleteFramebuffers (1, &offscreen_fbo);                                                       // Deleting offscreen framebuffer...
+    glDeleteRenderbuffers (1, &offscreen_color);                                                    // Deleting offscreen color renderbuffer...
+    glDeleteRenderbuffers (1, &offscreen_depth);                                                    // Deleting offscreen depth-stencil renderbuffer...
+  }
+
   glfwTerminate ();                                                                                 // Terminating GLFW...
 }
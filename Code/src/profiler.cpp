@@ -0,0 +1,435 @@
+/// @file     profiler.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "profiler" class (hierarchical frame profiler).
+
+#include "profiler.hpp"
+
+std::string                                   nu::profiler::file_name;                              // Trace file name (static variable storage).
+std::chrono::steady_clock::time_point         nu::profiler::origin;                                 // Trace time origin (static variable storage).
+std::mutex                                    nu::profiler::lock;                                   // Profiler lock (static variable storage).
+std::vector<std::shared_ptr<nu::profiler_buffer> > nu::profiler::buffer;                            // Per-thread buffers (static variable storage).
+std::vector<nu::profiler_gl_zone>             nu::profiler::gl_pending;                             // Pending OpenGL zones (static variable storage).
+std::vector<GLuint>                           nu::profiler::gl_free;                                // Free GL_TIMESTAMP queries (static variable storage).
+bool                                          nu::profiler::gl_calibrated = false;                  // OpenGL clock calibration flag (static variable storage).
+double                                        nu::profiler::gl_offset     = 0.0;                    // OpenGL clock offset [us] (static variable storage).
+std::vector<nu::profiler_cl_zone>             nu::profiler::cl_pending;                             // Pending OpenCL zones (static variable storage).
+std::atomic<bool>                             nu::profiler::enabled (false);                        // Profiler running flag (static variable storage).
+
+// JSON string escaper:
+static std::string nu_profiler_escape (
+                                       const std::string& loc_text                                  // Text.
+                                      )
+{
+  std::string loc_escaped;                                                                          // Escaped text.
+  size_t      i;                                                                                    // Character index.
+
+  for(i = 0; i < loc_text.size (); i++)
+  {
+    if((loc_text[i] == '"') || (loc_text[i] == '\\'))
+    {
+      loc_escaped += '\\';                                                                          // Escaping character...
+    }
+
+    if((unsigned char)loc_text[i] >= 0x20)
+    {
+      loc_escaped += loc_text[i];                                                                   // Adding character (control characters dropped)...
+    }
+  }
+
+  return loc_escaped;                                                                               // Returning escaped text...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "profiler" class //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::profiler::profiler ()
+{
+  // Doing nothing!
+}
+
+nu::profiler_buffer* nu::profiler::local ()
+{
+  thread_local std::shared_ptr<nu::profiler_buffer> loc_buffer;                                     // Thread buffer.
+
+  if(!loc_buffer)
+  {
+    std::lock_guard<std::mutex> loc_lock (lock);                                                    // Locking registry...
+
+    loc_buffer      = std::make_shared<nu::profiler_buffer> ();                                     // Creating thread buffer...
+    loc_buffer->tid = (int)buffer.size () + 1;                                                      // Setting trace thread ID...
+    buffer.push_back (loc_buffer);                                                                  // Registering thread buffer...
+  }
+
+  return loc_buffer.get ();                                                                         // Returning thread buffer...
+}
+
+double nu::profiler::now ()
+{
+  std::chrono::duration<double, std::micro> loc_time;                                               // Time since trace origin [us].
+
+  loc_time = std::chrono::steady_clock::now () - origin;                                            // Computing time since trace origin [us]...
+
+  return loc_time.count ();                                                                         // Returning time [us]...
+}
+
+void nu::profiler::start (
+                          std::string loc_file_name                                                 // Trace file name.
+                         )
+{
+  size_t i;                                                                                         // Buffer index.
+
+  neutrino::action ("starting profiler...");                                                        // Printing message...
+
+  {
+    std::lock_guard<std::mutex> loc_lock (lock);                                                    // Locking registry...
+
+    for(i = 0; i < buffer.size (); i++)
+    {
+      std::lock_guard<std::mutex> loc_buffer_lock (buffer[i]->lock);                                // Locking thread buffer...
+      buffer[i]->event.clear ();                                                                    // Clearing events...
+    }
+  }
+
+  file_name     = loc_file_name;                                                                    // Setting trace file name...
+  origin        = std::chrono::steady_clock::now ();                                                // Setting trace time origin...
+  gl_calibrated = false;                                                                            // Resetting OpenGL clock calibration...
+  enabled       = true;                                                                             // Starting recording...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::profiler::cpu (
+                        const char* loc_name,                                                       // Zone name.
+                        double      loc_begin,                                                      // Begin time [us].
+                        double      loc_end                                                         // End time [us].
+                       )
+{
+  nu::profiler_buffer* loc_buffer = local ();                                                       // Thread buffer.
+  nu::profiler_event   loc_event;                                                                   // Event.
+
+  loc_event.name = loc_name;                                                                        // Setting zone name...
+  loc_event.pid  = NU_PROFILER_HOST_PID;                                                            // Setting trace process ID...
+  loc_event.tid  = loc_buffer->tid;                                                                 // Setting trace thread ID...
+  loc_event.ts   = loc_begin;                                                                       // Setting begin time [us]...
+  loc_event.dur  = loc_end - loc_begin;                                                             // Setting duration [us]...
+
+  std::lock_guard<std::mutex> loc_lock (loc_buffer->lock);                                          // Locking thread buffer...
+  loc_buffer->event.push_back (loc_event);                                                          // Recording event...
+}
+
+GLuint nu::profiler::gl_begin ()
+{
+  GLint64 loc_timestamp;                                                                            // OpenGL timestamp [ns].
+  GLuint  loc_query;                                                                                // GL_TIMESTAMP query.
+
+  if(!gl_calibrated)
+  {
+    glGetInteger64v (GL_TIMESTAMP, &loc_timestamp);                                                 // Getting OpenGL timestamp (synchronous)...
+    gl_offset     = now () - 1.0E-3*(double)loc_timestamp;                                          // Setting OpenGL clock offset [us]...
+    gl_calibrated = true;                                                                           // Setting calibration flag...
+  }
+
+  if(gl_free.empty ())
+  {
+    glGenQueries (1, &loc_query);                                                                   // Generating query...
+  }
+  else
+  {
+    loc_query = gl_free.back ();                                                                    // Reusing query...
+    gl_free.pop_back ();                                                                            // Removing query from free list...
+  }
+
+  glQueryCounter (loc_query, GL_TIMESTAMP);                                                         // Issuing begin timestamp...
+
+  return loc_query;                                                                                 // Returning query...
+}
+
+void nu::profiler::gl_end (
+                           const char* loc_name,                                                    // Zone name.
+                           GLuint      loc_query                                                    // Begin GL_TIMESTAMP query.
+                          )
+{
+  nu::profiler_gl_zone loc_zone;                                                                    // OpenGL zone.
+  size_t               loc_pending;                                                                 // Number of pending zones.
+
+  loc_zone.name     = loc_name;                                                                     // Setting zone name...
+  loc_zone.query[0] = loc_query;                                                                    // Setting begin query...
+
+  if(gl_free.empty ())
+  {
+    glGenQueries (1, &loc_zone.query[1]);                                                           // Generating query...
+  }
+  else
+  {
+    loc_zone.query[1] = gl_free.back ();                                                            // Reusing query...
+    gl_free.pop_back ();                                                                            // Removing query from free list...
+  }
+
+  glQueryCounter (loc_zone.query[1], GL_TIMESTAMP);                                                 // Issuing end timestamp...
+
+  {
+    std::lock_guard<std::mutex> loc_lock (lock);                                                    // Locking pending zones...
+    gl_pending.push_back (loc_zone);                                                                // Adding pending zone...
+    loc_pending = gl_pending.size ();                                                               // Getting number of pending zones...
+  }
+
+  if(loc_pending >= NU_PROFILER_PENDING)
+  {
+    collect (false);                                                                                // Reading back completed zones...
+  }
+}
+
+void nu::profiler::cl (
+                       const char* loc_name,                                                        // Zone name.
+                       cl_event    loc_event                                                        // OpenCL event.
+                      )
+{
+  nu::profiler_cl_zone loc_zone;                                                                    // OpenCL zone.
+  size_t               loc_pending;                                                                 // Number of pending zones.
+
+  if(!enabled || (loc_event == NULL))
+  {
+    return;                                                                                         // Not recording...
+  }
+
+  clRetainEvent (loc_event);                                                                        // Retaining event...
+  loc_zone.name   = loc_name;                                                                       // Setting zone name...
+  loc_zone.event  = loc_event;                                                                      // Setting event...
+  loc_zone.submit = now ();                                                                         // Setting host submission time [us]...
+
+  {
+    std::lock_guard<std::mutex> loc_lock (lock);                                                    // Locking pending zones...
+    cl_pending.push_back (loc_zone);                                                                // Adding pending zone...
+    loc_pending = cl_pending.size ();                                                               // Getting number of pending zones...
+  }
+
+  if(loc_pending >= NU_PROFILER_PENDING)
+  {
+    collect (false);                                                                                // Reading back completed zones...
+  }
+}
+
+void nu::profiler::collect (
+                            bool loc_wait                                                           // Wait flag.
+                           )
+{
+  std::lock_guard<std::mutex>       loc_lock (lock);                                                // Locking pending zones...
+  std::vector<nu::profiler_gl_zone> loc_gl_pending;                                                 // OpenGL zones still in flight.
+  std::vector<nu::profiler_cl_zone> loc_cl_pending;                                                 // OpenCL zones still in flight.
+  std::vector<nu::profiler_event>   loc_event;                                                      // Completed GPU zones.
+  nu::profiler_event                loc_gpu_event;                                                  // Completed GPU zone.
+  GLint                             loc_available;                                                  // Query availability.
+  GLuint64                          loc_begin;                                                      // OpenGL begin timestamp [ns].
+  GLuint64                          loc_end;                                                        // OpenGL end timestamp [ns].
+  cl_int                            loc_status;                                                     // OpenCL event status.
+  cl_ulong                          loc_queued;                                                     // OpenCL queued timestamp [ns].
+  cl_ulong                          loc_start;                                                      // OpenCL start timestamp [ns].
+  cl_ulong                          loc_stop;                                                       // OpenCL end timestamp [ns].
+  cl_int                            loc_error;                                                      // OpenCL error code.
+  size_t                            i;                                                              // Zone index.
+
+  // Reading back OpenGL zones:
+  for(i = 0; i < gl_pending.size (); i++)
+  {
+    glGetQueryObjectiv (gl_pending[i].query[1], GL_QUERY_RESULT_AVAILABLE, &loc_available);         // Checking end query availability...
+
+    if(!loc_available && !loc_wait)
+    {
+      loc_gl_pending.push_back (gl_pending[i]);                                                     // Keeping zone in flight...
+      continue;
+    }
+
+    glGetQueryObjectui64v (gl_pending[i].query[0], GL_QUERY_RESULT, &loc_begin);                    // Getting begin timestamp [ns]...
+    glGetQueryObjectui64v (gl_pending[i].query[1], GL_QUERY_RESULT, &loc_end);                      // Getting end timestamp [ns]...
+    gl_free.push_back (gl_pending[i].query[0]);                                                     // Freeing begin query...
+    gl_free.push_back (gl_pending[i].query[1]);                                                     // Freeing end query...
+
+    loc_gpu_event.name = gl_pending[i].name;                                                        // Setting zone name...
+    loc_gpu_event.pid  = NU_PROFILER_GPU_PID;                                                       // Setting trace process ID...
+    loc_gpu_event.tid  = NU_PROFILER_GL_TID;                                                        // Setting trace thread ID...
+    loc_gpu_event.ts   = gl_offset + 1.0E-3*(double)loc_begin;                                      // Setting begin time [us]...
+    loc_gpu_event.dur  = 1.0E-3*(double)(loc_end - loc_begin);                                      // Setting duration [us]...
+    loc_event.push_back (loc_gpu_event);                                                            // Recording event...
+  }
+
+  // Reading back OpenCL zones:
+  for(i = 0; i < cl_pending.size (); i++)
+  {
+    if(loc_wait)
+    {
+      clWaitForEvents (1, &cl_pending[i].event);                                                    // Waiting for event...
+    }
+
+    clGetEventInfo (
+                    cl_pending[i].event,
+                    CL_EVENT_COMMAND_EXECUTION_STATUS,
+                    sizeof (cl_int),
+                    &loc_status,
+                    NULL
+                   );                                                                               // Getting event status...
+
+    if((loc_status > CL_COMPLETE) && !loc_wait)
+    {
+      loc_cl_pending.push_back (cl_pending[i]);                                                     // Keeping zone in flight...
+      continue;
+    }
+
+    // Getting profiling timestamps (failing if the queue has no profiling enabled):
+    loc_error  = clGetEventProfilingInfo (
+                                          cl_pending[i].event,
+                                          CL_PROFILING_COMMAND_QUEUED,
+                                          sizeof (cl_ulong),
+                                          &loc_queued,
+                                          NULL
+                                         );
+    loc_error |= clGetEventProfilingInfo (
+                                          cl_pending[i].event,
+                                          CL_PROFILING_COMMAND_START,
+                                          sizeof (cl_ulong),
+                                          &loc_start,
+                                          NULL
+                                         );
+    loc_error |= clGetEventProfilingInfo (
+                                          cl_pending[i].event,
+                                          CL_PROFILING_COMMAND_END,
+                                          sizeof (cl_ulong),
+                                          &loc_stop,
+                                          NULL
+                                         );
+    clReleaseEvent (cl_pending[i].event);                                                           // Releasing event...
+
+    if((loc_error != CL_SUCCESS) || (loc_status < CL_COMPLETE))
+    {
+      continue;                                                                                     // No timestamps...
+    }
+
+    loc_gpu_event.name = cl_pending[i].name;                                                        // Setting zone name...
+    loc_gpu_event.pid  = NU_PROFILER_GPU_PID;                                                       // Setting trace process ID...
+    loc_gpu_event.tid  = NU_PROFILER_CL_TID;                                                        // Setting trace thread ID...
+    loc_gpu_event.ts   = cl_pending[i].submit + 1.0E-3*(double)(loc_start - loc_queued);            // Setting begin time (aligned to submission) [us]...
+    loc_gpu_event.dur  = 1.0E-3*(double)(loc_stop - loc_start);                                     // Setting duration [us]...
+    loc_event.push_back (loc_gpu_event);                                                            // Recording event...
+  }
+
+  gl_pending = loc_gl_pending;                                                                      // Updating OpenGL zones in flight...
+  cl_pending = loc_cl_pending;                                                                      // Updating OpenCL zones in flight...
+
+  // Recording GPU zones in the first thread buffer:
+  if(!loc_event.empty () && !buffer.empty ())
+  {
+    std::lock_guard<std::mutex> loc_buffer_lock (buffer[0]->lock);                                  // Locking thread buffer...
+    buffer[0]->event.insert (buffer[0]->event.end (), loc_event.begin (), loc_event.end ());        // Recording events...
+  }
+}
+
+void nu::profiler::stop ()
+{
+  std::ofstream loc_file;                                                                           // Trace file.
+  size_t        i;                                                                                  // Buffer index.
+  size_t        j;                                                                                  // Event index.
+
+  if(!enabled)
+  {
+    return;                                                                                         // Not running...
+  }
+
+  neutrino::action ("writing profiler trace...");                                                   // Printing message...
+
+  enabled = false;                                                                                  // Stopping recording...
+  local ();                                                                                         // Registering calling thread (GPU zones storage)...
+  collect (true);                                                                                   // Reading back all pending zones...
+
+  loc_file.open (file_name, std::ios::out | std::ios::trunc);                                       // Opening trace file...
+
+  if(!loc_file.is_open ())
+  {
+    neutrino::error ("unable to open profiler trace file " + file_name + "!");                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_file << std::fixed << std::setprecision (3);                                                  // Setting time format [us]...
+  loc_file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";                                    // Writing trace header...
+
+  // Writing track names:
+  loc_file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << NU_PROFILER_HOST_PID <<
+              ",\"args\":{\"name\":\"host PC\"}},\n";
+  loc_file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << NU_PROFILER_GPU_PID <<
+              ",\"args\":{\"name\":\"client GPU\"}},\n";
+  loc_file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << NU_PROFILER_GPU_PID <<
+              ",\"tid\":" << NU_PROFILER_GL_TID << ",\"args\":{\"name\":\"OpenGL\"}},\n";
+  loc_file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << NU_PROFILER_GPU_PID <<
+              ",\"tid\":" << NU_PROFILER_CL_TID << ",\"args\":{\"name\":\"OpenCL\"}}";
+
+  std::lock_guard<std::mutex> loc_lock (lock);                                                      // Locking registry...
+
+  for(i = 0; i < buffer.size (); i++)
+  {
+    std::lock_guard<std::mutex> loc_buffer_lock (buffer[i]->lock);                                  // Locking thread buffer...
+
+    loc_file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << NU_PROFILER_HOST_PID <<
+                ",\"tid\":" << buffer[i]->tid << ",\"args\":{\"name\":\"thread " << buffer[i]->tid <<
+                "\"}}";                                                                             // Writing thread name...
+
+    for(j = 0; j < buffer[i]->event.size (); j++)
+    {
+      loc_file << ",\n{\"name\":\"" << nu_profiler_escape (buffer[i]->event[j].name) <<
+                  "\",\"ph\":\"X\",\"pid\":" << buffer[i]->event[j].pid <<
+                  ",\"tid\":" << buffer[i]->event[j].tid <<
+                  ",\"ts\":" << buffer[i]->event[j].ts <<
+                  ",\"dur\":" << buffer[i]->event[j].dur << "}";                                    // Writing event...
+    }
+
+    buffer[i]->event.clear ();                                                                      // Clearing events...
+  }
+
+  loc_file << "\n]}\n";                                                                             // Writing trace footer...
+  loc_file.close ();                                                                                // Closing trace file...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+nu::profiler::~profiler ()
+{
+  stop ();                                                                                          // Stopping profiler...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "zone" class ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::zone::zone (
+                const char*        loc_name,                                                        // Zone name.
+                nu::profiler_track loc_track                                                        // Zone track.
+               )
+{
+  active = nu::profiler::enabled.load (std::memory_order_relaxed);                                  // Checking profiler...
+
+  if(!active)
+  {
+    return;                                                                                         // Profiler not running...
+  }
+
+  name  = loc_name;                                                                                 // Setting zone name...
+  gl    = (loc_track == GL_TRACK);                                                                  // Setting OpenGL timeline flag...
+  begin = nu::profiler::now ();                                                                     // Setting begin time [us]...
+
+  if(gl)
+  {
+    gl_query = nu::profiler::gl_begin ();                                                           // Issuing begin timestamp...
+  }
+}
+
+nu::zone::~zone ()
+{
+  if(!active)
+  {
+    return;                                                                                         // Profiler not running at construction...
+  }
+
+  if(gl)
+  {
+    nu::profiler::gl_end (name, gl_query);                                                          // Issuing end timestamp...
+  }
+
+  nu::profiler::cpu (name, begin, nu::profiler::now ());                                            // Recording zone...
+}
@@ -24,17 +24,56 @@ queue::queue()
                       (
                        queue::context_id,                                                           // OpenCL context ID.
                        queue::device_id,                                                            // Device ID.
-                       0,                                                                           // Queue properties (con be used for enabling profiling).
+                       nu::profiler::enabled ? CL_QUEUE_PROFILING_ENABLE : 0,                       // Queue properties (profiling, if the profiler is running).
                        &loc_error
                       );                                                                            // Error code.
 
   neutrino::check_error (loc_error);                                                                // Checking error...
 
+  neutrino::queue_id = queue_id;                                                                    // Setting neutrino OpenCL queue ID...
+  profiling          = nu::profiler::enabled;                                                       // Setting queue profiling flag...
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   neutrino::done ();                                                                                // Printing message...
 }
 
+void queue::profile ()
+{
+  cl_int           loc_error;                                                                       // Local error code.
+  cl_command_queue loc_queue;                                                                       // Profiled OpenCL queue.
+
+  if(profiling)
+  {
+    return;                                                                                         // Queue already profiled...
+  }
+
+  neutrino::action ("enabling OpenCL command queue profiling...");                                  // Printing message...
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Creating profiled OpenCL queue:
+  loc_queue          = clCreateCommandQueue
+                       (
+                        context_id,                                                                 // OpenCL context ID.
+                        device_id,                                                                  // Device ID.
+                        CL_QUEUE_PROFILING_ENABLE,                                                  // Queue properties (profiling).
+                        &loc_error
+                       );                                                                           // Error code.
+
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  loc_error          = clReleaseCommandQueue (queue_id);                                            // Releasing unprofiled OpenCL queue...
+
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  queue_id           = loc_queue;                                                                   // Setting OpenCL queue ID...
+  neutrino::queue_id = queue_id;                                                                    // Setting neutrino OpenCL queue ID...
+  profiling          = true;                                                                        // Setting queue profiling flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////// "read" functions ///////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -947,10 +986,9 @@ void queue::acquire
  GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -962,7 +1000,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -970,14 +1008,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -986,10 +1022,9 @@ void queue::acquire
  GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1001,7 +1036,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1009,14 +1044,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -1025,10 +1058,9 @@ void queue::acquire
  GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1040,7 +1072,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1048,14 +1080,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -1064,10 +1094,9 @@ void queue::acquire
  GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1079,7 +1108,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1087,14 +1116,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -1103,10 +1130,9 @@ void queue::acquire
  GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1118,7 +1144,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1126,14 +1152,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -1142,10 +1166,9 @@ void queue::acquire
  GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1157,7 +1180,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1165,14 +1188,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -1181,10 +1202,9 @@ void queue::acquire
  GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1196,7 +1216,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1204,14 +1224,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -1220,10 +1238,9 @@ void queue::acquire
  GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1235,7 +1252,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1243,14 +1260,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::acquire
@@ -1259,10 +1274,9 @@ void queue::acquire
  GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event;                                                                               // OpenCL event linked to the OpenGL fence.
+  cl_uint  loc_events;                                                                              // Number of events in event list.
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1274,7 +1288,7 @@ void queue::acquire
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  loc_events = neutrino::wait_gl (&loc_event);                                                      // Waiting for OpenGL fence...
 
   // Acquiring OpenCL buffer:
   loc_error = clEnqueueAcquireGLObjects
@@ -1282,14 +1296,12 @@ void queue::acquire
                queue_id,                                                                            // Queue.
                1,                                                                                   // Number of memory objects.
                &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
+               loc_events,                                                                          // Number of events in event list.
+               (loc_events > 0) ? &loc_event : NULL,                                                // Event list.
                NULL                                                                                 // Event.
               );
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
-
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
 void queue::release
@@ -1300,9 +1312,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1323,7 +1332,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1338,8 +1347,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1350,9 +1357,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1373,7 +1377,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1388,8 +1392,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1400,9 +1402,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1423,7 +1422,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1438,8 +1437,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1450,9 +1447,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1473,7 +1467,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1488,8 +1482,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1500,9 +1492,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1523,7 +1512,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1538,8 +1527,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1550,9 +1537,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1573,7 +1557,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1588,8 +1572,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1600,9 +1582,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1623,7 +1602,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1638,8 +1617,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1650,9 +1627,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1673,7 +1647,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1688,8 +1662,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 void queue::release
@@ -1700,9 +1672,6 @@ void queue::release
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
-
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -1723,7 +1692,7 @@ void queue::release
 
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  neutrino::fence_cl ();                                                                            // Synchronizing OpenCL with OpenGL...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1738,8 +1707,6 @@ void queue::release
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
 };
 
 queue::~queue()
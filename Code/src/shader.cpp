@@ -5,11 +5,75 @@
 
 #include "shader.hpp"
 
+#if defined(__linux__) || defined(__APPLE__)
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+// FNV-1a 64-bit hash (program binary cache key):
+static uint64_t nu_shader_hash (
+                                const std::string& loc_text                                         // Text.
+                               )
+{
+  uint64_t loc_hash = 14695981039346656037ull;                                                      // FNV offset basis.
+  size_t   i;                                                                                       // Character index.
+
+  for(i = 0; i < loc_text.size (); i++)
+  {
+    loc_hash ^= (unsigned char)loc_text[i];                                                         // Mixing character...
+    loc_hash *= 1099511628211ull;                                                                   // Multiplying by FNV prime...
+  }
+
+  return loc_hash;                                                                                  // Returning hash...
+}
+
+bool nu::shader::extension (
+                            const char* loc_extension                                               // OpenGL extension name.
+                           )
+{
+  GLint  i;                                                                                         // Index.
+  GLint  loc_extensions;                                                                            // Number of OpenGL extensions.
+  const char*
+         loc_name;                                                                                  // OpenGL extension name.
+
+  loc_extensions = 0;                                                                               // Resetting number of extensions...
+  glGetIntegerv (GL_NUM_EXTENSIONS, &loc_extensions);                                               // Getting number of extensions...
+
+  for(i = 0; i < loc_extensions; i++)
+  {
+    loc_name = (const char*)glGetStringi (GL_EXTENSIONS, (GLuint)i);                                // Getting extension name...
+
+    if((loc_name != NULL) && (strcmp (loc_name, loc_extension) == 0))
+    {
+      return true;                                                                                  // Returning extension found...
+    }
+  }
+
+  return false;                                                                                     // Returning extension not found...
+}
+
 nu::shader::shader ()
 {
   neutrino::action ("initializing OpenGL shader object...");                                        // Printing message...
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  program = glCreateProgram ();                                                                     // Creating program...
+  program         = glCreateProgram ();                                                             // Creating program...
+  cache           = true;                                                                           // Enabling program binary cache...
+  camera_block    = GL_INVALID_INDEX;                                                               // Resetting camera uniform block index...
+  stereo_block    = GL_INVALID_INDEX;                                                               // Resetting stereo uniform block index...
+  stereo_single   = false;                                                                          // Resetting single-pass stereo flag...
+  V_mat_location  = -1;                                                                             // Resetting view matrix uniform location...
+  P_mat_location  = -1;                                                                             // Resetting projection matrix uniform location...
+  size_x_location = -1;                                                                             // Resetting framebuffer x-size uniform location...
+  size_y_location = -1;                                                                             // Resetting framebuffer y-size uniform location...
+  AR_location     = -1;                                                                             // Resetting framebuffer aspect ratio uniform location...
+  line_ebo        = 0;                                                                              // Resetting line element buffer...
+  line_size       = 0;                                                                              // Resetting line element buffer size...
+  triangle_ebo    = 0;                                                                              // Resetting triangle element buffer...
+  triangle_size   = 0;                                                                              // Resetting triangle element buffer size...
+  cull_data       = NULL;                                                                           // Resetting culling node positions...
+  cull_lod        = 0.0f;                                                                           // Resetting culling LOD distance...
+  cull_ebo        = 0;                                                                              // Resetting culling index buffer...
+  cull_command    = 0;                                                                              // Resetting culling command buffer...
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
@@ -19,23 +83,31 @@ void nu::shader::addsource
  std::string     loc_shader_filename,                                                               // GLSL shader file name.
  nu::shader_type loc_shader_type                                                                    // GLSL shader type.
 )
+{
+  source_text.push_back (neutrino::read_file (loc_shader_filename));                                // Loading shader source...
+  source_type.push_back (loc_shader_type);                                                          // Storing shader type...
+  source_key += std::to_string ((int)loc_shader_type) + "\n";                                       // Adding shader type to cache key...
+  source_key += source_text.back () + "\n";                                                         // Adding shader source to cache key...
+}
+
+GLuint nu::shader::compile
+(
+ std::string     loc_shader_source,                                                                 // GLSL shader source.
+ nu::shader_type loc_shader_type                                                                    // GLSL shader type.
+)
 {
   GLuint      loc_shader;                                                                           // Shader.
-  std::string loc_shader_source;                                                                    // Shader source.
   GLchar**    loc_shader_source_c;                                                                  // Shader source, C style string.
   GLint*      loc_shader_source_c_size;                                                             // Shader source size.
   GLint       loc_success;                                                                          // "GL_COMPILE_STATUS" flag.
   GLchar*     loc_log;                                                                              // Buffer for OpenGL error log.
   GLsizei     loc_log_size;                                                                         // Size of OpenGL error log.
 
-  neutrino::action ("loading OpenGL shader source from file...");                                   // Printing message...
+  neutrino::action ("creating OpenGL shader object...");                                            // Printing message...
 
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
 
-  // Loading shader from file:
-  loc_shader_source           = neutrino::read_file (
-                                                     loc_shader_filename                            // Shader file.
-                                                    );
+  // Building shader source buffer:
   loc_shader_source_c         = new char*[1]();                                                     // Building temporary shader source char buffer...
   loc_shader_source_c[0]      = new char[loc_shader_source.size ()]();                              // Building temporary source char buffer...
   loc_shader_source.copy (loc_shader_source_c[0], loc_shader_source.size ());                       // Building string source buffer...
@@ -101,10 +173,239 @@ void nu::shader::addsource
 
   neutrino::done ();                                                                                // Printing message...
 
-  neutrino::action ("attaching OpenGL shader to OpenGL program...");                                // Printing message...
-  glAttachShader (program, loc_shader);                                                             // Attaching shader to program...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  neutrino::done ();                                                                                // Printing message...
+  return loc_shader;                                                                                // Returning shader...
+}
+
+std::filesystem::path nu::shader::cache_directory ()
+{
+  std::error_code       loc_error;                                                                  // File system error code.
+  std::filesystem::path loc_base;                                                                   // Per-user cache directory.
+  std::filesystem::path loc_directory;                                                              // Program binary cache directory.
+  std::filesystem::path loc_level;                                                                  // Directory level.
+  const char*           loc_env;                                                                    // Environment variable.
+
+  #if defined(__linux__) || defined(__APPLE__)
+    struct stat         loc_status;                                                                 // Directory status.
+  #endif
+
+  #ifdef WIN32
+    loc_env = getenv ("LOCALAPPDATA");                                                              // Getting local application data directory...
+
+    if((loc_env != NULL) && (loc_env[0] != '\0'))
+    {
+      loc_base = loc_env;                                                                           // Setting per-user cache directory...
+    }
+  #else
+    loc_env = getenv ("XDG_CACHE_HOME");                                                            // Getting XDG cache directory...
+
+    if((loc_env != NULL) && (loc_env[0] == '/'))
+    {
+      loc_base = loc_env;                                                                           // Setting per-user cache directory...
+    }
+    else
+    {
+      loc_env = getenv ("HOME");                                                                    // Getting home directory...
+
+      if((loc_env != NULL) && (loc_env[0] == '/'))
+      {
+        loc_base = std::filesystem::path (loc_env) / ".cache";                                      // Setting per-user cache directory...
+      }
+    }
+  #endif
+
+  if(loc_base.empty ())
+  {
+    return std::filesystem::path ();                                                                // Cache disabled...
+  }
+
+  std::filesystem::create_directories (loc_base, loc_error);                                        // Creating per-user cache directory...
+  loc_directory = loc_base / NU_SHADER_CACHE;                                                       // Setting program binary cache directory...
+  loc_level     = loc_base;                                                                         // Starting from per-user cache directory...
+
+  // Creating the program binary cache directories, owner-only (0700):
+  for(const std::filesystem::path& loc_name : std::filesystem::path (NU_SHADER_CACHE))
+  {
+    loc_level /= loc_name;                                                                          // Descending one level...
+
+    if(std::filesystem::create_directory (loc_level, loc_error))
+    {
+      std::filesystem::permissions (
+                                    loc_level,
+                                    std::filesystem::perms::owner_all,
+                                    std::filesystem::perm_options::replace,
+                                    loc_error
+                                   );                                                               // Setting owner-only permissions...
+    }
+  }
+
+  // Checking that the directory is private (owned by the current user, no group/other access):
+  #if defined(__linux__) || defined(__APPLE__)
+    if((lstat (loc_directory.c_str (), &loc_status) != 0) ||
+       !S_ISDIR (loc_status.st_mode) ||
+       (loc_status.st_uid != getuid ()) ||
+       ((loc_status.st_mode & 077) != 0))
+    {
+      return std::filesystem::path ();                                                              // Cache disabled...
+    }
+  #else
+    if(!std::filesystem::is_directory (loc_directory, loc_error))
+    {
+      return std::filesystem::path ();                                                              // Cache disabled...
+    }
+  #endif
+
+  return loc_directory;                                                                             // Returning cache directory...
+}
+
+std::string nu::shader::cache_file ()
+{
+  std::string loc_key;                                                                              // Cache key.
+  std::string loc_renderer;                                                                         // OpenGL renderer.
+  std::string loc_version;                                                                          // OpenGL version.
+  char        loc_name[32];                                                                         // Cache file name.
+  std::filesystem::path
+              loc_directory;                                                                        // Cache directory.
+
+  loc_directory = cache_directory ();                                                               // Getting cache directory...
+
+  if(loc_directory.empty ())
+  {
+    return "";                                                                                      // Cache disabled...
+  }
+
+  loc_renderer = (const char*)glGetString (GL_RENDERER);                                            // Getting OpenGL renderer...
+  loc_version  = (const char*)glGetString (GL_VERSION);                                             // Getting OpenGL version...
+  loc_key      = loc_renderer + "\n" + loc_version + "\n" + source_key;                             // Building cache key...
+  snprintf (loc_name, 32, "%016llx.bin", (unsigned long long)nu_shader_hash (loc_key));             // Building cache file name...
+
+  return (loc_directory / loc_name).string ();                                                      // Returning cache file name...
+}
+
+bool nu::shader::cache_load ()
+{
+  std::error_code   loc_error;                                                                      // File system error code.
+  std::ifstream     loc_file;                                                                       // Cache file.
+  std::string       loc_file_name;                                                                  // Cache file name.
+  std::vector<char> loc_binary;                                                                     // Program binary.
+  GLint             loc_formats;                                                                    // Number of program binary formats.
+  GLenum            loc_format;                                                                     // Program binary format.
+  uint64_t          loc_size;                                                                       // Program binary size.
+  GLint             loc_success;                                                                    // "GL_LINK_STATUS" flag.
+
+  glGetIntegerv (GL_NUM_PROGRAM_BINARY_FORMATS, &loc_formats);                                      // Getting number of program binary formats...
+
+  if(loc_formats == 0)
+  {
+    return false;                                                                                   // Program binaries not supported...
+  }
+
+  loc_file_name = cache_file ();                                                                    // Getting cache file name...
+
+  if(loc_file_name.empty ())
+  {
+    return false;                                                                                   // Cache disabled...
+  }
+
+  loc_file.open (loc_file_name, std::ios::in | std::ios::binary);                                   // Opening cache file...
+
+  if(!loc_file.is_open ())
+  {
+    return false;                                                                                   // Cache miss...
+  }
+
+  loc_file.read ((char*)&loc_format, sizeof(loc_format));                                           // Reading program binary format...
+  loc_file.read ((char*)&loc_size, sizeof(loc_size));                                               // Reading program binary size...
+
+  if(!loc_file.good () || (loc_size == 0) || (loc_size > (uint64_t)INT32_MAX))
+  {
+    std::filesystem::remove (loc_file_name, loc_error);                                             // Removing corrupted cache file...
+    return false;                                                                                   // Corrupted cache file...
+  }
+
+  loc_binary.resize ((size_t)loc_size);                                                             // Allocating program binary...
+  loc_file.read (loc_binary.data (), (std::streamsize)loc_size);                                    // Reading program binary...
+
+  if(!loc_file.good ())
+  {
+    std::filesystem::remove (loc_file_name, loc_error);                                             // Removing corrupted cache file...
+    return false;                                                                                   // Corrupted cache file...
+  }
+
+  glProgramBinary (program, loc_format, loc_binary.data (), (GLsizei)loc_size);                     // Loading program binary...
+  glGetProgramiv (program, GL_LINK_STATUS, &loc_success);                                           // Reading "GL_LINK_STATUS" flag...
+
+  if(!loc_success)
+  {
+    std::filesystem::remove (loc_file_name, loc_error);                                             // Removing stale cache file...
+    return false;                                                                                   // Binary rejected by the driver...
+  }
+
+  return true;                                                                                      // Cache hit...
+}
+
+void nu::shader::cache_save ()
+{
+  std::ofstream     loc_file;                                                                       // Cache file.
+  std::string       loc_file_name;                                                                  // Cache file name.
+  std::string       loc_temp_name;                                                                  // Temporary cache file name.
+  std::error_code   loc_error;                                                                      // Rename error code.
+  std::vector<char> loc_binary;                                                                     // Program binary.
+  GLint             loc_length;                                                                     // Program binary length.
+  GLenum            loc_format;                                                                     // Program binary format.
+  uint64_t          loc_size;                                                                       // Program binary size.
+
+  glGetProgramiv (program, GL_PROGRAM_BINARY_LENGTH, &loc_length);                                  // Getting program binary length...
+
+  if(loc_length <= 0)
+  {
+    return;                                                                                         // Program binary not available...
+  }
+
+  loc_binary.resize ((size_t)loc_length);                                                           // Allocating program binary...
+  glGetProgramBinary (program, loc_length, &loc_length, &loc_format, loc_binary.data ());           // Getting program binary...
+  loc_size      = (uint64_t)loc_length;                                                             // Setting program binary size...
+
+  loc_file_name = cache_file ();                                                                    // Getting cache file name...
+
+  if(loc_file_name.empty ())
+  {
+    return;                                                                                         // Cache disabled...
+  }
+
+  // Building temporary file name (one per process: concurrent starts never share it):
+  #ifdef WIN32
+    loc_temp_name = loc_file_name + "." + std::to_string (GetCurrentProcessId ()) + ".tmp";
+  #endif
+
+  #if defined(__linux__) || defined(__APPLE__)
+    loc_temp_name = loc_file_name + "." + std::to_string (getpid ()) + ".tmp";
+  #endif
+
+  loc_file.open (loc_temp_name, std::ios::out | std::ios::binary | std::ios::trunc);                // Opening temporary file...
+
+  if(!loc_file.is_open ())
+  {
+    return;                                                                                         // Cache not writable: not an error...
+  }
+
+  loc_file.write ((const char*)&loc_format, sizeof(loc_format));                                    // Writing program binary format...
+  loc_file.write ((const char*)&loc_size, sizeof(loc_size));                                        // Writing program binary size...
+  loc_file.write (loc_binary.data (), (std::streamsize)loc_size);                                   // Writing program binary...
+  loc_file.close ();                                                                                // Closing temporary file...
+
+  if(!loc_file)
+  {
+    std::filesystem::remove (loc_temp_name, loc_error);                                             // Removing partial file...
+    return;                                                                                         // Cache not written: not an error...
+  }
+
+  // Replacing cache file (atomic: a reader never sees a partial binary):
+  std::filesystem::rename (loc_temp_name, loc_file_name, loc_error);                                // Renaming temporary file...
+
+  if(loc_error)
+  {
+    std::filesystem::remove (loc_temp_name, loc_error);                                             // Removing temporary file...
+  }
 }
 
 void nu::shader::build (
@@ -112,12 +413,42 @@ void nu::shader::build (
                        )
 {
   GLuint i;                                                                                         // Index.
+  GLuint loc_shader;                                                                                // Shader.
+  bool   loc_cached;                                                                                // Program binary cache hit flag.
 
-  neutrino::action ("linking OpenGL shader sources...");                                            // Printing message...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  glLinkProgram (program);                                                                          // Linking program...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  neutrino::done ();                                                                                // Printing message...
+  loc_cached = false;                                                                               // Resetting cache hit flag...
+
+  if(cache)
+  {
+    neutrino::action ("loading OpenGL program binary from cache...");                               // Printing message...
+    loc_cached = cache_load ();                                                                     // Loading program binary from cache...
+    neutrino::done ();                                                                              // Printing message...
+  }
+
+  if(!loc_cached)
+  {
+    for(i = 0; i < source_text.size (); i++)
+    {
+      loc_shader = compile (source_text[i], source_type[i]);                                        // Compiling shader...
+      neutrino::action ("attaching OpenGL shader to OpenGL program...");                            // Printing message...
+      glAttachShader (program, loc_shader);                                                         // Attaching shader to program...
+      glDeleteShader (loc_shader);                                                                  // Flagging shader for deletion (owned by program)...
+      neutrino::done ();                                                                            // Printing message...
+    }
+
+    neutrino::action ("linking OpenGL shader sources...");                                          // Printing message...
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    glProgramParameteri (program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);                     // Enabling program binary retrieval...
+    glLinkProgram (program);                                                                        // Linking program...
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(cache)
+    {
+      cache_save ();                                                                                // Saving program binary into cache...
+    }
+
+    neutrino::done ();                                                                              // Printing message...
+  }
 
   size = (GLsizei)loc_points;                                                                       // Setting shader size...
 
@@ -176,6 +507,383 @@ void nu::shader::build (
   }
 
   neutrino::done ();                                                                                // Printing message...
+
+  // Caching camera uniforms:
+  neutrino::action ("caching OpenGL camera uniforms...");                                           // Printing message...
+  camera_block    = glGetUniformBlockIndex (program, NU_CAMERA_BLOCK);                              // Getting camera uniform block index...
+
+  if(camera_block != GL_INVALID_INDEX)
+  {
+    glUniformBlockBinding (program, camera_block, NU_CAMERA_BINDING);                               // Binding camera uniform block...
+  }
+
+  stereo_block    = glGetUniformBlockIndex (program, NU_STEREO_BLOCK);                              // Getting stereo uniform block index...
+
+  stereo_single   = false;                                                                          // Resetting single-pass stereo flag...
+
+  if(stereo_block != GL_INVALID_INDEX)
+  {
+    glUniformBlockBinding (program, stereo_block, NU_STEREO_BINDING);                               // Binding stereo uniform block...
+
+    for(i = 0; i < source_type.size (); i++)
+    {
+      if(source_type[i] == nu::GEOMETRY)
+      {
+        stereo_single = true;                                                                       // Setting single-pass stereo flag...
+      }
+    }
+
+    if(extension (NU_VIEWPORT_LAYER) || extension (NU_VIEWPORT_INDEX))
+    {
+      stereo_single = true;                                                                         // Setting single-pass stereo flag...
+    }
+  }
+
+  V_mat_location  = glGetUniformLocation (program, "V_mat");                                        // Getting view matrix uniform location...
+  P_mat_location  = glGetUniformLocation (program, "P_mat");                                        // Getting projection matrix uniform location...
+  size_x_location = glGetUniformLocation (program, "size_x");                                       // Getting framebuffer x-size uniform location...
+  size_y_location = glGetUniformLocation (program, "size_y");                                       // Getting framebuffer y-size uniform location...
+  AR_location     = glGetUniformLocation (program, "AR");                                           // Getting framebuffer aspect ratio uniform location...
+
+  neutrino::done ();                                                                                // Printing message...
+
+  if((stereo_block != GL_INVALID_INDEX) && !stereo_single)
+  {
+    neutrino::warning ("no gl_ViewportIndex support: stereo shader drawn in two passes.");          // Printing message...
+  }
+}
+
+void nu::shader::topology
+(
+ GLint          loc_element_type,                                                                   // GMSH element type.
+ size_t         loc_element_nodes,                                                                  // Number of element nodes.
+ const GLint**  loc_edge,                                                                           // Edge table.
+ size_t*        loc_edges,                                                                          // Number of edges.
+ const GLint**  loc_face,                                                                           // Face table.
+ size_t*        loc_faces,                                                                          // Number of faces.
+ bool*          loc_volume                                                                          // Volume element flag.
+)
+{
+  // Edge tables (node pairs, GMSH first order node ordering):
+  static const GLint loc_line_edge[]     = {0, 1};
+  static const GLint loc_triangle_edge[] = {0, 1, 1, 2, 2, 0};
+  static const GLint loc_quad_edge[]     = {0, 1, 1, 2, 2, 3, 3, 0};
+  static const GLint loc_tet_edge[]      = {0, 1, 1, 2, 2, 0, 0, 3, 1, 3, 2, 3};
+  static const GLint loc_hex_edge[]      = {0, 1, 1, 2, 2, 3, 3, 0, 4, 5, 5, 6,
+                                            6, 7, 7, 4, 0, 4, 1, 5, 2, 6, 3, 7};
+  static const GLint loc_prism_edge[]    = {0, 1, 1, 2, 2, 0, 3, 4, 4, 5, 5, 3, 0, 3, 1, 4, 2, 5};
+  static const GLint loc_pyramid_edge[]  = {0, 1, 1, 2, 2, 3, 3, 0, 0, 4, 1, 4, 2, 4, 3, 4};
+
+  // Face tables (node quadruples, -1 = triangle, outward normals):
+  static const GLint loc_triangle_face[] = {0, 1, 2, -1};
+  static const GLint loc_quad_face[]     = {0, 1, 2, 3};
+  static const GLint loc_tet_face[]      = {0, 2, 1, -1, 0, 1, 3, -1, 0, 3, 2, -1, 1, 2, 3, -1};
+  static const GLint loc_hex_face[]      = {0, 3, 2, 1, 4, 5, 6, 7, 0, 1, 5, 4,
+                                            1, 2, 6, 5, 2, 3, 7, 6, 3, 0, 4, 7};
+  static const GLint loc_prism_face[]    = {0, 2, 1, -1, 3, 4, 5, -1, 0, 1, 4, 3,
+                                            1, 2, 5, 4, 2, 0, 3, 5};
+  static const GLint loc_pyramid_face[]  = {0, 3, 2, 1, 0, 1, 4, -1, 1, 2, 4, -1,
+                                            2, 3, 4, -1, 3, 0, 4, -1};
+  size_t             loc_nodes;                                                                     // Number of GMSH element nodes.
+
+  switch(loc_element_type)
+  {
+    case 1:  loc_nodes = 2; break;                                                                  // GMSH 2-node line.
+    case 2:  loc_nodes = 3; break;                                                                  // GMSH 3-node triangle.
+    case 3:  loc_nodes = 4; break;                                                                  // GMSH 4-node quadrangle.
+    case 4:  loc_nodes = 4; break;                                                                  // GMSH 4-node tetrahedron.
+    case 5:  loc_nodes = 8; break;                                                                  // GMSH 8-node hexahedron.
+    case 6:  loc_nodes = 6; break;                                                                  // GMSH 6-node prism.
+    case 7:  loc_nodes = 5; break;                                                                  // GMSH 5-node pyramid.
+    case 15: loc_nodes = 1; break;                                                                  // GMSH 1-node point.
+    default: loc_nodes = 0; break;                                                                  // Unknown or unsupported element type.
+  }
+
+  // Guessing element type from the number of element nodes (unknown type, or incremental element
+  // of a different type added to a request):
+  if(loc_nodes != loc_element_nodes)
+  {
+    switch(loc_element_nodes)
+    {
+      case 1:  loc_element_type = 15; break;                                                        // GMSH 1-node point.
+      case 2:  loc_element_type = 1;  break;                                                        // GMSH 2-node line.
+      case 3:  loc_element_type = 2;  break;                                                        // GMSH 3-node triangle.
+      case 4:  loc_element_type = 3;  break;                                                        // GMSH 4-node quadrangle.
+      case 5:  loc_element_type = 7;  break;                                                        // GMSH 5-node pyramid.
+      case 6:  loc_element_type = 6;  break;                                                        // GMSH 6-node prism.
+      case 8:  loc_element_type = 5;  break;                                                        // GMSH 8-node hexahedron.
+      default: loc_element_type = 0;  break;                                                        // Unsupported: no edges, no faces.
+    }
+  }
+
+  *loc_edge   = NULL;                                                                               // Resetting edge table...
+  *loc_edges  = 0;                                                                                  // Resetting number of edges...
+  *loc_face   = NULL;                                                                               // Resetting face table...
+  *loc_faces  = 0;                                                                                  // Resetting number of faces...
+  *loc_volume = false;                                                                              // Resetting volume element flag...
+
+  switch(loc_element_type)
+  {
+    case 1:
+      *loc_edge   = loc_line_edge;                                                                  // Setting edge table...
+      *loc_edges  = 1;                                                                              // Setting number of edges...
+      break;
+
+    case 2:
+      *loc_edge   = loc_triangle_edge;                                                              // Setting edge table...
+      *loc_edges  = 3;                                                                              // Setting number of edges...
+      *loc_face   = loc_triangle_face;                                                              // Setting face table...
+      *loc_faces  = 1;                                                                              // Setting number of faces...
+      break;
+
+    case 3:
+      *loc_edge   = loc_quad_edge;                                                                  // Setting edge table...
+      *loc_edges  = 4;                                                                              // Setting number of edges...
+      *loc_face   = loc_quad_face;                                                                  // Setting face table...
+      *loc_faces  = 1;                                                                              // Setting number of faces...
+      break;
+
+    case 4:
+      *loc_edge   = loc_tet_edge;                                                                   // Setting edge table...
+      *loc_edges  = 6;                                                                              // Setting number of edges...
+      *loc_face   = loc_tet_face;                                                                   // Setting face table...
+      *loc_faces  = 4;                                                                              // Setting number of faces...
+      *loc_volume = true;                                                                           // Setting volume element flag...
+      break;
+
+    case 5:
+      *loc_edge   = loc_hex_edge;                                                                   // Setting edge table...
+      *loc_edges  = 12;                                                                             // Setting number of edges...
+      *loc_face   = loc_hex_face;                                                                   // Setting face table...
+      *loc_faces  = 6;                                                                              // Setting number of faces...
+      *loc_volume = true;                                                                           // Setting volume element flag...
+      break;
+
+    case 6:
+      *loc_edge   = loc_prism_edge;                                                                 // Setting edge table...
+      *loc_edges  = 9;                                                                              // Setting number of edges...
+      *loc_face   = loc_prism_face;                                                                 // Setting face table...
+      *loc_faces  = 5;                                                                              // Setting number of faces...
+      *loc_volume = true;                                                                           // Setting volume element flag...
+      break;
+
+    case 7:
+      *loc_edge   = loc_pyramid_edge;                                                               // Setting edge table...
+      *loc_edges  = 8;                                                                              // Setting number of edges...
+      *loc_face   = loc_pyramid_face;                                                               // Setting face table...
+      *loc_faces  = 5;                                                                              // Setting number of faces...
+      *loc_volume = true;                                                                           // Setting volume element flag...
+      break;
+  }
+}
+
+void nu::shader::setelement
+(
+ nu::mesh* loc_mesh                                                                                 // Mesh.
+)
+{
+  std::vector<std::pair<GLuint, GLuint> > loc_edge;                                                 // Element edges.
+  std::vector<std::array<GLuint, 9> >    loc_face;                                                  // Element faces: key (sorted nodes), volume flag, nodes.
+  std::vector<GLuint>                    loc_line;                                                  // Line indices.
+  std::vector<GLuint>                    loc_triangle;                                              // Triangle indices.
+  std::array<GLuint, 9>                  loc_record;                                                // Face record.
+  const GLint*                           loc_edge_table;                                            // Element edge table.
+  const GLint*                           loc_face_table;                                            // Element face table.
+  size_t                                 loc_edges;                                                 // Number of element edges.
+  size_t                                 loc_faces;                                                 // Number of element faces.
+  bool                                   loc_volume;                                                // Volume element flag.
+  bool                                   loc_surface;                                               // Surface element face flag (group).
+  size_t                                 loc_volumes;                                               // Number of volume element faces (group).
+  size_t                                 loc_begin;                                                 // Element begin offset.
+  size_t                                 loc_end;                                                   // Element end offset.
+  GLint                                  loc_element_type;                                          // GMSH element type.
+  GLuint                                 loc_a;                                                     // Edge first node.
+  GLuint                                 loc_b;                                                     // Edge second node.
+  size_t                                 r;                                                         // Request index.
+  size_t                                 i;                                                         // Element index.
+  size_t                                 j;                                                         // Edge (face) index.
+  size_t                                 k;                                                         // Face node index.
+  size_t                                 g;                                                         // Face group end.
+
+  neutrino::action ("setting OpenGL element buffers...");                                           // Printing message...
+
+  loc_begin = 0;                                                                                    // Resetting element begin offset...
+  r         = 0;                                                                                    // Resetting request index...
+
+  for(i = 0; i < loc_mesh->element_offset.size (); i++)
+  {
+    // Finding request of "i" element:
+    while((r < loc_mesh->request_element_offset.size ()) &&
+          ((size_t)loc_mesh->request_element_offset[r] <= i))
+    {
+      r++;
+    }
+
+    loc_element_type = (r < loc_mesh->request_element_type.size ()) ?
+                       loc_mesh->request_element_type[r] : 0;
+    loc_end          = (size_t)loc_mesh->element_offset[i];                                         // Setting element end offset...
+    topology (
+              loc_element_type,
+              loc_end - loc_begin,
+              &loc_edge_table,
+              &loc_edges,
+              &loc_face_table,
+              &loc_faces,
+              &loc_volume
+             );                                                                                     // Getting element topology...
+
+    for(j = 0; j < loc_edges; j++)
+    {
+      loc_a = (GLuint)loc_mesh->element[loc_begin + loc_edge_table[2*j + 0]];                       // Setting edge first node...
+      loc_b = (GLuint)loc_mesh->element[loc_begin + loc_edge_table[2*j + 1]];                       // Setting edge second node...
+      loc_edge.push_back (std::make_pair (std::min (loc_a, loc_b), std::max (loc_a, loc_b)));       // Adding edge...
+    }
+
+    for(j = 0; j < loc_faces; j++)
+    {
+      for(k = 0; k < 4; k++)
+      {
+        loc_record[5 + k] = (loc_face_table[4*j + k] < 0) ? (GLuint)-1 :
+                            (GLuint)loc_mesh->element[loc_begin + loc_face_table[4*j + k]];         // Setting face node...
+        loc_record[k]     = loc_record[5 + k];                                                      // Setting face key node...
+      }
+
+      std::sort (loc_record.begin (), loc_record.begin () + 4);                                     // Sorting face key...
+      loc_record[4] = loc_volume ? 1 : 0;                                                           // Setting volume flag...
+      loc_face.push_back (loc_record);                                                              // Adding face...
+    }
+
+    loc_begin = loc_end;                                                                            // Setting next element begin offset...
+  }
+
+  // Deduplicating edges shared by adjacent elements (each edge stored once):
+  std::sort (loc_edge.begin (), loc_edge.end ());                                                   // Sorting edges...
+  loc_edge.erase (std::unique (loc_edge.begin (), loc_edge.end ()), loc_edge.end ());               // Erasing duplicate edges...
+
+  for(i = 0; i < loc_edge.size (); i++)
+  {
+    loc_line.push_back (loc_edge[i].first);                                                         // Adding line first node...
+    loc_line.push_back (loc_edge[i].second);                                                        // Adding line second node...
+  }
+
+  // Keeping surface faces (a face shared by two volume elements is interior, unless it is also
+  // the face of a surface element), each face stored once:
+  std::sort (loc_face.begin (), loc_face.end ());                                                   // Sorting faces (surface first)...
+
+  for(i = 0; i < loc_face.size (); i = g)
+  {
+    loc_surface = (loc_face[i][4] == 0);                                                            // Checking surface element face...
+    loc_volumes = 0;                                                                                // Resetting number of volume faces...
+
+    g           = i;                                                                                // Resetting face group end...
+
+    while((g < loc_face.size ()) &&
+          std::equal (loc_face[i].begin (), loc_face[i].begin () + 4, loc_face[g].begin ()))
+    {
+      loc_volumes += loc_face[g][4];                                                                // Counting volume faces...
+      g++;                                                                                          // Advancing face group end...
+    }
+
+    if(loc_surface || (loc_volumes == 1))
+    {
+      loc_triangle.push_back (loc_face[i][5]);                                                      // Adding triangle first node...
+      loc_triangle.push_back (loc_face[i][6]);                                                      // Adding triangle second node...
+      loc_triangle.push_back (loc_face[i][7]);                                                      // Adding triangle third node...
+
+      if(loc_face[i][8] != (GLuint)-1)
+      {
+        loc_triangle.push_back (loc_face[i][5]);                                                    // Adding triangle first node...
+        loc_triangle.push_back (loc_face[i][7]);                                                    // Adding triangle second node...
+        loc_triangle.push_back (loc_face[i][8]);                                                    // Adding triangle third node...
+      }
+    }
+  }
+
+  if(line_ebo == 0)
+  {
+    glGenBuffers (1, &line_ebo);                                                                    // Generating line element buffer...
+  }
+
+  if(triangle_ebo == 0)
+  {
+    glGenBuffers (1, &triangle_ebo);                                                                // Generating triangle element buffer...
+  }
+
+  // Uploading element buffers (through the generic array target, not to alter the bound VAO):
+  glBindBuffer (GL_ARRAY_BUFFER, line_ebo);                                                         // Binding line element buffer...
+  glBufferData (
+                GL_ARRAY_BUFFER,                                                                    // Buffer target.
+                sizeof(GLuint)*loc_line.size (),                                                    // Buffer size.
+                loc_line.data (),                                                                   // Buffer data.
+                GL_STATIC_DRAW                                                                      // Buffer usage.
+               );
+  glBindBuffer (GL_ARRAY_BUFFER, triangle_ebo);                                                     // Binding triangle element buffer...
+  glBufferData (
+                GL_ARRAY_BUFFER,                                                                    // Buffer target.
+                sizeof(GLuint)*loc_triangle.size (),                                                // Buffer size.
+                loc_triangle.data (),                                                               // Buffer data.
+                GL_STATIC_DRAW                                                                      // Buffer usage.
+               );
+  glBindBuffer (GL_ARRAY_BUFFER, 0);                                                                // Unbinding element buffer...
+
+  line_size     = (GLsizei)loc_line.size ();                                                        // Setting line element buffer size...
+  triangle_size = (GLsizei)loc_triangle.size ();                                                    // Setting triangle element buffer size...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::shader::setcull
+(
+ nu::float4* loc_position,                                                                          // Node positions.
+ GLfloat     loc_lod_distance                                                                       // LOD distance (0.0 = LOD off).
+)
+{
+  GLuint loc_command[5] = {0, 1, 0, 0, 0};                                                          // Indirect draw command.
+
+  neutrino::action ("setting OpenGL culling buffers...");                                           // Printing message...
+
+  if(!loc_position->ready)
+  {
+    neutrino::error ("culling positions have no OpenGL buffer: set kernel arguments first!");       // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_position->data.size () < (size_t)size)
+  {
+    neutrino::error ("culling positions are less than the shader points!");                         // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  cull_data = loc_position;                                                                         // Setting culling node positions...
+  cull_lod  = loc_lod_distance;                                                                     // Setting culling LOD distance...
+
+  if(cull_ebo == 0)
+  {
+    glGenBuffers (1, &cull_ebo);                                                                    // Generating culling index buffer...
+  }
+
+  if(cull_command == 0)
+  {
+    glGenBuffers (1, &cull_command);                                                                // Generating culling command buffer...
+  }
+
+  glBindBuffer (GL_ARRAY_BUFFER, cull_ebo);                                                         // Binding culling index buffer...
+  glBufferData (
+                GL_ARRAY_BUFFER,                                                                    // Buffer target.
+                sizeof(GLuint)*(size_t)size,                                                        // Buffer size.
+                NULL,                                                                               // Buffer data.
+                GL_DYNAMIC_COPY                                                                     // Buffer usage.
+               );
+  glBindBuffer (GL_ARRAY_BUFFER, cull_command);                                                     // Binding culling command buffer...
+  glBufferData (
+                GL_ARRAY_BUFFER,                                                                    // Buffer target.
+                sizeof(loc_command),                                                                // Buffer size.
+                loc_command,                                                                        // Buffer data.
+                GL_DYNAMIC_COPY                                                                     // Buffer usage.
+               );
+  glBindBuffer (GL_ARRAY_BUFFER, 0);                                                                // Unbinding buffer...
+
+  neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -426,5 +1134,23 @@ void nu::shader::setarg
 
 nu::shader::~shader ()
 {
-  // Doing nothing.
+  if(line_ebo != 0)
+  {
+    glDeleteBuffers (1, &line_ebo);                                                                 // Deleting line element buffer...
+  }
+
+  if(triangle_ebo != 0)
+  {
+    glDeleteBuffers (1, &triangle_ebo);                                                             // Deleting triangle element buffer...
+  }
+
+  if(cull_ebo != 0)
+  {
+    glDeleteBuffers (1, &cull_ebo);                                                                 // Deleting culling index buffer...
+  }
+
+  if(cull_command != 0)
+  {
+    glDeleteBuffers (1, &cull_command);                                                             // Deleting culling command buffer...
+  }
 }
@@ -0,0 +1,578 @@
+/// @file     snapshot.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "snapshot" class (asynchronous state snapshots).
+
+#include "snapshot.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "snapshot" class //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::snapshot::snapshot (
+                        std::string loc_prefix,                                                     // File name prefix (path included).
+                        size_t      loc_period                                                      // Snapshot period [steps].
+                       )
+{
+  neutrino::action ("initializing snapshot...");                                                    // Printing message...
+
+  prefix  = loc_prefix;                                                                             // Initializing file name prefix...
+  period  = std::max (loc_period, (size_t)1);                                                       // Initializing snapshot period...
+  bytes   = 0;                                                                                      // Initializing staging buffer size...
+  head    = 0;                                                                                      // Initializing staging ring head...
+  stop    = false;                                                                                  // Initializing writer stop flag...
+  failure = "";                                                                                     // Initializing writer failure...
+  written = 0;                                                                                      // Initializing number of snapshots written...
+  writer  = std::thread (&nu::snapshot::write, this);                                               // Starting writer thread...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::snapshot::locate (
+                           nu::data*    loc_data,                                                   // Data object.
+                           cl_mem*      loc_buffer,                                                 // OpenCL buffer.
+                           size_t*      loc_size,                                                   // Object size [bytes].
+                           std::string* loc_name,                                                   // Object name.
+                           GLuint*      loc_layout,                                                 // Object layout index.
+                           bool*        loc_ready                                                   // Object buffer "ready" flag.
+                          )
+{
+  switch(loc_data->type)
+  {
+    case NU_INT:
+      *loc_buffer = ((nu::int1*)loc_data)->buffer;
+      *loc_size   = sizeof (GLint)*((nu::int1*)loc_data)->data.size ();
+      *loc_name   = ((nu::int1*)loc_data)->name;
+      *loc_layout = ((nu::int1*)loc_data)->layout;
+      *loc_ready  = ((nu::int1*)loc_data)->ready;
+      break;
+
+    case NU_INT2:
+      *loc_buffer = ((nu::int2*)loc_data)->buffer;
+      *loc_size   = sizeof (nu_int2_structure)*((nu::int2*)loc_data)->data.size ();
+      *loc_name   = ((nu::int2*)loc_data)->name;
+      *loc_layout = ((nu::int2*)loc_data)->layout;
+      *loc_ready  = ((nu::int2*)loc_data)->ready;
+      break;
+
+    case NU_INT3:
+      *loc_buffer = ((nu::int3*)loc_data)->buffer;
+      *loc_size   = sizeof (nu_int3_structure)*((nu::int3*)loc_data)->data.size ();
+      *loc_name   = ((nu::int3*)loc_data)->name;
+      *loc_layout = ((nu::int3*)loc_data)->layout;
+      *loc_ready  = ((nu::int3*)loc_data)->ready;
+      break;
+
+    case NU_INT4:
+      *loc_buffer = ((nu::int4*)loc_data)->buffer;
+      *loc_size   = sizeof (nu_int4_structure)*((nu::int4*)loc_data)->data.size ();
+      *loc_name   = ((nu::int4*)loc_data)->name;
+      *loc_layout = ((nu::int4*)loc_data)->layout;
+      *loc_ready  = ((nu::int4*)loc_data)->ready;
+      break;
+
+    case NU_FLOAT:
+      *loc_buffer = ((nu::float1*)loc_data)->buffer;
+      *loc_size   = sizeof (GLfloat)*((nu::float1*)loc_data)->data.size ();
+      *loc_name   = ((nu::float1*)loc_data)->name;
+      *loc_layout = ((nu::float1*)loc_data)->layout;
+      *loc_ready  = ((nu::float1*)loc_data)->ready;
+      break;
+
+    case NU_FLOAT2:
+      *loc_buffer = ((nu::float2*)loc_data)->buffer;
+      *loc_size   = sizeof (nu_float2_structure)*((nu::float2*)loc_data)->data.size ();
+      *loc_name   = ((nu::float2*)loc_data)->name;
+      *loc_layout = ((nu::float2*)loc_data)->layout;
+      *loc_ready  = ((nu::float2*)loc_data)->ready;
+      break;
+
+    case NU_FLOAT3:
+      *loc_buffer = ((nu::float3*)loc_data)->buffer;
+      *loc_size   = sizeof (nu_float3_structure)*((nu::float3*)loc_data)->data.size ();
+      *loc_name   = ((nu::float3*)loc_data)->name;
+      *loc_layout = ((nu::float3*)loc_data)->layout;
+      *loc_ready  = ((nu::float3*)loc_data)->ready;
+      break;
+
+    case NU_FLOAT4:
+      *loc_buffer = ((nu::float4*)loc_data)->buffer;
+      *loc_size   = sizeof (nu_float4_structure)*((nu::float4*)loc_data)->data.size ();
+      *loc_name   = ((nu::float4*)loc_data)->name;
+      *loc_layout = ((nu::float4*)loc_data)->layout;
+      *loc_ready  = ((nu::float4*)loc_data)->ready;
+      break;
+
+    case NU_FLOAT16:
+      *loc_buffer = ((nu::float16*)loc_data)->buffer;
+      *loc_size   = sizeof (nu_float16_structure)*((nu::float16*)loc_data)->data.size ();
+      *loc_name   = ((nu::float16*)loc_data)->name;
+      *loc_layout = ((nu::float16*)loc_data)->layout;
+      *loc_ready  = ((nu::float16*)loc_data)->ready;
+      break;
+  }
+}
+
+void nu::snapshot::interop (
+                            nu::data* loc_data,                                                     // Data object.
+                            bool      loc_acquire                                                   // Acquire flag (false = release).
+                           )
+{
+  cl_mem      loc_buffer;                                                                           // OpenCL buffer.
+  size_t      loc_size;                                                                             // Object size [bytes].
+  std::string loc_name;                                                                             // Object name.
+  GLuint      loc_layout;                                                                           // Object layout index.
+  bool        loc_ready;                                                                            // Object buffer "ready" flag.
+
+  locate (loc_data, &loc_buffer, &loc_size, &loc_name, &loc_layout, &loc_ready);                    // Getting layout index...
+
+  switch(loc_data->type)
+  {
+    case NU_INT:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::int1*)loc_data, loc_layout);                        // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::int1*)loc_data, loc_layout);                        // Releasing...
+      }
+      break;
+
+    case NU_INT2:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::int2*)loc_data, loc_layout);                        // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::int2*)loc_data, loc_layout);                        // Releasing...
+      }
+      break;
+
+    case NU_INT3:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::int3*)loc_data, loc_layout);                        // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::int3*)loc_data, loc_layout);                        // Releasing...
+      }
+      break;
+
+    case NU_INT4:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::int4*)loc_data, loc_layout);                        // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::int4*)loc_data, loc_layout);                        // Releasing...
+      }
+      break;
+
+    case NU_FLOAT:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::float1*)loc_data, loc_layout);                      // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::float1*)loc_data, loc_layout);                      // Releasing...
+      }
+      break;
+
+    case NU_FLOAT2:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::float2*)loc_data, loc_layout);                      // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::float2*)loc_data, loc_layout);                      // Releasing...
+      }
+      break;
+
+    case NU_FLOAT3:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::float3*)loc_data, loc_layout);                      // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::float3*)loc_data, loc_layout);                      // Releasing...
+      }
+      break;
+
+    case NU_FLOAT4:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::float4*)loc_data, loc_layout);                      // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::float4*)loc_data, loc_layout);                      // Releasing...
+      }
+      break;
+
+    case NU_FLOAT16:
+      if(loc_acquire)
+      {
+        nu::opencl::opencl_queue->acquire ((nu::float16*)loc_data, loc_layout);                     // Acquiring...
+      }
+      else
+      {
+        nu::opencl::opencl_queue->release ((nu::float16*)loc_data, loc_layout);                     // Releasing...
+      }
+      break;
+  }
+}
+
+void nu::snapshot::allocate ()
+{
+  cl_int      loc_error;                                                                            // Error code.
+  cl_mem      loc_buffer;                                                                           // OpenCL buffer.
+  std::string loc_name;                                                                             // Object name.
+  GLuint      loc_layout;                                                                           // Object layout index.
+  bool        loc_ready;                                                                            // Object buffer "ready" flag.
+  size_t      i;                                                                                    // Object index.
+  size_t      s;                                                                                    // Staging ring slot.
+
+  neutrino::action ("allocating snapshot staging ring...");                                         // Printing message...
+
+  offset.resize (object.size ());                                                                   // Allocating object offsets...
+  size.resize (object.size ());                                                                     // Allocating object sizes...
+  bytes = 0;                                                                                        // Resetting staging buffer size...
+
+  for(i = 0; i < object.size (); i++)
+  {
+    locate (object[i], &loc_buffer, &size[i], &loc_name, &loc_layout, &loc_ready);                  // Getting object size...
+
+    if(!loc_ready)
+    {
+      neutrino::error ("snapshot object not initialized (see kernel::setarg)!");                    // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    offset[i] = bytes;                                                                              // Setting object offset...
+    bytes    += (size[i] + 7)/8*8;                                                                  // Advancing staging buffer size (8 bytes aligned)...
+  }
+
+  staging.resize (NU_SNAPSHOT_RING);                                                                // Allocating staging buffers...
+  staging_map.resize (NU_SNAPSHOT_RING);                                                            // Allocating mapped staging buffers...
+  event.resize (NU_SNAPSHOT_RING, NULL);                                                            // Allocating read events...
+  staging_step.resize (NU_SNAPSHOT_RING, 0);                                                        // Allocating staging steps...
+  busy.resize (NU_SNAPSHOT_RING, false);                                                            // Allocating busy flags...
+
+  for(s = 0; s < NU_SNAPSHOT_RING; s++)
+  {
+    // Creating pinned staging buffer (host memory allocated by OpenCL):
+    staging[s]     = clCreateBuffer (
+                                     neutrino::context_id,
+                                     CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR,
+                                     std::max (bytes, (size_t)8),
+                                     NULL,
+                                     &loc_error
+                                    );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+
+    // Mapping pinned staging buffer (kept mapped):
+    staging_map[s] = (char*)clEnqueueMapBuffer (
+                                                neutrino::queue_id,
+                                                staging[s],
+                                                CL_TRUE,
+                                                CL_MAP_READ | CL_MAP_WRITE,
+                                                0,
+                                                std::max (bytes, (size_t)8),
+                                                0,
+                                                NULL,
+                                                NULL,
+                                                &loc_error
+                                               );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::snapshot::add (
+                        nu::data* loc_data                                                          // Data object.
+                       )
+{
+  if(!staging.empty ())
+  {
+    neutrino::error ("snapshot objects must be added before the first snapshot!");                  // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  object.push_back (loc_data);                                                                      // Adding data object...
+}
+
+bool nu::snapshot::take (
+                         size_t loc_step                                                            // Simulation step.
+                        )
+{
+  nu::zone    loc_zone ("snapshot");                                                                // Profiling zone...
+  cl_int      loc_error;                                                                            // Error code.
+  cl_mem      loc_buffer;                                                                           // OpenCL buffer.
+  std::string loc_name;                                                                             // Object name.
+  size_t      loc_size;                                                                             // Object size [bytes].
+  GLuint      loc_layout;                                                                           // Object layout index.
+  bool        loc_ready;                                                                            // Object buffer "ready" flag.
+  size_t      loc_slot;                                                                             // Staging ring slot.
+  size_t      i;                                                                                    // Object index.
+
+  if((loc_step%period != 0) || object.empty ())
+  {
+    return false;                                                                                   // No snapshot at this step...
+  }
+
+  check ();                                                                                         // Checking writer failure...
+
+  if(staging.empty ())
+  {
+    allocate ();                                                                                    // Allocating staging ring...
+  }
+
+  loc_slot = head;                                                                                  // Getting staging ring slot...
+  head     = (head + 1)%staging.size ();                                                            // Advancing staging ring head...
+
+  // Waiting for staging buffer (only if the writer is too late, or until it fails):
+  {
+    std::unique_lock<std::mutex> loc_lock (queue_lock);
+    queue_signal.wait (
+                       loc_lock,
+                       [this, loc_slot] {return !failure.empty () || !busy[loc_slot];}
+                      );                                                                            // Waiting for staging buffer...
+  }
+
+  check ();                                                                                         // Checking writer failure...
+
+  // Acquiring all objects (the OpenGL fence is waited for once, by the first acquire):
+  for(i = 0; i < object.size (); i++)
+  {
+    interop (object[i], true);                                                                      // Acquiring object...
+  }
+
+  // Enqueueing non-blocking reads (in-order queue: the last read event marks the whole snapshot):
+  for(i = 0; i < object.size (); i++)
+  {
+    locate (object[i], &loc_buffer, &loc_size, &loc_name, &loc_layout, &loc_ready);                 // Getting OpenCL buffer...
+    loc_error = clEnqueueReadBuffer (
+                                     neutrino::queue_id,
+                                     loc_buffer,
+                                     CL_FALSE,
+                                     0,
+                                     size[i],
+                                     staging_map[loc_slot] + offset[i],
+                                     0,
+                                     NULL,
+                                     (i == object.size () - 1) ? &event[loc_slot] : NULL
+                                    );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  clFlush (neutrino::queue_id);                                                                     // Submitting reads...
+
+  // Releasing all objects (without cl_khr_gl_event, the first release waits for the reads):
+  for(i = 0; i < object.size (); i++)
+  {
+    interop (object[i], false);                                                                     // Releasing object...
+  }
+
+  // Pushing staging buffer to writer queue (dropping it if the writer failed):
+  {
+    std::lock_guard<std::mutex> loc_lock (queue_lock);
+
+    if(failure.empty ())
+    {
+      staging_step[loc_slot] = loc_step;                                                            // Setting staging buffer step...
+      busy[loc_slot]         = true;                                                                // Setting staging buffer busy...
+      queue.push_back (loc_slot);                                                                   // Pushing staging buffer...
+    }
+    else
+    {
+      clReleaseEvent (event[loc_slot]);                                                             // Releasing read event...
+      event[loc_slot] = NULL;                                                                       // Resetting read event...
+    }
+  }
+
+  queue_signal.notify_all ();                                                                       // Signaling writer...
+
+  return true;                                                                                      // Snapshot enqueued...
+}
+
+void nu::snapshot::write ()
+{
+  size_t      loc_slot;                                                                             // Staging ring slot.
+  std::string loc_number;                                                                           // Step number string.
+  bool        loc_written;                                                                          // File written flag.
+
+  while(true)
+  {
+    // Popping staging buffer from writer queue:
+    std::unique_lock<std::mutex> loc_lock (queue_lock);
+    queue_signal.wait (loc_lock, [this] {return stop || !queue.empty ();});                         // Waiting for snapshots...
+
+    if(queue.empty ())
+    {
+      break;                                                                                        // Stopping writer...
+    }
+
+    loc_slot = queue.front ();                                                                      // Popping staging buffer...
+    queue.pop_front ();
+    loc_lock.unlock ();                                                                             // Unlocking writer queue...
+
+    clWaitForEvents (1, &event[loc_slot]);                                                          // Waiting for reads...
+    clReleaseEvent (event[loc_slot]);                                                               // Releasing read event...
+    event[loc_slot] = NULL;                                                                         // Resetting read event...
+
+    loc_written = save (loc_slot);                                                                  // Writing snapshot file...
+
+    // Recording failure for the caller thread (no exit from the writer thread):
+    if(!loc_written)
+    {
+      loc_number = std::to_string (staging_step[loc_slot]);                                         // Building step number...
+      loc_number = std::string (loc_number.size () < 6 ? 6 - loc_number.size () : 0, '0') +
+                   loc_number;
+
+      loc_lock.lock ();                                                                             // Locking writer queue...
+      failure = prefix + "_" + loc_number + ".nus";                                                 // Setting writer failure...
+
+      while(!queue.empty ())
+      {
+        clReleaseEvent (event[queue.front ()]);                                                     // Releasing read event...
+        event[queue.front ()] = NULL;                                                               // Resetting read event...
+        queue.pop_front ();                                                                         // Dropping pending snapshot...
+      }
+
+      std::fill (busy.begin (), busy.end (), false);                                                // Freeing staging buffers...
+      loc_lock.unlock ();                                                                           // Unlocking writer queue...
+      queue_signal.notify_all ();                                                                   // Signaling caller...
+      break;                                                                                        // Stopping writer...
+    }
+
+    written++;                                                                                      // Counting snapshot...
+
+    loc_lock.lock ();                                                                               // Locking writer queue...
+    busy[loc_slot]  = false;                                                                        // Freeing staging buffer...
+    loc_lock.unlock ();                                                                             // Unlocking writer queue...
+    queue_signal.notify_all ();                                                                     // Signaling staging buffer room...
+  }
+}
+
+bool nu::snapshot::save (
+                         size_t loc_slot                                                            // Staging ring slot.
+                        )
+{
+  const char    loc_zero[8] = {0};                                                                  // Padding bytes.
+  std::ofstream loc_file;                                                                           // Snapshot file.
+  std::string   loc_number;                                                                         // Step number string.
+  cl_mem        loc_buffer;                                                                         // OpenCL buffer.
+  size_t        loc_size;                                                                           // Object size [bytes].
+  std::string   loc_name;                                                                           // Object name.
+  GLuint        loc_layout;                                                                         // Object layout index.
+  bool          loc_ready;                                                                          // Object buffer "ready" flag.
+  uint32_t      loc_word[4];                                                                        // Header words.
+  uint64_t      loc_long[2];                                                                        // Header long words.
+  size_t        i;                                                                                  // Object index.
+
+  loc_number = std::to_string (staging_step[loc_slot]);                                             // Building step number...
+  loc_number = std::string (loc_number.size () < 6 ? 6 - loc_number.size () : 0, '0') + loc_number;
+  loc_file.open (prefix + "_" + loc_number + ".nus", std::ios::binary | std::ios::trunc);           // Opening snapshot file...
+
+  if(!loc_file)
+  {
+    return false;                                                                                   // Returning failure...
+  }
+
+  // Writing header (32 bytes, no metadata):
+  loc_word[0] = NU_SNAPSHOT_FORMAT;                                                                 // Setting format version...
+  loc_word[1] = (uint32_t)object.size ();                                                           // Setting number of objects...
+  loc_long[0] = (uint64_t)staging_step[loc_slot];                                                   // Setting step...
+  loc_long[1] = 0;                                                                                  // Setting metadata size...
+  loc_file.write (NU_SNAPSHOT_MAGIC, 8);                                                            // Writing magic...
+  loc_file.write ((const char*)loc_word, 2*sizeof (uint32_t));                                      // Writing format and number of objects...
+  loc_file.write ((const char*)loc_long, 2*sizeof (uint64_t));                                      // Writing step and metadata size...
+
+  for(i = 0; i < object.size (); i++)
+  {
+    locate (object[i], &loc_buffer, &loc_size, &loc_name, &loc_layout, &loc_ready);                 // Getting object name and layout...
+    loc_word[0] = (uint32_t)object[i]->type;                                                        // Setting object type...
+    loc_word[1] = (uint32_t)loc_layout;                                                             // Setting object layout index...
+    loc_long[0] = (uint64_t)size[i];                                                                // Setting object size...
+    loc_word[2] = (uint32_t)loc_name.size ();                                                       // Setting object name size...
+    loc_word[3] = 0;                                                                                // Setting reserved word...
+    loc_file.write ((const char*)loc_word, 2*sizeof (uint32_t));                                    // Writing type and layout...
+    loc_file.write ((const char*)loc_long, sizeof (uint64_t));                                      // Writing object size...
+    loc_file.write ((const char*)&loc_word[2], 2*sizeof (uint32_t));                                // Writing name size...
+    loc_file.write (loc_name.data (), (std::streamsize)loc_name.size ());                           // Writing object name...
+    loc_file.write (loc_zero, (std::streamsize)((8 - loc_name.size ()%8)%8));                       // Padding object header...
+    loc_file.write (staging_map[loc_slot] + offset[i], (std::streamsize)size[i]);                   // Writing object data (from pinned memory)...
+    loc_file.write (loc_zero, (std::streamsize)((8 - size[i]%8)%8));                                // Padding object data...
+  }
+
+  loc_file.close ();                                                                                // Closing snapshot file...
+
+  return !loc_file.fail ();                                                                         // Returning success...
+}
+
+void nu::snapshot::flush ()
+{
+  // Waiting for writer (no staging buffer busy, or writer failure):
+  {
+    std::unique_lock<std::mutex> loc_lock (queue_lock);
+    queue_signal.wait (
+                       loc_lock,
+                       [this]
+                       {
+                         return !failure.empty () ||
+                                (std::find (busy.begin (), busy.end (), true) == busy.end ());
+                       }
+                      );
+  }
+
+  check ();                                                                                         // Checking writer failure...
+}
+
+void nu::snapshot::check ()
+{
+  std::string loc_failure;                                                                          // Writer failure.
+
+  {
+    std::lock_guard<std::mutex> loc_lock (queue_lock);
+    loc_failure = failure;                                                                          // Getting writer failure...
+  }
+
+  if(!loc_failure.empty ())
+  {
+    neutrino::error ("unable to write snapshot file " + loc_failure + "!");                         // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+nu::snapshot::~snapshot ()
+{
+  size_t s;                                                                                         // Staging ring slot.
+
+  // Stopping writer thread:
+  {
+    std::lock_guard<std::mutex> loc_lock (queue_lock);
+    stop = true;                                                                                    // Setting writer stop flag...
+  }
+
+  queue_signal.notify_all ();                                                                       // Signaling writer...
+  writer.join ();                                                                                   // Waiting for writer to write all snapshots...
+
+  if(!failure.empty ())
+  {
+    neutrino::error ("unable to write snapshot file " + failure + "!");                             // Printing message...
+  }
+
+  for(s = 0; s < staging.size (); s++)
+  {
+    clEnqueueUnmapMemObject (neutrino::queue_id, staging[s], staging_map[s], 0, NULL, NULL);        // Unmapping staging buffer...
+    clFinish (neutrino::queue_id);                                                                  // Waiting for unmap...
+    clReleaseMemObject (staging[s]);                                                                // Releasing staging buffer...
+  }
+}
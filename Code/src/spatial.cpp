@@ -0,0 +1,988 @@
+/// @file     spatial.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "spatial" class (spatial index over mesh nodes).
+
+#include "spatial.hpp"
+#include "opencl.hpp"
+
+// OpenCL source of the device build program (uniform grid counting sort). The cell offsets are
+// computed by a parallel inclusive scan: each work-group scans its block of cells in local memory
+// ("scan"), a single work-group scans the block sums ("scan_block") and each block is shifted by
+// the sum of the previous blocks ("scan_add"):
+static const char* nu_spatial_source =
+  "__kernel void nu_spatial_count (\n"
+  "                                __global float4* node,\n"
+  "                                __global int*    node_cell,\n"
+  "                                __global int*    count,\n"
+  "                                __global int*    rank,\n"
+  "                                float4           origin,\n"
+  "                                float            cell_size,\n"
+  "                                int4             cells,\n"
+  "                                int              nodes\n"
+  "                               )\n"
+  "{\n"
+  "  int i = get_global_id (0);\n"
+  "  int x;\n"
+  "  int y;\n"
+  "  int z;\n"
+  "  int c;\n"
+  "\n"
+  "  if(i >= nodes) return;\n"
+  "\n"
+  "  x            = clamp ((int)floor ((node[i].x - origin.x)/cell_size), 0, cells.x - 1);\n"
+  "  y            = clamp ((int)floor ((node[i].y - origin.y)/cell_size), 0, cells.y - 1);\n"
+  "  z            = clamp ((int)floor ((node[i].z - origin.z)/cell_size), 0, cells.z - 1);\n"
+  "  c            = x + cells.x*(y + cells.y*z);\n"
+  "  node_cell[i] = c;\n"
+  "  rank[i]      = atomic_inc (&count[c]);\n"
+  "}\n"
+  "\n"
+  "__kernel void nu_spatial_scan (\n"
+  "                               __global int* count,\n"
+  "                               __global int* cell_offset,\n"
+  "                               __global int* block_sum,\n"
+  "                               __local  int* temp,\n"
+  "                               int           cells\n"
+  "                              )\n"
+  "{\n"
+  "  int i = get_global_id (0);\n"
+  "  int l = get_local_id (0);\n"
+  "  int n = get_local_size (0);\n"
+  "  int d;\n"
+  "  int s;\n"
+  "\n"
+  "  temp[l] = (i < cells) ? count[i] : 0;\n"
+  "  barrier (CLK_LOCAL_MEM_FENCE);\n"
+  "\n"
+  "  for(d = 1; d < n; d *= 2)\n"
+  "  {\n"
+  "    s        = (l >= d) ? temp[l - d] : 0;\n"
+  "    barrier (CLK_LOCAL_MEM_FENCE);\n"
+  "    temp[l] += s;\n"
+  "    barrier (CLK_LOCAL_MEM_FENCE);\n"
+  "  }\n"
+  "\n"
+  "  if(i < cells) cell_offset[i] = temp[l];\n"
+  "  if(l == n - 1) block_sum[get_group_id (0)] = temp[l];\n"
+  "}\n"
+  "\n"
+  "__kernel void nu_spatial_scan_block (\n"
+  "                                     __global int* block_sum,\n"
+  "                                     __local  int* temp,\n"
+  "                                     int           blocks\n"
+  "                                    )\n"
+  "{\n"
+  "  int l     = get_local_id (0);\n"
+  "  int n     = get_local_size (0);\n"
+  "  int carry = 0;\n"
+  "  int b;\n"
+  "  int d;\n"
+  "  int s;\n"
+  "\n"
+  "  for(b = 0; b < blocks; b += n)\n"
+  "  {\n"
+  "    temp[l] = (b + l < blocks) ? block_sum[b + l] : 0;\n"
+  "    barrier (CLK_LOCAL_MEM_FENCE);\n"
+  "\n"
+  "    for(d = 1; d < n; d *= 2)\n"
+  "    {\n"
+  "      s        = (l >= d) ? temp[l - d] : 0;\n"
+  "      barrier (CLK_LOCAL_MEM_FENCE);\n"
+  "      temp[l] += s;\n"
+  "      barrier (CLK_LOCAL_MEM_FENCE);\n"
+  "    }\n"
+  "\n"
+  "    if(b + l < blocks) block_sum[b + l] = temp[l] + carry;\n"
+  "    carry += temp[n - 1];\n"
+  "    barrier (CLK_LOCAL_MEM_FENCE);\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "__kernel void nu_spatial_scan_add (\n"
+  "                                   __global int* cell_offset,\n"
+  "                                   __global int* block_sum,\n"
+  "                                   int           cells\n"
+  "                                  )\n"
+  "{\n"
+  "  int i = get_global_id (0);\n"
+  "  int g = get_group_id (0);\n"
+  "\n"
+  "  if((i < cells) && (g > 0)) cell_offset[i] += block_sum[g - 1];\n"
+  "}\n"
+  "\n"
+  "__kernel void nu_spatial_scatter (\n"
+  "                                  __global int* node_cell,\n"
+  "                                  __global int* rank,\n"
+  "                                  __global int* cell_offset,\n"
+  "                                  __global int* cell_node,\n"
+  "                                  int           nodes\n"
+  "                                 )\n"
+  "{\n"
+  "  int i = get_global_id (0);\n"
+  "  int c;\n"
+  "\n"
+  "  if(i >= nodes) return;\n"
+  "\n"
+  "  c                                                    = node_cell[i];\n"
+  "  cell_node[((c == 0) ? 0 : cell_offset[c - 1]) + rank[i]] = i;\n"
+  "}\n";
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "spatial" class //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::spatial::spatial ()
+{
+  mode              = GRID;                                                                         // Initializing spatial index mode...
+  program           = NULL;                                                                         // Initializing device build program...
+  count_kernel      = NULL;                                                                         // Initializing device build "count" kernel...
+  scan_kernel       = NULL;                                                                         // Initializing device build "scan" kernel...
+  scan_block_kernel = NULL;                                                                         // Initializing device build "scan_block" kernel...
+  scan_add_kernel   = NULL;                                                                         // Initializing device build "scan_add" kernel...
+  scatter_kernel    = NULL;                                                                         // Initializing device build "scatter" kernel...
+  count_buffer      = NULL;                                                                         // Initializing device build count buffer...
+  rank_buffer       = NULL;                                                                         // Initializing device build rank buffer...
+  block_buffer      = NULL;                                                                         // Initializing device build block sum buffer...
+  count_size        = 0;                                                                            // Initializing device build count buffer size...
+  rank_size         = 0;                                                                            // Initializing device build rank buffer size...
+  block_size        = 0;                                                                            // Initializing device build block sum buffer size...
+  scan_group        = 1;                                                                            // Initializing device build scan work-group size...
+  origin            = {0.0f, 0.0f, 0.0f, 1.0f};                                                     // Initializing grid origin...
+  cell_size         = 1.0f;                                                                         // Initializing grid cell size...
+  cells_x           = 1;                                                                            // Initializing number of cells along "x"...
+  cells_y           = 1;                                                                            // Initializing number of cells along "y"...
+  cells_z           = 1;                                                                            // Initializing number of cells along "z"...
+}
+
+void nu::spatial::domain (
+                          nu_float4_structure loc_min,                                              // Bounding box minimum corner.
+                          nu_float4_structure loc_max,                                              // Bounding box maximum corner.
+                          GLfloat             loc_cell_size                                         // Cell size.
+                         )
+{
+  if(!(loc_cell_size > 0.0f))
+  {
+    neutrino::error ("spatial index cell size must be positive!");                                  // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  origin    = loc_min;                                                                              // Setting grid origin...
+  cell_size = loc_cell_size;                                                                        // Setting grid cell size...
+  cells_x   = std::max (1, (GLint)ceil ((loc_max.x - loc_min.x)/loc_cell_size));                    // Setting number of cells along "x"...
+  cells_y   = std::max (1, (GLint)ceil ((loc_max.y - loc_min.y)/loc_cell_size));                    // Setting number of cells along "y"...
+  cells_z   = std::max (1, (GLint)ceil ((loc_max.z - loc_min.z)/loc_cell_size));                    // Setting number of cells along "z"...
+
+  if((double)cells_x*(double)cells_y*(double)cells_z > NU_SPATIAL_MAX_CELLS)
+  {
+    neutrino::error ("too many spatial index cells: increase cell size!");                          // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+size_t nu::spatial::cells ()
+{
+  return (size_t)cells_x*(size_t)cells_y*(size_t)cells_z;                                           // Returning number of cells...
+}
+
+GLint nu::spatial::cell (
+                         nu_float4_structure loc_point                                              // Point.
+                        )
+{
+  GLint i;                                                                                          // Cell "x" index.
+  GLint j;                                                                                          // Cell "y" index.
+  GLint k;                                                                                          // Cell "z" index.
+
+  i = std::min (std::max ((GLint)floor ((loc_point.x - origin.x)/cell_size), 0), cells_x - 1);      // Computing cell "x" index...
+  j = std::min (std::max ((GLint)floor ((loc_point.y - origin.y)/cell_size), 0), cells_y - 1);      // Computing cell "y" index...
+  k = std::min (std::max ((GLint)floor ((loc_point.z - origin.z)/cell_size), 0), cells_z - 1);      // Computing cell "z" index...
+
+  return i + cells_x*(j + cells_y*k);                                                               // Returning cell index...
+}
+
+void nu::spatial::build (
+                         std::vector<nu_float4_structure>& loc_node,                                // Node coordinates.
+                         GLfloat                           loc_cell_size,                           // Cell size.
+                         spatial_mode                      loc_mode                                 // Spatial index mode.
+                        )
+{
+  nu_float4_structure loc_min;                                                                      // Bounding box minimum corner.
+  nu_float4_structure loc_max;                                                                      // Bounding box maximum corner.
+  std::vector<GLint>  loc_cursor;                                                                   // Cell fill cursor.
+  GLfloat             loc_half;                                                                     // Octree root half size.
+  size_t              loc_nodes;                                                                    // Number of nodes.
+  size_t              i;                                                                            // Node index.
+  size_t              c;                                                                            // Cell index.
+
+  neutrino::action ("building spatial index...");                                                   // Printing message...
+
+  mode      = loc_mode;                                                                             // Setting spatial index mode...
+  loc_nodes = loc_node.size ();                                                                     // Getting number of nodes...
+  loc_min   = {0.0f, 0.0f, 0.0f, 1.0f};                                                             // Resetting bounding box...
+  loc_max   = {0.0f, 0.0f, 0.0f, 1.0f};                                                             // Resetting bounding box...
+
+  // Computing bounding box:
+  for(i = 0; i < loc_nodes; i++)
+  {
+    if(i == 0)
+    {
+      loc_min = loc_node[i];                                                                        // Initializing minimum corner...
+      loc_max = loc_node[i];                                                                        // Initializing maximum corner...
+    }
+
+    loc_min.x = std::min (loc_min.x, loc_node[i].x);                                                // Updating minimum "x"...
+    loc_min.y = std::min (loc_min.y, loc_node[i].y);                                                // Updating minimum "y"...
+    loc_min.z = std::min (loc_min.z, loc_node[i].z);                                                // Updating minimum "z"...
+    loc_max.x = std::max (loc_max.x, loc_node[i].x);                                                // Updating maximum "x"...
+    loc_max.y = std::max (loc_max.y, loc_node[i].y);                                                // Updating maximum "y"...
+    loc_max.z = std::max (loc_max.z, loc_node[i].z);                                                // Updating maximum "z"...
+  }
+
+  domain (loc_min, loc_max, loc_cell_size);                                                         // Setting grid domain...
+
+  cell_offset.clear ();                                                                             // Clearing cell offsets...
+  octree_box.clear ();                                                                              // Clearing octree boxes...
+  octree_child.clear ();                                                                            // Clearing octree children...
+  octree_range.clear ();                                                                            // Clearing octree ranges...
+  node_cell.assign (loc_nodes, 0);                                                                  // Allocating node cells...
+  cell_node.resize (loc_nodes);                                                                     // Allocating cell nodes...
+
+  switch(mode)
+  {
+    case GRID:
+      cell_offset.assign (cells (), 0);                                                             // Allocating cell offsets...
+
+      // Counting nodes in each cell:
+      for(i = 0; i < loc_nodes; i++)
+      {
+        node_cell[i] = cell (loc_node[i]);                                                          // Setting node cell...
+        cell_offset[node_cell[i]]++;                                                                // Counting cell node...
+      }
+
+      // Computing cumulative cell offsets:
+      for(c = 1; c < cell_offset.size (); c++)
+      {
+        cell_offset[c] += cell_offset[c - 1];                                                       // Accumulating cell offset...
+      }
+
+      // Sorting nodes by cell (stable):
+      loc_cursor.assign (cell_offset.size (), 0);                                                   // Allocating cell fill cursors...
+
+      for(c = 1; c < cell_offset.size (); c++)
+      {
+        loc_cursor[c] = cell_offset[c - 1];                                                         // Setting cell fill cursor...
+      }
+
+      for(i = 0; i < loc_nodes; i++)
+      {
+        cell_node[loc_cursor[node_cell[i]]++] = (GLint)i;                                           // Adding node to its cell...
+      }
+
+      break;
+
+    case OCTREE:
+      // Using node-indexed coordinates during the octree build:
+      cell_coordinates = loc_node;                                                                  // Copying node coordinates...
+
+      for(i = 0; i < loc_nodes; i++)
+      {
+        cell_node[i] = (GLint)i;                                                                    // Initializing node order...
+      }
+
+      loc_half = 0.5f*std::max (
+                                std::max (loc_max.x - loc_min.x, loc_max.y - loc_min.y),
+                                loc_max.z - loc_min.z
+                               );                                                                   // Computing root half size...
+      loc_half = std::max (loc_half, 0.5f*loc_cell_size);                                           // Ensuring non-empty root...
+
+      // Setting octree root:
+      octree_box.push_back (
+      {
+        0.5f*(loc_min.x + loc_max.x),                                                               // Setting root center "x"...
+        0.5f*(loc_min.y + loc_max.y),                                                               // Setting root center "y"...
+        0.5f*(loc_min.z + loc_max.z),                                                               // Setting root center "z"...
+        loc_half                                                                                    // Setting root half size...
+      }
+                           );
+      octree_child.push_back (-1);                                                                  // Setting root as leaf...
+      octree_range.push_back ({0, (GLint)loc_nodes});                                               // Setting root range...
+      octree_split (0, 0);                                                                          // Splitting octree...
+      break;
+  }
+
+  // Sorting node coordinates by cell:
+  cell_coordinates.resize (loc_nodes);                                                              // Allocating sorted coordinates...
+
+  for(i = 0; i < loc_nodes; i++)
+  {
+    cell_coordinates[i] = loc_node[cell_node[i]];                                                   // Setting sorted coordinates...
+  }
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::spatial::octree_split (
+                                size_t loc_octree_node,                                             // Octree node index.
+                                size_t loc_depth                                                    // Octree node depth.
+                               )
+{
+  nu_float4_structure loc_box;                                                                      // Octree node box.
+  nu_int2_structure   loc_range;                                                                    // Octree node range.
+  std::vector<GLint>  loc_sorted;                                                                   // Nodes sorted by octant.
+  GLint               loc_start[9];                                                                 // Octant start offsets.
+  GLint               loc_octant;                                                                   // Octant index.
+  size_t              loc_first;                                                                    // First child index.
+  GLfloat             loc_quarter;                                                                  // Child half size.
+  GLint               k;                                                                            // Node index.
+  GLint               o;                                                                            // Octant index.
+
+  loc_box   = octree_box[loc_octree_node];                                                          // Getting octree node box...
+  loc_range = octree_range[loc_octree_node];                                                        // Getting octree node range...
+
+  // Checking leaf conditions:
+  if(((loc_range.y - loc_range.x) <= NU_SPATIAL_LEAF_SIZE) ||
+     (loc_depth >= NU_SPATIAL_MAX_DEPTH) ||
+     (loc_box.w <= 0.5f*cell_size))
+  {
+    for(k = loc_range.x; k < loc_range.y; k++)
+    {
+      node_cell[cell_node[k]] = (GLint)loc_octree_node;                                             // Setting node leaf...
+    }
+
+    return;
+  }
+
+  // Counting nodes in each octant:
+  std::fill (loc_start, loc_start + 9, 0);
+
+  for(k = loc_range.x; k < loc_range.y; k++)
+  {
+    loc_octant = (cell_coordinates[cell_node[k]].x > loc_box.x) |
+                 ((cell_coordinates[cell_node[k]].y > loc_box.y) << 1) |
+                 ((cell_coordinates[cell_node[k]].z > loc_box.z) << 2);                             // Computing node octant...
+    loc_start[loc_octant + 1]++;                                                                    // Counting octant node...
+  }
+
+  for(o = 1; o < 9; o++)
+  {
+    loc_start[o] += loc_start[o - 1];                                                               // Accumulating octant offsets...
+  }
+
+  // Sorting nodes by octant:
+  loc_sorted.resize (loc_range.y - loc_range.x);                                                    // Allocating sorted nodes...
+
+  for(k = loc_range.x; k < loc_range.y; k++)
+  {
+    loc_octant = (cell_coordinates[cell_node[k]].x > loc_box.x) |
+                 ((cell_coordinates[cell_node[k]].y > loc_box.y) << 1) |
+                 ((cell_coordinates[cell_node[k]].z > loc_box.z) << 2);                             // Computing node octant...
+    loc_sorted[loc_start[loc_octant]++] = cell_node[k];                                             // Adding node to its octant...
+  }
+
+  std::copy (loc_sorted.begin (), loc_sorted.end (), cell_node.begin () + loc_range.x);             // Storing sorted nodes...
+
+  // Adding 8 children:
+  loc_first                     = octree_box.size ();                                               // Getting first child index...
+  loc_quarter                   = 0.5f*loc_box.w;                                                   // Computing child half size...
+  octree_child[loc_octree_node] = (GLint)loc_first;                                                 // Setting first child index...
+
+  for(o = 0; o < 8; o++)
+  {
+    octree_box.push_back (
+    {
+      loc_box.x + ((o & 1) ? loc_quarter : -loc_quarter),                                           // Setting child center "x"...
+      loc_box.y + ((o & 2) ? loc_quarter : -loc_quarter),                                           // Setting child center "y"...
+      loc_box.z + ((o & 4) ? loc_quarter : -loc_quarter),                                           // Setting child center "z"...
+      loc_quarter                                                                                   // Setting child half size...
+    }
+                         );
+    octree_child.push_back (-1);                                                                    // Setting child as leaf...
+    octree_range.push_back (
+    {
+      loc_range.x + ((o == 0) ? 0 : loc_start[o - 1]),                                              // Setting child range begin...
+      loc_range.x + loc_start[o]                                                                    // Setting child range end...
+    }
+                           );
+  }
+
+  // Splitting children:
+  for(o = 0; o < 8; o++)
+  {
+    octree_split (loc_first + o, loc_depth + 1);                                                    // Splitting child...
+  }
+}
+
+void nu::spatial::build (
+                         nu::float4* loc_node,                                                      // Node coordinates.
+                         nu::int1*   loc_cell_offset,                                               // Cell offset indices.
+                         nu::int1*   loc_cell_node,                                                 // Node indices, sorted by cell.
+                         nu::int1*   loc_node_cell                                                  // Cell index of each node.
+                        )
+{
+  cl_int           loc_error;                                                                       // Error code.
+  cl_command_queue loc_queue;                                                                       // OpenCL queue.
+  cl_mem           loc_buffer[4];                                                                   // Data object buffers.
+  cl_event         loc_event;                                                                       // OpenCL event linked to the OpenGL fence.
+  cl_uint          loc_events;                                                                      // Number of events in event list.
+  cl_int           loc_zero;                                                                        // Zero pattern.
+  cl_int           loc_nodes;                                                                       // Number of nodes.
+  cl_int           loc_cells;                                                                       // Number of cells.
+  cl_int           loc_blocks;                                                                      // Number of scan blocks.
+  cl_int           loc_grid[4];                                                                     // Number of cells per direction.
+  cl_float         loc_origin[4];                                                                   // Grid origin.
+  size_t           loc_global;                                                                      // Global work size.
+  size_t           loc_local;                                                                       // Local work size.
+
+  neutrino::action ("building spatial index on device...");                                         // Printing message...
+
+  mode      = GRID;                                                                                 // Device build supports the uniform grid only...
+  loc_nodes = (cl_int)loc_node->data.size ();                                                       // Getting number of nodes...
+  loc_cells = (cl_int)cells ();                                                                     // Getting number of cells...
+
+  // Checking data objects:
+  if(!loc_node->ready || !loc_cell_offset->ready || !loc_cell_node->ready || !loc_node_cell->ready)
+  {
+    neutrino::error ("spatial index data objects have no device buffers: set kernel arguments first!");
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if((loc_cell_offset->data.size () < (size_t)loc_cells) ||
+     (loc_cell_node->data.size () < (size_t)loc_nodes) ||
+     (loc_node_cell->data.size () < (size_t)loc_nodes))
+  {
+    neutrino::error ("spatial index data objects are too small!");                                  // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(nu::opencl::opencl_queue == NULL)
+  {
+    neutrino::error ("OpenCL queue not initialized: initialize OpenCL first!");                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  device_init ();                                                                                   // Building device program...
+
+  loc_queue  = nu::opencl::opencl_queue->queue_id;                                                  // Getting OpenCL queue...
+  loc_local  = scan_group;                                                                          // Setting scan work-group size...
+  loc_blocks = (cl_int)((loc_cells + scan_group - 1)/scan_group);                                   // Setting number of scan blocks...
+
+  // Allocating temporary buffers:
+  if(count_size < (size_t)loc_cells)
+  {
+    if(count_buffer != NULL)
+    {
+      clReleaseMemObject (count_buffer);                                                            // Releasing old count buffer...
+    }
+
+    count_size   = loc_cells;                                                                       // Setting count buffer size...
+    count_buffer = clCreateBuffer (
+                                   neutrino::context_id,                                            // OpenCL context.
+                                   CL_MEM_READ_WRITE,                                               // Memory flag.
+                                   sizeof (cl_int)*count_size,                                      // Data buffer size.
+                                   NULL,                                                            // Data buffer.
+                                   &loc_error                                                       // Error code.
+                                  );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  if(rank_size < (size_t)loc_nodes)
+  {
+    if(rank_buffer != NULL)
+    {
+      clReleaseMemObject (rank_buffer);                                                             // Releasing old rank buffer...
+    }
+
+    rank_size   = loc_nodes;                                                                        // Setting rank buffer size...
+    rank_buffer = clCreateBuffer (
+                                  neutrino::context_id,                                             // OpenCL context.
+                                  CL_MEM_READ_WRITE,                                                // Memory flag.
+                                  sizeof (cl_int)*rank_size,                                        // Data buffer size.
+                                  NULL,                                                             // Data buffer.
+                                  &loc_error                                                        // Error code.
+                                 );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  if(block_size < (size_t)loc_blocks)
+  {
+    if(block_buffer != NULL)
+    {
+      clReleaseMemObject (block_buffer);                                                            // Releasing old block sum buffer...
+    }
+
+    block_size   = loc_blocks;                                                                      // Setting block sum buffer size...
+    block_buffer = clCreateBuffer (
+                                   neutrino::context_id,                                            // OpenCL context.
+                                   CL_MEM_READ_WRITE,                                               // Memory flag.
+                                   sizeof (cl_int)*block_size,                                      // Data buffer size.
+                                   NULL,                                                            // Data buffer.
+                                   &loc_error                                                       // Error code.
+                                  );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  loc_buffer[0] = loc_node->buffer;                                                                 // Setting node buffer...
+  loc_buffer[1] = loc_cell_offset->buffer;                                                          // Setting cell offset buffer...
+  loc_buffer[2] = loc_cell_node->buffer;                                                            // Setting cell node buffer...
+  loc_buffer[3] = loc_node_cell->buffer;                                                            // Setting node cell buffer...
+
+  if(neutrino::interop)
+  {
+    // Acquiring OpenCL buffers (after the OpenGL fence):
+    loc_events = neutrino::wait_gl (&loc_event);                                                    // Waiting for OpenGL fence...
+    loc_error  = clEnqueueAcquireGLObjects (
+                                            loc_queue,                                              // Queue.
+                                            4,                                                      // Number of memory objects.
+                                            loc_buffer,                                             // Memory object array.
+                                            loc_events,                                             // Number of events in event list.
+                                            (loc_events > 0) ? &loc_event : NULL,                   // Event list.
+                                            NULL                                                    // Event.
+                                           );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  // Resetting cell node counts:
+  loc_zero      = 0;                                                                                // Setting zero pattern...
+  loc_error     = clEnqueueFillBuffer (
+                                       loc_queue,                                                   // Queue.
+                                       count_buffer,                                                // Buffer.
+                                       &loc_zero,                                                   // Pattern.
+                                       sizeof (cl_int),                                             // Pattern size.
+                                       0,                                                           // Offset.
+                                       sizeof (cl_int)*loc_cells,                                   // Size.
+                                       0,                                                           // Number of events in event list.
+                                       NULL,                                                        // Event list.
+                                       NULL                                                         // Event.
+                                      );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  loc_origin[0] = origin.x;                                                                         // Setting grid origin "x"...
+  loc_origin[1] = origin.y;                                                                         // Setting grid origin "y"...
+  loc_origin[2] = origin.z;                                                                         // Setting grid origin "z"...
+  loc_origin[3] = 0.0f;                                                                             // Setting grid origin "w"...
+  loc_grid[0]   = cells_x;                                                                          // Setting number of cells along "x"...
+  loc_grid[1]   = cells_y;                                                                          // Setting number of cells along "y"...
+  loc_grid[2]   = cells_z;                                                                          // Setting number of cells along "z"...
+  loc_grid[3]   = 1;                                                                                // Setting unused "w"...
+
+  // Counting nodes in each cell:
+  loc_error     = clSetKernelArg (count_kernel, 0, sizeof (cl_mem), &loc_buffer[0]);
+  loc_error    |= clSetKernelArg (count_kernel, 1, sizeof (cl_mem), &loc_buffer[3]);
+  loc_error    |= clSetKernelArg (count_kernel, 2, sizeof (cl_mem), &count_buffer);
+  loc_error    |= clSetKernelArg (count_kernel, 3, sizeof (cl_mem), &rank_buffer);
+  loc_error    |= clSetKernelArg (count_kernel, 4, sizeof (loc_origin), loc_origin);
+  loc_error    |= clSetKernelArg (count_kernel, 5, sizeof (cl_float), &cell_size);
+  loc_error    |= clSetKernelArg (count_kernel, 6, sizeof (loc_grid), loc_grid);
+  loc_error    |= clSetKernelArg (count_kernel, 7, sizeof (cl_int), &loc_nodes);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_global    = loc_nodes;                                                                        // Setting global work size...
+  loc_error     = clEnqueueNDRangeKernel (loc_queue, count_kernel, 1, NULL, &loc_global, NULL, 0, NULL, NULL);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  // Computing cumulative cell offsets (block scans):
+  loc_error     = clSetKernelArg (scan_kernel, 0, sizeof (cl_mem), &count_buffer);
+  loc_error    |= clSetKernelArg (scan_kernel, 1, sizeof (cl_mem), &loc_buffer[1]);
+  loc_error    |= clSetKernelArg (scan_kernel, 2, sizeof (cl_mem), &block_buffer);
+  loc_error    |= clSetKernelArg (scan_kernel, 3, sizeof (cl_int)*scan_group, NULL);
+  loc_error    |= clSetKernelArg (scan_kernel, 4, sizeof (cl_int), &loc_cells);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_global    = loc_blocks*scan_group;                                                            // Setting global work size...
+  loc_error     = clEnqueueNDRangeKernel (loc_queue, scan_kernel, 1, NULL, &loc_global, &loc_local, 0, NULL, NULL);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  if(loc_blocks > 1)
+  {
+    // Computing cumulative block sums (single work-group):
+    loc_error   = clSetKernelArg (scan_block_kernel, 0, sizeof (cl_mem), &block_buffer);
+    loc_error  |= clSetKernelArg (scan_block_kernel, 1, sizeof (cl_int)*scan_group, NULL);
+    loc_error  |= clSetKernelArg (scan_block_kernel, 2, sizeof (cl_int), &loc_blocks);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+    loc_global  = scan_group;                                                                       // Setting global work size...
+    loc_error   = clEnqueueNDRangeKernel (loc_queue, scan_block_kernel, 1, NULL, &loc_global, &loc_local, 0, NULL, NULL);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+
+    // Adding block offsets:
+    loc_error   = clSetKernelArg (scan_add_kernel, 0, sizeof (cl_mem), &loc_buffer[1]);
+    loc_error  |= clSetKernelArg (scan_add_kernel, 1, sizeof (cl_mem), &block_buffer);
+    loc_error  |= clSetKernelArg (scan_add_kernel, 2, sizeof (cl_int), &loc_cells);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+    loc_global  = loc_blocks*scan_group;                                                            // Setting global work size...
+    loc_error   = clEnqueueNDRangeKernel (loc_queue, scan_add_kernel, 1, NULL, &loc_global, &loc_local, 0, NULL, NULL);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  // Sorting nodes by cell:
+  loc_error     = clSetKernelArg (scatter_kernel, 0, sizeof (cl_mem), &loc_buffer[3]);
+  loc_error    |= clSetKernelArg (scatter_kernel, 1, sizeof (cl_mem), &rank_buffer);
+  loc_error    |= clSetKernelArg (scatter_kernel, 2, sizeof (cl_mem), &loc_buffer[1]);
+  loc_error    |= clSetKernelArg (scatter_kernel, 3, sizeof (cl_mem), &loc_buffer[2]);
+  loc_error    |= clSetKernelArg (scatter_kernel, 4, sizeof (cl_int), &loc_nodes);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_global    = loc_nodes;                                                                        // Setting global work size...
+  loc_error     = clEnqueueNDRangeKernel (loc_queue, scatter_kernel, 1, NULL, &loc_global, NULL, 0, NULL, NULL);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  if(neutrino::interop)
+  {
+    // Releasing OpenCL buffers:
+    loc_error = clEnqueueReleaseGLObjects (loc_queue, 4, loc_buffer, 0, NULL, NULL);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  clFinish (loc_queue);                                                                             // Waiting for OpenCL to finish...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::spatial::device_init ()
+{
+  cl_int loc_error;                                                                                 // Error code.
+  size_t loc_scan_max;                                                                              // Maximum work-group size of the "scan" kernel.
+  size_t loc_block_max;                                                                             // Maximum work-group size of the "scan_block" kernel.
+
+  if(program != NULL)
+  {
+    return;                                                                                         // Device program already built...
+  }
+
+  // Building device program:
+  program           = clCreateProgramWithSource (neutrino::context_id, 1, &nu_spatial_source, NULL, &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_error         = clBuildProgram (program, 1, &neutrino::device_id, "", NULL, NULL);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  // Creating device kernels:
+  count_kernel      = clCreateKernel (program, "nu_spatial_count", &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  scan_kernel       = clCreateKernel (program, "nu_spatial_scan", &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  scan_block_kernel = clCreateKernel (program, "nu_spatial_scan_block", &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  scan_add_kernel   = clCreateKernel (program, "nu_spatial_scan_add", &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  scatter_kernel    = clCreateKernel (program, "nu_spatial_scatter", &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  // Setting scan work-group size (power of 2, within the device limits of the scan kernels):
+  loc_error         = clGetKernelWorkGroupInfo (
+                                                scan_kernel,                                        // Kernel.
+                                                neutrino::device_id,                                // Device.
+                                                CL_KERNEL_WORK_GROUP_SIZE,                          // Parameter.
+                                                sizeof (size_t),                                    // Parameter size.
+                                                &loc_scan_max,                                      // Parameter value.
+                                                NULL                                                // Returned size.
+                                               );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  loc_error         = clGetKernelWorkGroupInfo (
+                                                scan_block_kernel,                                  // Kernel.
+                                                neutrino::device_id,                                // Device.
+                                                CL_KERNEL_WORK_GROUP_SIZE,                          // Parameter.
+                                                sizeof (size_t),                                    // Parameter size.
+                                                &loc_block_max,                                     // Parameter value.
+                                                NULL                                                // Returned size.
+                                               );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+  scan_group        = 1;                                                                            // Initializing scan work-group size...
+
+  while((2*scan_group <= NU_SPATIAL_SCAN_GROUP) && (2*scan_group <= loc_scan_max) &&
+        (2*scan_group <= loc_block_max))
+  {
+    scan_group *= 2;                                                                                // Doubling scan work-group size...
+  }
+}
+
+void nu::spatial::radius (
+                          nu_float4_structure loc_point,                                            // Query point.
+                          GLfloat             loc_radius,                                           // Query radius.
+                          std::vector<GLint>& loc_result                                            // Node indices found.
+                         )
+{
+  GLint   i_min;                                                                                    // Minimum cell "x" index.
+  GLint   j_min;                                                                                    // Minimum cell "y" index.
+  GLint   k_min;                                                                                    // Minimum cell "z" index.
+  GLint   i_max;                                                                                    // Maximum cell "x" index.
+  GLint   j_max;                                                                                    // Maximum cell "y" index.
+  GLint   k_max;                                                                                    // Maximum cell "z" index.
+  GLint   i;                                                                                        // Cell "x" index.
+  GLint   j;                                                                                        // Cell "y" index.
+  GLint   k;                                                                                        // Cell "z" index.
+  GLint   c;                                                                                        // Cell index.
+  GLint   m;                                                                                        // Cell node index.
+  GLfloat loc_dx;                                                                                   // Distance "x" component.
+  GLfloat loc_dy;                                                                                   // Distance "y" component.
+  GLfloat loc_dz;                                                                                   // Distance "z" component.
+
+  loc_result.clear ();                                                                              // Clearing result...
+
+  if(cell_node.empty ())
+  {
+    return;                                                                                         // Empty index...
+  }
+
+  if(mode == OCTREE)
+  {
+    octree_radius (0, loc_point, loc_radius, loc_result);                                           // Querying octree...
+    return;
+  }
+
+  // Computing cell range:
+  i_min = std::max ((GLint)floor ((loc_point.x - loc_radius - origin.x)/cell_size), 0);
+  j_min = std::max ((GLint)floor ((loc_point.y - loc_radius - origin.y)/cell_size), 0);
+  k_min = std::max ((GLint)floor ((loc_point.z - loc_radius - origin.z)/cell_size), 0);
+  i_max = std::min ((GLint)floor ((loc_point.x + loc_radius - origin.x)/cell_size), cells_x - 1);
+  j_max = std::min ((GLint)floor ((loc_point.y + loc_radius - origin.y)/cell_size), cells_y - 1);
+  k_max = std::min ((GLint)floor ((loc_point.z + loc_radius - origin.z)/cell_size), cells_z - 1);
+
+  // For each cell in range:
+  for(k = k_min; k <= k_max; k++)
+  {
+    for(j = j_min; j <= j_max; j++)
+    {
+      for(i = i_min; i <= i_max; i++)
+      {
+        c = i + cells_x*(j + cells_y*k);                                                            // Computing cell index...
+
+        // For each "m" node in the cell:
+        for(m = ((c == 0) ? 0 : cell_offset[c - 1]); m < cell_offset[c]; m++)
+        {
+          loc_dx = cell_coordinates[m].x - loc_point.x;                                             // Computing distance "x" component...
+          loc_dy = cell_coordinates[m].y - loc_point.y;                                             // Computing distance "y" component...
+          loc_dz = cell_coordinates[m].z - loc_point.z;                                             // Computing distance "z" component...
+
+          if(loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz <= loc_radius*loc_radius)
+          {
+            loc_result.push_back (cell_node[m]);                                                    // Adding node to result...
+          }
+        }
+      }
+    }
+  }
+}
+
+void nu::spatial::octree_radius (
+                                 size_t              loc_octree_node,                               // Octree node index.
+                                 nu_float4_structure loc_point,                                     // Query point.
+                                 GLfloat             loc_radius,                                    // Query radius.
+                                 std::vector<GLint>& loc_result                                     // Node indices found.
+                                )
+{
+  nu_float4_structure loc_box;                                                                      // Octree node box.
+  GLfloat             loc_dx;                                                                       // Distance "x" component.
+  GLfloat             loc_dy;                                                                       // Distance "y" component.
+  GLfloat             loc_dz;                                                                       // Distance "z" component.
+  GLint               m;                                                                            // Node index.
+  GLint               o;                                                                            // Octant index.
+
+  loc_box = octree_box[loc_octree_node];                                                            // Getting octree node box...
+
+  // Computing point-box distance:
+  loc_dx  = std::max (fabsf (loc_point.x - loc_box.x) - loc_box.w, 0.0f);
+  loc_dy  = std::max (fabsf (loc_point.y - loc_box.y) - loc_box.w, 0.0f);
+  loc_dz  = std::max (fabsf (loc_point.z - loc_box.z) - loc_box.w, 0.0f);
+
+  if(loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz > loc_radius*loc_radius)
+  {
+    return;                                                                                         // Box out of range...
+  }
+
+  if(octree_child[loc_octree_node] >= 0)
+  {
+    for(o = 0; o < 8; o++)
+    {
+      octree_radius (octree_child[loc_octree_node] + o, loc_point, loc_radius, loc_result);         // Querying child...
+    }
+
+    return;
+  }
+
+  // For each "m" node in the leaf:
+  for(m = octree_range[loc_octree_node].x; m < octree_range[loc_octree_node].y; m++)
+  {
+    loc_dx = cell_coordinates[m].x - loc_point.x;                                                   // Computing distance "x" component...
+    loc_dy = cell_coordinates[m].y - loc_point.y;                                                   // Computing distance "y" component...
+    loc_dz = cell_coordinates[m].z - loc_point.z;                                                   // Computing distance "z" component...
+
+    if(loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz <= loc_radius*loc_radius)
+    {
+      loc_result.push_back (cell_node[m]);                                                          // Adding node to result...
+    }
+  }
+}
+
+GLint nu::spatial::nearest (
+                            nu_float4_structure loc_point                                           // Query point.
+                           )
+{
+  GLint   loc_nearest;                                                                              // Nearest node index.
+  GLfloat loc_distance;                                                                             // Squared distance of nearest node.
+  GLint   loc_ring;                                                                                 // Ring index.
+  GLint   loc_rings;                                                                                // Maximum ring index.
+  GLint   ci;                                                                                       // Center cell "x" index.
+  GLint   cj;                                                                                       // Center cell "y" index.
+  GLint   ck;                                                                                       // Center cell "z" index.
+  GLint   i;                                                                                        // Cell "x" index.
+  GLint   j;                                                                                        // Cell "y" index.
+  GLint   k;                                                                                        // Cell "z" index.
+  GLint   c;                                                                                        // Cell index.
+  GLint   m;                                                                                        // Cell node index.
+  GLfloat loc_dx;                                                                                   // Distance "x" component.
+  GLfloat loc_dy;                                                                                   // Distance "y" component.
+  GLfloat loc_dz;                                                                                   // Distance "z" component.
+
+  loc_nearest  = -1;                                                                                // Resetting nearest node...
+  loc_distance = INFINITY;                                                                          // Resetting nearest distance...
+
+  if(cell_node.empty ())
+  {
+    return loc_nearest;                                                                             // Empty index...
+  }
+
+  if(mode == OCTREE)
+  {
+    octree_nearest (0, loc_point, loc_nearest, loc_distance);                                       // Querying octree...
+    return loc_nearest;
+  }
+
+  c         = cell (loc_point);                                                                     // Getting center cell...
+  ci        = c%cells_x;                                                                            // Getting center cell "x" index...
+  cj        = (c/cells_x)%cells_y;                                                                  // Getting center cell "y" index...
+  ck        = c/(cells_x*cells_y);                                                                  // Getting center cell "z" index...
+  loc_rings = std::max (std::max (cells_x, cells_y), cells_z);                                      // Getting maximum ring index...
+
+  // Visiting rings of cells around the center cell:
+  for(loc_ring = 0; loc_ring <= loc_rings; loc_ring++)
+  {
+    for(k = std::max (ck - loc_ring, 0); k <= std::min (ck + loc_ring, cells_z - 1); k++)
+    {
+      for(j = std::max (cj - loc_ring, 0); j <= std::min (cj + loc_ring, cells_y - 1); j++)
+      {
+        for(i = std::max (ci - loc_ring, 0); i <= std::min (ci + loc_ring, cells_x - 1); i++)
+        {
+          // Skipping cells not on the ring:
+          if(std::max (std::max (abs (i - ci), abs (j - cj)), abs (k - ck)) != loc_ring)
+          {
+            continue;
+          }
+
+          c = i + cells_x*(j + cells_y*k);                                                          // Computing cell index...
+
+          // For each "m" node in the cell:
+          for(m = ((c == 0) ? 0 : cell_offset[c - 1]); m < cell_offset[c]; m++)
+          {
+            loc_dx = cell_coordinates[m].x - loc_point.x;                                           // Computing distance "x" component...
+            loc_dy = cell_coordinates[m].y - loc_point.y;                                           // Computing distance "y" component...
+            loc_dz = cell_coordinates[m].z - loc_point.z;                                           // Computing distance "z" component...
+
+            if(loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz < loc_distance)
+            {
+              loc_distance = loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz;                         // Updating nearest distance...
+              loc_nearest  = cell_node[m];                                                          // Updating nearest node...
+            }
+          }
+        }
+      }
+    }
+
+    // Nodes in further rings are at least "loc_ring" cells away:
+    if((loc_nearest >= 0) && (sqrtf (loc_distance) <= loc_ring*cell_size))
+    {
+      break;
+    }
+  }
+
+  return loc_nearest;                                                                               // Returning nearest node...
+}
+
+void nu::spatial::octree_nearest (
+                                  size_t              loc_octree_node,                              // Octree node index.
+                                  nu_float4_structure loc_point,                                    // Query point.
+                                  GLint&              loc_nearest,                                  // Nearest node index.
+                                  GLfloat&            loc_distance                                  // Squared distance of nearest node.
+                                 )
+{
+  nu_float4_structure                       loc_box;                                                // Octree node box.
+  std::vector<std::pair<GLfloat, GLint> >   loc_child;                                              // Children sorted by distance.
+  GLfloat                                   loc_dx;                                                 // Distance "x" component.
+  GLfloat                                   loc_dy;                                                 // Distance "y" component.
+  GLfloat                                   loc_dz;                                                 // Distance "z" component.
+  GLint                                     m;                                                      // Node index.
+  GLint                                     o;                                                      // Octant index.
+
+  loc_box = octree_box[loc_octree_node];                                                            // Getting octree node box...
+
+  // Computing point-box distance:
+  loc_dx  = std::max (fabsf (loc_point.x - loc_box.x) - loc_box.w, 0.0f);
+  loc_dy  = std::max (fabsf (loc_point.y - loc_box.y) - loc_box.w, 0.0f);
+  loc_dz  = std::max (fabsf (loc_point.z - loc_box.z) - loc_box.w, 0.0f);
+
+  if(loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz >= loc_distance)
+  {
+    return;                                                                                         // Box farther than nearest node...
+  }
+
+  if(octree_child[loc_octree_node] >= 0)
+  {
+    // Visiting nearest children first:
+    for(o = 0; o < 8; o++)
+    {
+      loc_box = octree_box[octree_child[loc_octree_node] + o];                                      // Getting child box...
+      loc_dx  = std::max (fabsf (loc_point.x - loc_box.x) - loc_box.w, 0.0f);
+      loc_dy  = std::max (fabsf (loc_point.y - loc_box.y) - loc_box.w, 0.0f);
+      loc_dz  = std::max (fabsf (loc_point.z - loc_box.z) - loc_box.w, 0.0f);
+      loc_child.push_back (std::make_pair (loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz, octree_child[loc_octree_node] + o));
+    }
+
+    std::sort (loc_child.begin (), loc_child.end ());                                               // Sorting children by distance...
+
+    for(o = 0; o < 8; o++)
+    {
+      octree_nearest (loc_child[o].second, loc_point, loc_nearest, loc_distance);                   // Querying child...
+    }
+
+    return;
+  }
+
+  // For each "m" node in the leaf:
+  for(m = octree_range[loc_octree_node].x; m < octree_range[loc_octree_node].y; m++)
+  {
+    loc_dx = cell_coordinates[m].x - loc_point.x;                                                   // Computing distance "x" component...
+    loc_dy = cell_coordinates[m].y - loc_point.y;                                                   // Computing distance "y" component...
+    loc_dz = cell_coordinates[m].z - loc_point.z;                                                   // Computing distance "z" component...
+
+    if(loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz < loc_distance)
+    {
+      loc_distance = loc_dx*loc_dx + loc_dy*loc_dy + loc_dz*loc_dz;                                 // Updating nearest distance...
+      loc_nearest  = cell_node[m];                                                                  // Updating nearest node...
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::spatial::~spatial()
+{
+  if(count_buffer != NULL)
+  {
+    clReleaseMemObject (count_buffer);                                                              // Releasing count buffer...
+  }
+
+  if(rank_buffer != NULL)
+  {
+    clReleaseMemObject (rank_buffer);                                                               // Releasing rank buffer...
+  }
+
+  if(block_buffer != NULL)
+  {
+    clReleaseMemObject (block_buffer);                                                              // Releasing block sum buffer...
+  }
+
+  if(program != NULL)
+  {
+    clReleaseKernel (count_kernel);                                                                 // Releasing "count" kernel...
+    clReleaseKernel (scan_kernel);                                                                  // Releasing "scan" kernel...
+    clReleaseKernel (scan_block_kernel);                                                            // Releasing "scan_block" kernel...
+    clReleaseKernel (scan_add_kernel);                                                              // Releasing "scan_add" kernel...
+    clReleaseKernel (scatter_kernel);                                                               // Releasing "scatter" kernel...
+    clReleaseProgram (program);                                                                     // Releasing program...
+  }
+}
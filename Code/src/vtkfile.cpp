@@ -0,0 +1,353 @@
+/// @file     vtkfile.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "vtkfile" class (VTK unstructured grid time series).
+
+#include "vtkfile.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// "vtkfile" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::vtkfile::vtkfile (
+                      std::string loc_prefix                                                        // File name prefix.
+                     )
+{
+  prefix = loc_prefix;                                                                              // Initializing file name prefix...
+}
+
+uint8_t nu::vtkfile::cell_type (
+                                GLint  loc_element_type,                                            // GMSH element type.
+                                size_t loc_element_nodes                                            // Number of element nodes.
+                               )
+{
+  uint8_t loc_type;                                                                                 // VTK cell type.
+  size_t  loc_nodes;                                                                                // Number of GMSH element nodes.
+
+  switch(loc_element_type)
+  {
+    case 0:  loc_type = 0;  loc_nodes = 0; break;                                                   // Unknown: guessed below.
+    case 1:  loc_type = 3;  loc_nodes = 2; break;                                                   // GMSH 2-node line: VTK_LINE.
+    case 2:  loc_type = 5;  loc_nodes = 3; break;                                                   // GMSH 3-node triangle: VTK_TRIANGLE.
+    case 3:  loc_type = 9;  loc_nodes = 4; break;                                                   // GMSH 4-node quadrangle: VTK_QUAD.
+    case 4:  loc_type = 10; loc_nodes = 4; break;                                                   // GMSH 4-node tetrahedron: VTK_TETRA.
+    case 5:  loc_type = 12; loc_nodes = 8; break;                                                   // GMSH 8-node hexahedron: VTK_HEXAHEDRON.
+    case 6:  loc_type = 13; loc_nodes = 6; break;                                                   // GMSH 6-node prism: VTK_WEDGE.
+    case 7:  loc_type = 14; loc_nodes = 5; break;                                                   // GMSH 5-node pyramid: VTK_PYRAMID.
+    case 15: loc_type = 1;  loc_nodes = 1; break;                                                   // GMSH 1-node point: VTK_VERTEX.
+    default: return 0;                                                                              // Unsupported element type.
+  }
+
+  if(loc_nodes == loc_element_nodes)
+  {
+    return loc_type;                                                                                // Returning cell type of GMSH element type...
+  }
+
+  // Guessing cell type from the number of element nodes (unknown type, or incremental element
+  // of a different type added to a request):
+  switch(loc_element_nodes)
+  {
+    case 1:  return 1;                                                                              // VTK_VERTEX.
+    case 2:  return 3;                                                                              // VTK_LINE.
+    case 3:  return 5;                                                                              // VTK_TRIANGLE.
+    case 4:  return 9;                                                                              // VTK_QUAD.
+    case 5:  return 14;                                                                             // VTK_PYRAMID.
+    case 6:  return 13;                                                                             // VTK_WEDGE.
+    case 8:  return 12;                                                                             // VTK_HEXAHEDRON.
+    default: return 2;                                                                              // VTK_POLY_VERTEX.
+  }
+}
+
+std::string nu::vtkfile::escape (
+                                 std::string loc_text                                               // Text.
+                                )
+{
+  std::string loc_escaped;                                                                          // Escaped text.
+  size_t      i;                                                                                    // Character index.
+
+  for(i = 0; i < loc_text.size (); i++)
+  {
+    switch(loc_text[i])
+    {
+      case '&':  loc_escaped += "&amp;";  break;                                                    // Escaping ampersand...
+      case '<':  loc_escaped += "&lt;";   break;                                                    // Escaping less than...
+      case '>':  loc_escaped += "&gt;";   break;                                                    // Escaping greater than...
+      case '"':  loc_escaped += "&quot;"; break;                                                    // Escaping double quote...
+      case '\'': loc_escaped += "&apos;"; break;                                                    // Escaping single quote...
+      default:   loc_escaped += loc_text[i];                                                        // Copying character...
+    }
+  }
+
+  return loc_escaped;                                                                               // Returning escaped text...
+}
+
+void nu::vtkfile::get_field (
+                             nu::data*    loc_data,                                                 // Field.
+                             const char** loc_value,                                                // Field host data.
+                             size_t*      loc_size,                                                 // Number of values.
+                             size_t*      loc_components                                            // Number of components.
+                            )
+{
+  if(loc_data->type == NU_FLOAT)
+  {
+    *loc_value      = (const char*)((nu::float1*)loc_data)->data.data ();
+    *loc_size       = ((nu::float1*)loc_data)->data.size ();
+    *loc_components = 1;
+  }
+  else
+  {
+    *loc_value      = (const char*)((nu::float4*)loc_data)->data.data ();
+    *loc_size       = ((nu::float4*)loc_data)->data.size ();
+    *loc_components = 4;
+  }
+}
+
+void nu::vtkfile::block (
+                         std::ofstream& loc_file,                                                   // VTU file.
+                         const void*    loc_data,                                                   // Block data.
+                         uint64_t       loc_size                                                    // Block size [bytes].
+                        )
+{
+  loc_file.write ((const char*)&loc_size, sizeof (uint64_t));                                       // Writing block size...
+  loc_file.write ((const char*)loc_data, (std::streamsize)loc_size);                                // Writing block data...
+}
+
+void nu::vtkfile::collection ()
+{
+  std::ofstream loc_file;                                                                           // Collection file.
+  size_t        i;                                                                                  // Series index.
+
+  loc_file.open (prefix + ".pvd", std::ios::trunc);                                                 // Opening collection file...
+
+  if(!loc_file)
+  {
+    neutrino::error ("unable to write collection file " + prefix + ".pvd!");                        // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_file << std::setprecision (17);                                                               // Setting time precision...
+  loc_file << "<?xml version=\"1.0\"?>\n";
+  loc_file << "<VTKFile type=\"Collection\" version=\"1.0\">\n";
+  loc_file << "  <Collection>\n";
+
+  for(i = 0; i < series_file.size (); i++)
+  {
+    loc_file << "    <DataSet timestep=\"" << series_time[i] << "\" part=\"0\" file=\"" <<
+      escape (series_file[i]) << "\"/>\n";
+  }
+
+  loc_file << "  </Collection>\n";
+  loc_file << "</VTKFile>\n";
+  loc_file.close ();                                                                                // Closing collection file...
+}
+
+void nu::vtkfile::add (
+                       std::string loc_name,                                                        // Field name.
+                       nu::float1* loc_data                                                         // Field.
+                      )
+{
+  field_name.push_back (loc_name);                                                                  // Adding field name...
+  field.push_back (loc_data);                                                                       // Adding field...
+}
+
+void nu::vtkfile::add (
+                       std::string loc_name,                                                        // Field name.
+                       nu::float4* loc_data                                                         // Field.
+                      )
+{
+  field_name.push_back (loc_name);                                                                  // Adding field name...
+  field.push_back (loc_data);                                                                       // Adding field...
+}
+
+void nu::vtkfile::write (
+                         nu::mesh* loc_mesh,                                                        // Mesh.
+                         double    loc_time                                                         // Simulation time.
+                        )
+{
+  nu::zone             loc_zone ("vtkfile");                                                        // Profiling zone...
+  const uint16_t       loc_endian = 1;                                                              // Byte order probe.
+  std::ofstream        loc_file;                                                                    // VTU file.
+  std::string          loc_number;                                                                  // Series number string.
+  std::string          loc_file_name;                                                               // VTU file name.
+  size_t               loc_points = loc_mesh->node_coordinates.size ();                             // Number of points.
+  size_t               loc_cells  = loc_mesh->element_offset.size ();                               // Number of cells.
+  uint64_t             loc_offset;                                                                  // Appended data offset [bytes].
+  uint64_t             loc_block;                                                                   // Appended data block size [bytes].
+  std::vector<GLfloat> loc_point;                                                                   // Point coordinates chunk.
+  std::vector<uint8_t> loc_type;                                                                    // Cell types chunk.
+  const char*          loc_value;                                                                   // Field host data.
+  size_t               loc_size;                                                                    // Number of field values.
+  size_t               loc_components;                                                              // Number of field components.
+  size_t               loc_begin;                                                                   // First element node index.
+  GLint                loc_element_type;                                                            // GMSH element type.
+  size_t               r;                                                                           // Request index.
+  size_t               i;                                                                           // Point index.
+  size_t               k;                                                                           // Cell index.
+  size_t               c;                                                                           // Chunk index.
+  size_t               f;                                                                           // Field index.
+  int                  p;                                                                           // Pass index (0 = point data, 1 = cell data: fields checked above).
+
+  // Checking field sizes:
+  for(f = 0; f < field.size (); f++)
+  {
+    get_field (field[f], &loc_value, &loc_size, &loc_components);
+
+    if((loc_size != loc_points) && (loc_size != loc_cells))
+    {
+      neutrino::error ("VTK field " + field_name[f] + " is neither point nor cell data!");          // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  loc_number    = std::to_string (series_file.size ());                                             // Building series number...
+  loc_number    = std::string (loc_number.size () < 6 ? 6 - loc_number.size () : 0, '0') + loc_number;
+  loc_file_name = prefix + "_" + loc_number + ".vtu";                                               // Building VTU file name...
+  loc_file.open (loc_file_name, std::ios::binary | std::ios::trunc);                                // Opening VTU file...
+
+  if(!loc_file)
+  {
+    neutrino::error ("unable to write VTK file " + loc_file_name + "!");                            // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Writing XML header (appended block offsets: points, connectivity, offsets, types, fields):
+  loc_file << "<?xml version=\"1.0\"?>\n";
+  loc_file << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" <<
+    ((*(const char*)&loc_endian == 1) ? "LittleEndian" : "BigEndian") <<
+    "\" header_type=\"UInt64\">\n";
+  loc_file << "  <UnstructuredGrid>\n";
+  loc_file << "    <Piece NumberOfPoints=\"" << loc_points << "\" NumberOfCells=\"" << loc_cells <<
+    "\">\n";
+
+  loc_offset  = sizeof (uint64_t) + 3*sizeof (GLfloat)*loc_points;                                  // Skipping points...
+  loc_offset += sizeof (uint64_t) + sizeof (GLint)*loc_mesh->element.size ();                       // Skipping connectivity...
+  loc_offset += sizeof (uint64_t) + sizeof (GLint)*loc_cells;                                       // Skipping offsets...
+  loc_offset += sizeof (uint64_t) + sizeof (uint8_t)*loc_cells;                                     // Skipping types...
+
+  for(p = 0; p < 2; p++)
+  {
+    loc_file << ((p == 0) ? "      <PointData>\n" : "      <CellData>\n");
+
+    for(f = 0; f < field.size (); f++)
+    {
+      get_field (field[f], &loc_value, &loc_size, &loc_components);
+
+      if((p == 0) ? (loc_size == loc_points) : (loc_size != loc_points))
+      {
+        loc_file << "        <DataArray type=\"Float32\" Name=\"" << escape (field_name[f]) <<
+          "\" NumberOfComponents=\"" << loc_components << "\" format=\"appended\" offset=\"" <<
+          loc_offset << "\"/>\n";
+        loc_offset += sizeof (uint64_t) + loc_components*sizeof (GLfloat)*loc_size;
+      }
+    }
+
+    loc_file << ((p == 0) ? "      </PointData>\n" : "      </CellData>\n");
+  }
+
+  loc_offset = 0;                                                                                   // Resetting appended data offset...
+  loc_file << "      <Points>\n";
+  loc_file << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"appended\"" <<
+    " offset=\"" << loc_offset << "\"/>\n";
+  loc_file << "      </Points>\n";
+  loc_offset += sizeof (uint64_t) + 3*sizeof (GLfloat)*loc_points;                                  // Skipping points...
+  loc_file << "      <Cells>\n";
+  loc_file << "        <DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\"" <<
+    " offset=\"" << loc_offset << "\"/>\n";
+  loc_offset += sizeof (uint64_t) + sizeof (GLint)*loc_mesh->element.size ();                       // Skipping connectivity...
+  loc_file << "        <DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\"" <<
+    " offset=\"" << loc_offset << "\"/>\n";
+  loc_offset += sizeof (uint64_t) + sizeof (GLint)*loc_cells;                                       // Skipping offsets...
+  loc_file << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\"" <<
+    " offset=\"" << loc_offset << "\"/>\n";
+  loc_file << "      </Cells>\n";
+  loc_file << "    </Piece>\n";
+  loc_file << "  </UnstructuredGrid>\n";
+  loc_file << "  <AppendedData encoding=\"raw\">\n";
+  loc_file << "   _";
+
+  // Writing points (4 to 3 components, chunk by chunk):
+  loc_block = sizeof (GLfloat)*3*loc_points;                                                        // Computing points block size...
+  loc_file.write ((const char*)&loc_block, sizeof (uint64_t));                                      // Writing points block size...
+  loc_point.resize (3*std::min (loc_points, (size_t)NU_VTKFILE_CHUNK));                             // Allocating points chunk...
+
+  for(c = 0; c < loc_points; c += NU_VTKFILE_CHUNK)
+  {
+    for(i = c; i < std::min (c + NU_VTKFILE_CHUNK, loc_points); i++)
+    {
+      loc_point[3*(i - c) + 0] = loc_mesh->node_coordinates[i].x;                                   // Setting "x" coordinate...
+      loc_point[3*(i - c) + 1] = loc_mesh->node_coordinates[i].y;                                   // Setting "y" coordinate...
+      loc_point[3*(i - c) + 2] = loc_mesh->node_coordinates[i].z;                                   // Setting "z" coordinate...
+    }
+
+    loc_file.write ((const char*)loc_point.data (), (std::streamsize)(sizeof (GLfloat)*3*(i - c)));
+  }
+
+  // Writing connectivity and offsets (directly from the mesh vectors):
+  block (loc_file, loc_mesh->element.data (), sizeof (GLint)*loc_mesh->element.size ());
+  block (loc_file, loc_mesh->element_offset.data (), sizeof (GLint)*loc_cells);
+
+  // Writing cell types (chunk by chunk):
+  loc_block = sizeof (uint8_t)*loc_cells;                                                           // Computing types block size...
+  loc_file.write ((const char*)&loc_block, sizeof (uint64_t));                                      // Writing types block size...
+  loc_type.resize (std::min (loc_cells, (size_t)NU_VTKFILE_CHUNK));                                 // Allocating types chunk...
+  r = 0;                                                                                            // Resetting request index...
+
+  for(c = 0; c < loc_cells; c += NU_VTKFILE_CHUNK)
+  {
+    for(k = c; k < std::min (c + NU_VTKFILE_CHUNK, loc_cells); k++)
+    {
+      // Finding request of "k" element:
+      while((r < loc_mesh->request_element_offset.size ()) &&
+            ((size_t)loc_mesh->request_element_offset[r] <= k))
+      {
+        r++;
+      }
+
+      loc_element_type = (r < loc_mesh->request_element_type.size ()) ?
+                         loc_mesh->request_element_type[r] : 0;
+      loc_begin        = (k == 0) ? 0 : loc_mesh->element_offset[k - 1];
+      loc_type[k - c]  = cell_type (loc_element_type, loc_mesh->element_offset[k] - loc_begin);
+
+      if(loc_type[k - c] == 0)
+      {
+        neutrino::error ("unsupported element type for VTK file!");                                 // Printing message...
+        exit (EXIT_FAILURE);                                                                        // Exiting...
+      }
+    }
+
+    loc_file.write ((const char*)loc_type.data (), (std::streamsize)(k - c));                       // Writing types chunk...
+  }
+
+  // Writing fields (directly from the host vectors, same order as the XML header):
+  for(p = 0; p < 2; p++)
+  {
+    for(f = 0; f < field.size (); f++)
+    {
+      get_field (field[f], &loc_value, &loc_size, &loc_components);
+
+      if((p == 0) ? (loc_size == loc_points) : (loc_size != loc_points))
+      {
+        block (loc_file, loc_value, loc_components*sizeof (GLfloat)*loc_size);
+      }
+    }
+  }
+
+  loc_file << "\n  </AppendedData>\n";
+  loc_file << "</VTKFile>\n";
+  loc_file.close ();                                                                                // Closing VTU file...
+
+  if(!loc_file)
+  {
+    neutrino::error ("unable to write VTK file " + loc_file_name + "!");                            // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Updating time series:
+  series_time.push_back (loc_time);                                                                 // Adding time...
+  series_file.push_back (loc_file_name.substr (loc_file_name.find_last_of ("/\\") + 1));            // Adding file name (no path)...
+  collection ();                                                                                    // Rewriting collection file...
+}
+
+nu::vtkfile::~vtkfile ()
+{
+  // Doing nothing!
+}